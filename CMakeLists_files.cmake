@@ -226,7 +226,9 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/KeywordHandlers.cpp
     opm/input/eclipse/Schedule/MessageLimits.cpp
     opm/input/eclipse/Schedule/MixingRateControlKeywordHandlers.cpp
+    opm/input/eclipse/Schedule/NameTable.cpp
     opm/input/eclipse/Schedule/OilVaporizationProperties.cpp
+    opm/input/eclipse/Schedule/PrebuiltKeywordObjects.cpp
     opm/input/eclipse/Schedule/RFTConfig.cpp
     opm/input/eclipse/Schedule/RPTConfig.cpp
     opm/input/eclipse/Schedule/RPTKeywordNormalisation.cpp
@@ -258,6 +260,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/Action/ActionValue.cpp
     opm/input/eclipse/Schedule/Action/ASTNode.cpp
     opm/input/eclipse/Schedule/Action/Condition.cpp
+    opm/input/eclipse/Schedule/Action/ConditionProgram.cpp
     opm/input/eclipse/Schedule/Action/Enums.cpp
     opm/input/eclipse/Schedule/Action/PyAction.cpp
     opm/input/eclipse/Schedule/Action/State.cpp
@@ -305,12 +308,14 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/UDQ/UDQConfig.cpp
     opm/input/eclipse/Schedule/UDQ/UDQContext.cpp
     opm/input/eclipse/Schedule/UDQ/UDQDefine.cpp
+    opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.cpp
     opm/input/eclipse/Schedule/UDQ/UDQEnums.cpp
     opm/input/eclipse/Schedule/UDQ/UDQFunction.cpp
     opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.cpp
     opm/input/eclipse/Schedule/UDQ/UDQInput.cpp
     opm/input/eclipse/Schedule/UDQ/UDQParams.cpp
     opm/input/eclipse/Schedule/UDQ/UDQParser.cpp
+    opm/input/eclipse/Schedule/UDQ/UDQProgram.cpp
     opm/input/eclipse/Schedule/UDQ/UDQSet.cpp
     opm/input/eclipse/Schedule/UDQ/UDQState.cpp
     opm/input/eclipse/Schedule/UDQ/UDQToken.cpp
@@ -403,6 +408,7 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list( APPEND MAIN_SOURCE_FILES
+          opm/io/eclipse/ArrayIndexFile.cpp
           opm/io/eclipse/EclFile.cpp
           opm/io/eclipse/EclOutput.cpp
           opm/io/eclipse/EclUtil.cpp
@@ -412,6 +418,8 @@ if(ENABLE_ECL_OUTPUT)
           opm/io/eclipse/ERst.cpp
           opm/io/eclipse/ERsm.cpp
           opm/io/eclipse/ESmry.cpp
+          opm/io/eclipse/ESmryColumns.cpp
+          opm/io/eclipse/EnsembleSummary.cpp
           opm/io/eclipse/ExtESmry.cpp
           opm/io/eclipse/ESmry_write_rsm.cpp
           opm/io/eclipse/OutputStream.cpp
@@ -506,6 +514,7 @@ list (APPEND TEST_SOURCE_FILES
       tests/material/test_fluidsystems.cpp
       tests/material/test_spline.cpp
       tests/material/test_tabulation.cpp
+      tests/test_AppendOnlyArray.cpp
       tests/test_Visitor.cpp
       tests/ml/ml_model_test.cpp
 )
@@ -879,6 +888,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/OpmLog/StreamLog.hpp
       opm/common/OpmLog/TimerLog.hpp
       opm/common/utility/ActiveGridCells.hpp
+      opm/common/utility/AppendOnlyArray.hpp
       opm/common/utility/ConstexprAssert.hpp
       opm/common/utility/CSRGraphFromCoordinates.hpp
       opm/common/utility/CSRGraphFromCoordinates_impl.hpp
@@ -887,6 +897,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/gpuDecorators.hpp
       opm/common/utility/gpuistl_if_available.hpp
       opm/common/utility/MemPacker.hpp
+      opm/common/utility/ParallelWithFallback.hpp
       opm/common/utility/ThreadSafeMapBuilder.hpp
       opm/common/utility/numeric/cmp.hpp
       opm/common/utility/numeric/blas_lapack.h
@@ -1432,6 +1443,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/Well/WellTestState.hpp
        opm/input/eclipse/Schedule/Well/WellConnections.hpp
        opm/input/eclipse/Schedule/WellTraj/RigEclipseWellLogExtractor.hpp
+       opm/input/eclipse/Schedule/NameTable.hpp
        opm/input/eclipse/Schedule/SummaryState.hpp
        opm/input/eclipse/Schedule/RFTConfig.hpp
        opm/input/eclipse/Schedule/RPTConfig.hpp
@@ -1489,6 +1501,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp
        opm/input/eclipse/Schedule/UDQ/UDQContext.hpp
        opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp
+       opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp
        opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp
        opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp
        opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp
@@ -1515,6 +1528,7 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/ArrayIndexFile.hpp
         opm/io/eclipse/EclFile.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
@@ -1525,6 +1539,8 @@ if(ENABLE_ECL_OUTPUT)
         opm/io/eclipse/ERst.hpp
         opm/io/eclipse/ERsm.hpp
         opm/io/eclipse/ESmry.hpp
+        opm/io/eclipse/ESmryColumns.hpp
+        opm/io/eclipse/EnsembleSummary.hpp
         opm/io/eclipse/ExtESmry.hpp
         opm/io/eclipse/PaddedOutputString.hpp
         opm/io/eclipse/OutputStream.hpp
@@ -0,0 +1,192 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <getopt.h>
+
+// Throughput benchmark of binary array output (EclOutput) and input
+// (EclFile) for a synthetic unified restart file.  Run with the same
+// options on builds before and after a change to compare.  The file is
+// read right after writing, so reads are typically served from the page
+// cache unless the file is larger than memory.  Not built by default,
+// build with 'make eclio_throughput_benchmark'.
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nThroughput benchmark of writing and reading a synthetic unified restart file.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-s Approximate file size in MB.  Default 2048.\n"
+              << "-c Number of cells.  Default 1000000.\n"
+              << "-o Output file.  Default BENCHMARK.UNRST in the current directory.\n"
+              << "-k Keep output file.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double megabytes(const std::uintmax_t bytes)
+{
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    int size_mb = 2048;
+    int num_cells = 1000000;
+    std::string filename = "BENCHMARK.UNRST";
+    bool keep = false;
+
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "s:c:o:kh")) != -1) {
+        switch (c) {
+        case 's':
+            size_mb = std::atoi(optarg);
+            break;
+        case 'c':
+            num_cells = std::atoi(optarg);
+            break;
+        case 'o':
+            filename = optarg;
+            break;
+        case 'k':
+            keep = true;
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((size_mb < 1) || (num_cells < 1)) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    // Each report step holds four REAL and one DOUB solution array of
+    // num_cells elements, and small header arrays.
+
+    const auto step_bytes = static_cast<std::uint64_t>(num_cells) * (4*sizeof(float) + sizeof(double));
+    const auto num_steps = std::max(static_cast<int>
+        ((static_cast<std::uint64_t>(size_mb) * 1024 * 1024) / step_bytes), 1);
+
+    std::vector<float> pressure(num_cells);
+    std::vector<float> swat(num_cells);
+    std::vector<float> sgas(num_cells);
+    std::vector<float> rs(num_cells);
+    std::vector<double> temp(num_cells);
+
+    for (int i = 0; i < num_cells; ++i) {
+        pressure[i] = 200.0f + 0.001f * i;
+        swat[i] = 0.2f + 1.0e-7f * i;
+        sgas[i] = 0.1f;
+        rs[i] = 100.0f + 1.0e-5f * i;
+        temp[i] = 80.0 + 1.0e-6 * i;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    {
+        Opm::EclIO::EclOutput output(filename, false, std::ios::out);
+
+        for (int step = 0; step < num_steps; ++step) {
+            output.write<int>("SEQNUM", { step });
+            output.write<int>("INTEHEAD", std::vector<int>(411, step));
+            output.write<double>("DOUBHEAD", std::vector<double>(229, 1.0*step));
+            output.write<bool>("LOGIHEAD", std::vector<bool>(121, true));
+            output.write<float>("PRESSURE", pressure);
+            output.write<float>("SWAT", swat);
+            output.write<float>("SGAS", sgas);
+            output.write<float>("RS", rs);
+            output.write<double>("TEMP", temp);
+        }
+    }
+
+    std::chrono::duration<double> write_time = std::chrono::steady_clock::now() - start;
+
+    const auto file_size = std::filesystem::file_size(filename);
+
+    // Read one array at a time, so that memory use does not grow with the
+    // file size.  The checksum keeps the compiler from discarding reads.
+
+    start = std::chrono::steady_clock::now();
+
+    double checksum = 0.0;
+
+    {
+        Opm::EclIO::EclFile input(filename);
+
+        const auto arrays = input.getList();
+
+        for (std::size_t i = 0; i < arrays.size(); ++i) {
+            const auto index = static_cast<int>(i);
+
+            input.loadData(index);
+
+            switch (std::get<1>(arrays[i])) {
+            case Opm::EclIO::REAL:
+                checksum += input.get<float>(index).back();
+                break;
+            case Opm::EclIO::DOUB:
+                checksum += input.get<double>(index).back();
+                break;
+            case Opm::EclIO::INTE:
+                checksum += input.get<int>(index).back();
+                break;
+            default:
+                break;
+            }
+
+            input.clearData();
+        }
+    }
+
+    std::chrono::duration<double> read_time = std::chrono::steady_clock::now() - start;
+
+    if (! keep)
+        std::filesystem::remove(filename);
+
+    std::cout << "File size:   " << megabytes(file_size) << " MB, " << num_steps << " report steps\n"
+              << "Write:       " << write_time.count() << " s, "
+              << megabytes(file_size) / write_time.count() << " MB/s\n"
+              << "Read:        " << read_time.count() << " s, "
+              << megabytes(file_size) / read_time.count() << " MB/s\n"
+              << "Checksum:    " << checksum << '\n';
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,244 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Units/Units.hpp>
+
+#include <opm/output/data/Groups.hpp>
+#include <opm/output/data/Wells.hpp>
+#include <opm/output/eclipse/Inplace.hpp>
+#include <opm/output/eclipse/Summary.hpp>
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+// Benchmark of out::Summary::eval() for a synthetic model with many wells
+// and a fixed set of well level summary vectors per well.  The default of
+// 5000 wells gives 100,000 summary vectors.  Not built by default, build
+// with 'make summary_eval_benchmark'.
+
+namespace {
+
+const std::vector<std::string> well_keywords {
+    "WOPR", "WWPR", "WGPR", "WLPR", "WVPR",
+    "WOPT", "WWPT", "WGPT", "WLPT", "WVPT",
+    "WWCT", "WGOR", "WGLR", "WOGR", "WWGR",
+    "WBHP", "WTHP", "WWIR", "WGIR", "WWIT",
+};
+
+const std::vector<std::string> group_keywords {
+    "GOPR", "GWPR", "GGPR", "GOPT", "GWPT", "GGPT", "GWCT", "GGOR",
+};
+
+const std::vector<std::string> field_keywords {
+    "FOPR", "FWPR", "FGPR", "FOPT", "FWPT", "FGPT", "FWCT", "FGOR",
+};
+
+constexpr int nx = 100;
+constexpr int wells_per_group = 100;
+
+void printHelp()
+{
+    std::cout << "\nBenchmark of summary vector evaluation for a synthetic model.\n"
+              << "Each well has " << well_keywords.size() << " summary vectors.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-w Number of wells.  Default 5000, giving 100,000 well level vectors.\n"
+              << "-s Number of report steps to evaluate.  Default 20.\n"
+              << "-p Evaluate summary vectors in parallel.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+std::string well_name(const int well)
+{
+    return "W" + std::to_string(well + 1);
+}
+
+std::string make_deck(const int num_wells, const int num_steps)
+{
+    const auto ny = (num_wells + nx - 1) / nx;
+    const auto num_groups = (num_wells + wells_per_group - 1) / wells_per_group;
+    const auto num_cells = nx * ny;
+
+    std::ostringstream deck;
+
+    deck << "RUNSPEC\n"
+         << "DIMENS\n " << nx << ' ' << ny << " 1 /\n"
+         << "OIL\nWATER\nGAS\nMETRIC\n"
+         << "START\n 1 'JAN' 2020 /\n"
+         << "WELLDIMS\n " << num_wells << " 1 " << num_groups + 1 << ' ' << wells_per_group << " /\n"
+         << "GRID\n"
+         << "DX\n " << num_cells << "*100 /\n"
+         << "DY\n " << num_cells << "*100 /\n"
+         << "DZ\n " << num_cells << "*10 /\n"
+         << "TOPS\n " << num_cells << "*2000 /\n"
+         << "PORO\n " << num_cells << "*0.3 /\n"
+         << "PERMX\n " << num_cells << "*100 /\n"
+         << "PERMY\n " << num_cells << "*100 /\n"
+         << "PERMZ\n " << num_cells << "*10 /\n"
+         << "SUMMARY\n";
+
+    for (const auto* keywords : { &field_keywords, &group_keywords, &well_keywords }) {
+        for (const auto& kw : *keywords) {
+            deck << kw << '\n';
+
+            if (kw.front() != 'F')
+                deck << "/\n";
+        }
+    }
+
+    deck << "SCHEDULE\n"
+         << "WELSPECS\n";
+
+    for (int w = 0; w < num_wells; ++w)
+        deck << "  '" << well_name(w) << "' 'G" << w / wells_per_group + 1 << "' "
+             << w % nx + 1 << ' ' << w / nx + 1 << " 1* 'OIL' /\n";
+
+    deck << "/\nCOMPDAT\n";
+
+    for (int w = 0; w < num_wells; ++w)
+        deck << "  '" << well_name(w) << "' 2* 1 1 'OPEN' 2* 0.2 /\n";
+
+    deck << "/\nWCONPROD\n"
+         << "  'W*' 'OPEN' 'ORAT' 1000 4* 100 /\n"
+         << "/\n"
+         << "TSTEP\n " << num_steps << "*30 /\n";
+
+    return deck.str();
+}
+
+Opm::data::Wells well_solution(const int num_wells, const int step)
+{
+    using rt = Opm::data::Rates::opt;
+
+    Opm::data::Wells wells;
+
+    for (int w = 0; w < num_wells; ++w) {
+        auto& well = wells[well_name(w)];
+
+        const auto f = 1.0 + 0.001*w + 0.01*step;
+
+        well.rates.set(rt::oil, -100.0*f*Opm::unit::cubic(Opm::unit::meter)/Opm::unit::day)
+                  .set(rt::wat, -20.0*f*Opm::unit::cubic(Opm::unit::meter)/Opm::unit::day)
+                  .set(rt::gas, -1.0e4*f*Opm::unit::cubic(Opm::unit::meter)/Opm::unit::day)
+                  .set(rt::reservoir_oil, -110.0*f*Opm::unit::cubic(Opm::unit::meter)/Opm::unit::day)
+                  .set(rt::reservoir_water, -21.0*f*Opm::unit::cubic(Opm::unit::meter)/Opm::unit::day)
+                  .set(rt::reservoir_gas, -50.0*f*Opm::unit::cubic(Opm::unit::meter)/Opm::unit::day);
+
+        well.bhp = (150.0 - f)*Opm::unit::barsa;
+        well.thp = (50.0 - f)*Opm::unit::barsa;
+    }
+
+    return wells;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    int num_wells = 5000;
+    int num_steps = 20;
+    bool parallel = false;
+
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "w:s:ph")) != -1) {
+        switch (c) {
+        case 'w':
+            num_wells = std::atoi(optarg);
+            break;
+        case 's':
+            num_steps = std::atoi(optarg);
+            break;
+        case 'p':
+            parallel = true;
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((num_wells < 1) || (num_steps < 1)) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    const auto deck = Opm::Parser{}.parseString(make_deck(num_wells, num_steps));
+    const auto es = Opm::EclipseState { deck };
+    const auto schedule = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+    auto config = Opm::SummaryConfig { deck, schedule, es.fieldProps(), es.aquifer() };
+
+    Opm::out::Summary summary(config, es, es.getInputGrid(), schedule, "SUMMARY_EVAL_BENCHMARK");
+    summary.set_parallel_eval(parallel);
+
+    std::chrono::duration<double> setup_time = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Wells:            " << num_wells << '\n'
+              << "Summary vectors:  " << config.size() << '\n'
+              << "Setup:            " << setup_time.count() << " s\n";
+
+    Opm::SummaryState st(Opm::TimeService::now(), es.runspec().udqParams().undefinedValue());
+
+    const Opm::data::WellBlockAveragePressures wbp{};
+    const Opm::data::GroupAndNetworkValues grp_nwrk{};
+    const Opm::Inplace inplace{};
+
+    std::chrono::duration<double> eval_time{0.0};
+
+    for (int step = 0; step < num_steps; ++step) {
+        const auto wells = well_solution(num_wells, step);
+
+        start = std::chrono::steady_clock::now();
+
+        summary.eval(st, step + 1, (step + 1)*30.0*Opm::unit::day,
+                     wells, wbp, grp_nwrk, {}, {}, inplace);
+
+        eval_time += std::chrono::steady_clock::now() - start;
+    }
+
+    const auto per_step = eval_time.count() / num_steps;
+
+    std::cout << "Evaluation:       " << eval_time.count() << " s for " << num_steps << " steps\n"
+              << "Per step:         " << 1.0e3 * per_step << " ms\n"
+              << "Per vector:       " << 1.0e9 * per_step / config.size() << " ns\n";
+
+    return EXIT_SUCCESS;
+}
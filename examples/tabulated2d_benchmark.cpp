@@ -0,0 +1,336 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/material/common/UniformXTabulated2DFunction.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <getopt.h>
+
+// Benchmark of UniformXTabulated2DFunction::eval() and evalBatch() on a
+// PVTO-like table, against the nested, per-column sample storage that the
+// class used before its samples were flattened.  The reference layout is
+// reproduced below, with the same arithmetic, so both layouts are built
+// with the same compiler and options.  Not built by default, build with
+// 'make tabulated2d_benchmark'.
+
+namespace {
+
+using Scalar = double;
+using Eval = Opm::DenseAd::Evaluation<Scalar, 3>;
+using Table = Opm::UniformXTabulated2DFunction<Scalar>;
+
+/// Nested sample storage, one vector of (x, y, value) points per x
+/// position.  Only what is needed for LeftExtreme interpolation.
+class NestedTable
+{
+public:
+    using SamplePoint = std::tuple<Scalar, Scalar, Scalar>;
+
+    void appendXPos(const Scalar x)
+    {
+        xPos_.push_back(x);
+        yPos_.push_back(std::numeric_limits<Scalar>::lowest() / 2);
+        samples_.emplace_back();
+    }
+
+    void appendSamplePoint(const std::size_t i, const Scalar y, const Scalar value)
+    {
+        if (samples_[i].empty()) {
+            yPos_[i] = y;
+        }
+
+        samples_[i].emplace_back(xPos_[i], y, value);
+    }
+
+    template <class Evaluation>
+    Evaluation eval(const Evaluation& x, const Evaluation& y) const
+    {
+        const auto i = xSegmentIndex(x);
+        const Evaluation alpha = (x - xPos_[i])/(xPos_[i + 1] - xPos_[i]);
+        const Evaluation shift = yPos_[i + 1] - yPos_[i];
+
+        const Evaluation yLower = y - alpha*shift;
+        const Evaluation yUpper = y + (1 - alpha)*shift;
+
+        const auto j1 = ySegmentIndex(yLower, i);
+        const auto j2 = ySegmentIndex(yUpper, i + 1);
+        const Evaluation beta1 = yToBeta(yLower, i, j1);
+        const Evaluation beta2 = yToBeta(yUpper, i + 1, j2);
+
+        const Evaluation s1 = valueAt(i, j1)*(1.0 - beta1) + valueAt(i, j1 + 1)*beta1;
+        const Evaluation s2 = valueAt(i + 1, j2)*(1.0 - beta2) + valueAt(i + 1, j2 + 1)*beta2;
+
+        return s1*(1.0 - alpha) + s2*alpha;
+    }
+
+private:
+    std::vector<std::vector<SamplePoint>> samples_{};
+    std::vector<Scalar> xPos_{};
+    std::vector<Scalar> yPos_{};
+
+    Scalar valueAt(const std::size_t i, const std::size_t j) const
+    {
+        return std::get<2>(samples_[i][j]);
+    }
+
+    template <class Evaluation>
+    unsigned xSegmentIndex(const Evaluation& x) const
+    {
+        if (x <= xPos_[1])
+            return 0;
+        else if (x >= xPos_[xPos_.size() - 2])
+            return xPos_.size() - 2;
+
+        unsigned lowerIdx = 1;
+        unsigned upperIdx = xPos_.size() - 2;
+        while (lowerIdx + 1 < upperIdx) {
+            const unsigned pivotIdx = (lowerIdx + upperIdx) / 2;
+            if (x < xPos_[pivotIdx])
+                upperIdx = pivotIdx;
+            else
+                lowerIdx = pivotIdx;
+        }
+
+        return lowerIdx;
+    }
+
+    template <class Evaluation>
+    unsigned ySegmentIndex(const Evaluation& y, const unsigned i) const
+    {
+        const auto& col = samples_[i];
+
+        if (y <= std::get<1>(col[1]))
+            return 0;
+        else if (y >= std::get<1>(col[col.size() - 2]))
+            return col.size() - 2;
+
+        unsigned lowerIdx = 1;
+        unsigned upperIdx = col.size() - 2;
+        while (lowerIdx + 1 < upperIdx) {
+            const unsigned pivotIdx = (lowerIdx + upperIdx) / 2;
+            if (y < std::get<1>(col[pivotIdx]))
+                upperIdx = pivotIdx;
+            else
+                lowerIdx = pivotIdx;
+        }
+
+        return lowerIdx;
+    }
+
+    template <class Evaluation>
+    Evaluation yToBeta(const Evaluation& y, const unsigned i, const unsigned j) const
+    {
+        const Scalar y1 = std::get<1>(samples_[i][j]);
+        const Scalar y2 = std::get<1>(samples_[i][j + 1]);
+
+        return (y - y1)/(y2 - y1);
+    }
+};
+
+void printHelp()
+{
+    std::cout << "\nBenchmark of 2D table evaluation on a PVTO-like table.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-x Number of Rs nodes.  Default 50.\n"
+              << "-y Number of pressure nodes per Rs node.  Default 9.\n"
+              << "-n Number of evaluation points.  Default 1000000.\n"
+              << "-r Number of repetitions.  Best time is reported.  Default 5.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+// Saturation pressure and undersaturated inverse formation volume factor
+// of a synthetic oil.
+Scalar saturationPressure(const Scalar rs)
+{
+    return 1.0e5 + 1.5e5*rs;
+}
+
+Scalar inverseFormationVolumeFactor(const Scalar rs, const Scalar p)
+{
+    return 1.0/(1.0 + 4.0e-3*rs) * (1.0 + 2.0e-9*(p - saturationPressure(rs)));
+}
+
+template <class Evaluate>
+double bestTime(const int repetitions, Evaluate&& evaluate)
+{
+    auto best = std::numeric_limits<double>::max();
+
+    for (int rep = 0; rep < repetitions; ++rep) {
+        const auto start = std::chrono::steady_clock::now();
+        evaluate();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+double maxDifference(const std::vector<Eval>& a, const std::vector<Eval>& b)
+{
+    auto diff = 0.0;
+
+    for (std::size_t k = 0; k < a.size(); ++k) {
+        diff = std::max(diff, std::abs(a[k].value() - b[k].value()));
+
+        for (int d = 0; d < Eval::numVars; ++d)
+            diff = std::max(diff, std::abs(a[k].derivative(d) - b[k].derivative(d)));
+    }
+
+    return diff;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    int num_x = 50;
+    int num_y = 9;
+    int num_points = 1000000;
+    int repetitions = 5;
+
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "x:y:n:r:h")) != -1) {
+        switch (c) {
+        case 'x':
+            num_x = std::atoi(optarg);
+            break;
+        case 'y':
+            num_y = std::atoi(optarg);
+            break;
+        case 'n':
+            num_points = std::atoi(optarg);
+            break;
+        case 'r':
+            repetitions = std::atoi(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((num_x < 2) || (num_y < 2) || (num_points < 1) || (repetitions < 1)) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    const Scalar rs_max = 200.0;
+    const Scalar dp = 5.0e6;
+
+    Table table(Table::InterpolationPolicy::LeftExtreme);
+    NestedTable nested;
+
+    for (int i = 0; i < num_x; ++i) {
+        const auto rs = rs_max*i/(num_x - 1);
+
+        table.appendXPos(rs);
+        nested.appendXPos(rs);
+
+        for (int j = 0; j < num_y; ++j) {
+            const auto p = saturationPressure(rs) + dp*j;
+
+            table.appendSamplePoint(i, p, inverseFormationVolumeFactor(rs, p));
+            nested.appendSamplePoint(i, p, inverseFormationVolumeFactor(rs, p));
+        }
+    }
+
+    // Random points in the undersaturated region, as evaluated by the
+    // simulator in cell order, and the same points sorted by Rs.
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> rs_dist(0.0, rs_max);
+    std::uniform_real_distribution<Scalar> dp_dist(0.0, dp*(num_y - 1));
+
+    std::vector<Eval> x(num_points);
+    std::vector<Eval> y(num_points);
+
+    for (int k = 0; k < num_points; ++k) {
+        const auto rs = rs_dist(gen);
+
+        x[k] = Eval::createVariable(rs, 0);
+        y[k] = Eval::createVariable(saturationPressure(rs) + dp_dist(gen), 1);
+    }
+
+    std::vector<int> order(num_points);
+    for (int k = 0; k < num_points; ++k)
+        order[k] = k;
+
+    std::sort(order.begin(), order.end(),
+              [&x](const int a, const int b) { return x[a].value() < x[b].value(); });
+
+    std::vector<Eval> x_sorted(num_points);
+    std::vector<Eval> y_sorted(num_points);
+
+    for (int k = 0; k < num_points; ++k) {
+        x_sorted[k] = x[order[k]];
+        y_sorted[k] = y[order[k]];
+    }
+
+    std::vector<Eval> nested_result(num_points);
+    std::vector<Eval> flat_result(num_points);
+    std::vector<Eval> nested_sorted(num_points);
+    std::vector<Eval> batch_sorted(num_points);
+
+    const auto nested_time = bestTime(repetitions, [&]() {
+        for (int k = 0; k < num_points; ++k)
+            nested_result[k] = nested.eval(x[k], y[k]);
+    });
+
+    const auto flat_time = bestTime(repetitions, [&]() {
+        for (int k = 0; k < num_points; ++k)
+            flat_result[k] = table.eval(x[k], y[k], /*extrapolate=*/true);
+    });
+
+    const auto nested_sorted_time = bestTime(repetitions, [&]() {
+        for (int k = 0; k < num_points; ++k)
+            nested_sorted[k] = nested.eval(x_sorted[k], y_sorted[k]);
+    });
+
+    const auto batch_time = bestTime(repetitions, [&]() {
+        table.evalBatch(x_sorted, y_sorted, batch_sorted, /*extrapolate=*/true);
+    });
+
+    std::cout << "Table:                    " << num_x << " x " << num_y << " nodes\n"
+              << "Points:                   " << num_points << '\n'
+              << "Nested eval():            " << 1.0e3*nested_time << " ms\n"
+              << "Flat eval():              " << 1.0e3*flat_time << " ms\n"
+              << "Nested eval(), sorted:    " << 1.0e3*nested_sorted_time << " ms\n"
+              << "Flat evalBatch(), sorted: " << 1.0e3*batch_time << " ms\n"
+              << "Max difference:           "
+              << std::max(maxDifference(nested_result, flat_result),
+                          maxDifference(nested_sorted, batch_sorted)) << '\n';
+
+    return EXIT_SUCCESS;
+}
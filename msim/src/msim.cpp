@@ -107,7 +107,7 @@ void msim::run(EclipseIO& io, bool report_only)
         }
 
         const auto sim_time = TimeService::from_time_t(schedule.simTime(report_step));
-        post_step(sol, well_data, group_nwrk_data, report_step, sim_time);
+        post_step(sol, well_data, group_nwrk_data, report_step, sim_time, io);
 
         const auto& exit_status = schedule.exitStatus();
         if (exit_status.has_value()) {
@@ -127,7 +127,8 @@ void msim::post_step(data::Solution& /* sol */,
                      data::Wells& /* well_data */,
                      data::GroupAndNetworkValues& /* grp_nwrk_data */,
                      const size_t report_step,
-                     const time_point& sim_time)
+                     const time_point& sim_time,
+                     EclipseIO& io)
 {
     const auto& actions = this->schedule[report_step].actions.get();
     if (actions.empty()) {
@@ -135,18 +136,23 @@ void msim::post_step(data::Solution& /* sol */,
     }
 
     const auto context = Action::Context {
-        this->st, this->schedule[report_step].wlist_manager.get()
+        this->st, this->schedule[report_step].wlist_manager.get(),
+        this->action_state.context_cache()
     };
 
     for (const auto& action : actions.pending(this->action_state, std::chrono::system_clock::to_time_t(sim_time))) {
         const auto result = action->eval(context);
         if (result.conditionSatisfied()) {
+            // Actions modify the Schedule, which pending asynchronous
+            // output might still be reading.
+            io.flushOutput();
             this->schedule.applyAction(report_step, *action, result.matches(),
                                        std::unordered_map<std::string,double>{}, true);
         }
     }
 
     for (const auto& pyaction : actions.pending_python(this->action_state)) {
+        io.flushOutput();
         this->schedule.runPyAction(report_step, *pyaction,
                                    this->action_state, this->state, this->st);
     }
@@ -21,6 +21,7 @@
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 #include <iostream>
+#include <utility>
 #include <errno.h>  // For errno
 #include <stdio.h>  // For fileno() and stdout
 
@@ -38,9 +39,35 @@
 #include <unistd.h> // For isatty()
 #endif
 
+namespace {
+    // Messages of current thread are held back here if non-null.
+    thread_local Opm::OpmLog::DeferredMessages* deferred_messages = nullptr;
+}
+
 namespace Opm {
     int OpmLog::debug_verbosity_level_ = defaultDebugVerbosityLevel;
 
+    void OpmLog::DeferredMessages::release()
+    {
+        auto messages = std::move(this->messages_);
+        this->messages_.clear();
+
+        for (const auto& message : messages) {
+            addTaggedMessage(message.flag, message.tag, message.text);
+        }
+    }
+
+    OpmLog::DeferMessages::DeferMessages(DeferredMessages& messages)
+        : previous_(deferred_messages)
+    {
+        deferred_messages = &messages;
+    }
+
+    OpmLog::DeferMessages::~DeferMessages()
+    {
+        deferred_messages = this->previous_;
+    }
+
     bool OpmLog::stdoutIsTerminal()
     {
         const int errno_save = errno; // For playing nice with C error handling.
@@ -74,12 +101,22 @@ namespace Opm {
 
 
     void OpmLog::addMessage(int64_t messageFlag , const std::string& message) {
+        if (deferred_messages != nullptr) {
+            deferred_messages->messages_.push_back({ messageFlag, {}, message });
+            return;
+        }
+
         if (m_logger)
             m_logger->addMessage( messageFlag , message );
     }
 
 
     void OpmLog::addTaggedMessage(int64_t messageFlag, const std::string& tag, const std::string& message) {
+        if (deferred_messages != nullptr) {
+            deferred_messages->messages_.push_back({ messageFlag, tag, message });
+            return;
+        }
+
         if (m_logger)
             m_logger->addTaggedMessage( messageFlag, tag, message );
     }
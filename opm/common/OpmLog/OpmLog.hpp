@@ -22,6 +22,8 @@
 
 #include <memory>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
@@ -44,6 +46,49 @@ class OpmLog {
 public:
     constexpr static int defaultDebugVerbosityLevel = 1;
 
+    /// Messages held back from the logger by a DeferMessages object.
+    class DeferredMessages
+    {
+    public:
+        /// Pass the held back messages on to the logger, in the order in
+        /// which they were added, and forget them.
+        void release();
+
+        /// Forget the held back messages.
+        void clear() { this->messages_.clear(); }
+
+        bool empty() const { return this->messages_.empty(); }
+
+    private:
+        friend class OpmLog;
+
+        struct Message
+        {
+            int64_t flag{0};
+            std::string tag{};
+            std::string text{};
+        };
+
+        std::vector<Message> messages_{};
+    };
+
+    /// Hold back all messages which the current thread adds while this
+    /// object is alive, e.g., in a parallel section, so that they can be
+    /// passed on later by the sequential code.  Messages added by other
+    /// threads are not affected.
+    class DeferMessages
+    {
+    public:
+        explicit DeferMessages(DeferredMessages& messages);
+        ~DeferMessages();
+
+        DeferMessages(const DeferMessages&) = delete;
+        DeferMessages& operator=(const DeferMessages&) = delete;
+
+    private:
+        DeferredMessages* previous_{nullptr};
+    };
+
     static void addMessage(int64_t messageFlag , const std::string& message);
     static void addTaggedMessage(int64_t messageFlag, const std::string& tag, const std::string& message);
 
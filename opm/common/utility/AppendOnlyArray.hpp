@@ -0,0 +1,129 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_APPEND_ONLY_ARRAY_HPP
+#define OPM_APPEND_ONLY_ARRAY_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace Opm {
+
+/// Array which only grows at the end and whose elements never move.
+///
+/// Elements are stored in chunks of geometrically increasing size--chunk
+/// 'c' holds FirstChunk * 2^c elements--so a small, fixed set of chunk
+/// pointers covers any realistic number of elements without ever
+/// relocating existing ones.  Element access does not take any locks and
+/// may run concurrently with push_back(), provided the index is less than
+/// a size() observed by the reading thread.  Calls to push_back() must be
+/// serialised by the caller.
+///
+/// \tparam T Element type.  Must be default constructible and move
+///   assignable.
+///
+/// \tparam FirstChunk Number of elements in the first chunk.
+template <typename T, std::size_t FirstChunk = 256>
+class AppendOnlyArray
+{
+public:
+    AppendOnlyArray()
+    {
+        for (auto& chunk : this->chunks_) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~AppendOnlyArray()
+    {
+        for (auto& chunk : this->chunks_) {
+            delete [] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    AppendOnlyArray(const AppendOnlyArray&) = delete;
+    AppendOnlyArray& operator=(const AppendOnlyArray&) = delete;
+
+    /// Number of elements.
+    std::size_t size() const
+    {
+        return this->size_.load(std::memory_order_acquire);
+    }
+
+    /// Element at position \p i.  No range checking.
+    const T& operator[](const std::size_t i) const
+    {
+        const auto [c, offset] = locate(i);
+        return this->chunks_[c].load(std::memory_order_acquire)[offset];
+    }
+
+    /// Append element.
+    ///
+    /// \param[in] value New element.
+    ///
+    /// \return Reference to stored element.  Remains valid for the
+    ///   lifetime of the array.
+    T& push_back(T&& value)
+    {
+        const auto i = this->size_.load(std::memory_order_relaxed);
+        const auto [c, offset] = locate(i);
+
+        if (c >= max_chunks) {
+            throw std::length_error { "AppendOnlyArray capacity exhausted" };
+        }
+
+        auto* chunk = this->chunks_[c].load(std::memory_order_relaxed);
+        if (chunk == nullptr) {
+            chunk = new T[FirstChunk << c];
+            this->chunks_[c].store(chunk, std::memory_order_release);
+        }
+
+        auto& stored = chunk[offset];
+        stored = std::move(value);
+
+        this->size_.store(i + 1, std::memory_order_release);
+
+        return stored;
+    }
+
+private:
+    static constexpr std::size_t max_chunks = 40;
+
+    std::array<std::atomic<T*>, max_chunks> chunks_{};
+    std::atomic<std::size_t> size_{0};
+
+    /// Chunk and position within chunk of element 'i'.  Chunk 'c' starts
+    /// at element FirstChunk * (2^c - 1).
+    static std::pair<std::size_t, std::size_t> locate(const std::size_t i)
+    {
+        auto c = std::size_t{0};
+        for (auto q = i/FirstChunk + 1; q > 1; q >>= 1) {
+            ++c;
+        }
+
+        return { c, i - FirstChunk*((std::size_t{1} << c) - 1) };
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_APPEND_ONLY_ARRAY_HPP
@@ -0,0 +1,123 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PARALLEL_WITH_FALLBACK_HPP
+#define OPM_PARALLEL_WITH_FALLBACK_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+/// Run independent tasks concurrently and complete them sequentially.
+///
+/// First calls attempt(shared_copy, i) for all i in [0, n) on OpenMP
+/// threads, then complete(i, failed) for all i in increasing order on the
+/// calling thread.  An exception thrown by attempt() is discarded and
+/// reported to complete() as failed == true.  The caller is expected to
+/// redo failed tasks in complete(), where exceptions propagate normally
+/// and may be reported in context--e.g., with the input location--exactly
+/// as in a sequential run.  Consequently, the outcome does not depend on
+/// the number of threads, nor on whether or not OpenMP is enabled, and
+/// attempt() must be free of side effects other than on the storage for
+/// task i.
+///
+/// Each thread passes its own copy of \p shared to attempt().  This
+/// supports objects which, like UnitSystem, update internal state from
+/// const member functions.  Such updates are discarded with the copy.  In
+/// the case of UnitSystem, the state is a usage counter which only guards
+/// Deck::selectActiveUnitSystem() against switching unit systems after
+/// dimensioned input has been processed, so the lost increments have no
+/// effect on unit systems belonging to already constructed objects.
+///
+/// \param[in] n Number of tasks.
+///
+/// \param[in] chunk_size Number of consecutive tasks assigned to a
+///   thread at a time.
+///
+/// \param[in] shared Object copied to each thread.
+///
+/// \param[in] attempt Task function.  Called as attempt(shared_copy, i).
+///
+/// \param[in] complete Completion function.  Called as complete(i,
+///   failed) in task order.
+template <typename Shared, typename Attempt, typename Complete>
+void parallelWithSequentialFallback(const std::size_t n,
+                                    const int         chunk_size,
+                                    const Shared&     shared,
+                                    Attempt&&         attempt,
+                                    Complete&&        complete)
+{
+    auto failed = std::vector<unsigned char>(n, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        const auto shared_copy = shared;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, chunk_size)
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            try {
+                attempt(shared_copy, i);
+            }
+            catch (...) {
+                failed[i] = 1;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        complete(i, failed[i] != 0);
+    }
+}
+
+/// Run independent tasks concurrently and complete them sequentially.
+///
+/// Same as the overload above, except that there is no per-thread copy
+/// of a shared object.
+///
+/// \param[in] n Number of tasks.
+///
+/// \param[in] chunk_size Number of consecutive tasks assigned to a
+///   thread at a time.
+///
+/// \param[in] attempt Task function.  Called as attempt(i).
+///
+/// \param[in] complete Completion function.  Called as complete(i,
+///   failed) in task order.
+template <typename Attempt, typename Complete>
+void parallelWithSequentialFallback(const std::size_t n,
+                                    const int         chunk_size,
+                                    Attempt&&         attempt,
+                                    Complete&&        complete)
+{
+    struct NoShared {};
+
+    parallelWithSequentialFallback(n, chunk_size, NoShared{},
+                                   [&attempt](const NoShared&, const std::size_t i)
+                                   { attempt(i); },
+                                   complete);
+}
+
+} // namespace Opm
+
+#endif // OPM_PARALLEL_WITH_FALLBACK_HPP
@@ -56,11 +56,13 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include <map>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -129,45 +131,187 @@ namespace Opm {
 // process is done twice, first after the initial field_props processing and
 // subsequently after the processing of numerical aquifers.
 
+    EclipseState::Components EclipseState::Components::gridProperties()
+    {
+        auto components = Components{};
+
+        components.aquifers = false;
+        components.transMult = false;
+        components.faults = false;
+        components.lgrs = false;
+        components.tracers = false;
+        components.compositional = false;
+
+        return components;
+    }
+
+    EclipseState::Components EclipseState::Components::schedule()
+    {
+        auto components = Components{};
+
+        components.faults = false;
+        components.lgrs = false;
+
+        return components;
+    }
+
+    EclipseState::Components EclipseState::Components::withDependencies() const
+    {
+        auto components = *this;
+
+        components.transMult = components.transMult || components.aquifers || components.faults;
+        components.fieldProps = components.fieldProps || components.transMult;
+        components.grid = components.grid || components.fieldProps || components.lgrs;
+        components.tables = components.tables || components.fieldProps;
+
+        return components;
+    }
+
+    // Bookkeeping for a single EclipseState construction: the resolved
+    // component selection and the per-component construction times.
+    class EclipseState::Construction
+    {
+    public:
+        explicit Construction(const Components& components)
+            : components_ { components.withDependencies() }
+        {}
+
+        const Components& components() const
+        {
+            return this->components_;
+        }
+
+        template <typename Build>
+        std::invoke_result_t<Build> timed(const std::string& component, Build&& build)
+        {
+            const auto timer = Timer { *this, component };
+            return build();
+        }
+
+        void report() const
+        {
+            for (const auto& [component, seconds] : this->timings_) {
+                OpmLog::debug(fmt::format("EclipseState: {} constructed in {:.3f} seconds",
+                                          component, seconds));
+            }
+        }
+
+    private:
+        class Timer
+        {
+        public:
+            Timer(Construction& construction, const std::string& component)
+                : construction_ { construction }
+                , component_    { component }
+                , start_        { std::chrono::steady_clock::now() }
+            {}
+
+            ~Timer()
+            {
+                const auto elapsed = std::chrono::duration<double> {
+                    std::chrono::steady_clock::now() - this->start_
+                };
+
+                this->construction_.timings_.emplace_back(this->component_, elapsed.count());
+            }
+
+        private:
+            Construction& construction_;
+            std::string component_;
+            std::chrono::steady_clock::time_point start_;
+        };
+
+        Components components_{};
+        std::vector<std::pair<std::string, double>> timings_{};
+    };
+
     EclipseState::EclipseState(const Deck& deck)
+        : EclipseState { deck, Components{} }
+    {}
+
+    EclipseState::EclipseState(const Deck& deck, const Components& components)
+        : EclipseState { deck, Construction { components } }
+    {}
+
+    EclipseState::EclipseState(const Deck& deck, Construction&& construction)
     try
-        : m_tables(            deck )
+        : m_tables(            construction.components().tables
+                               ? construction.timed("TableManager", [&deck]() { return TableManager { deck }; })
+                               : TableManager{} )
         , m_runspec(           deck )
         , m_eclipseConfig(     deck )
         , m_deckUnitSystem(    deck.getActiveUnitSystem() )
-        , m_inputGrid(         deck, nullptr )
-        , m_inputNnc(          m_inputGrid, deck)
+        , m_inputGrid(         construction.components().grid
+                               ? construction.timed("EclipseGrid", [&deck]() { return EclipseGrid { deck, nullptr }; })
+                               : EclipseGrid{} )
+        , m_inputNnc(          construction.components().grid
+                               ? construction.timed("NNC", [this, &deck]() { return NNC { m_inputGrid, deck }; })
+                               : NNC{} )
         , m_gridDims(          deck )
-        , field_props(         deck, m_runspec.phases(), m_inputGrid, m_tables, m_runspec.numComps())
-        , m_simulationConfig(  m_eclipseConfig.init().restartRequested(), deck, field_props)
-        , aquifer_config(      m_tables, m_inputGrid, deck, field_props)
-        , compositional_config(deck, m_runspec)
-        , m_transMult(         GridDims(deck), deck, field_props)
-        , tracer_config(       m_deckUnitSystem, deck)
-        , wag_hyst_config(     deck)
-        , co2_store_config(    deck)
+        , field_props(         construction.components().fieldProps
+                               ? construction.timed("FieldPropsManager", [this, &deck]() {
+                                   return FieldPropsManager { deck, m_runspec.phases(), m_inputGrid,
+                                                              m_tables, m_runspec.numComps() };
+                               })
+                               : FieldPropsManager{} )
+        , m_simulationConfig(  construction.components().fieldProps
+                               ? SimulationConfig { m_eclipseConfig.init().restartRequested(), deck, field_props }
+                               : SimulationConfig{} )
+        , aquifer_config(      construction.components().aquifers
+                               ? construction.timed("AquiferConfig", [this, &deck]() {
+                                   return AquiferConfig { m_tables, m_inputGrid, deck, field_props };
+                               })
+                               : AquiferConfig{} )
+        , compositional_config(construction.components().compositional
+                               ? CompositionalConfig { deck, m_runspec }
+                               : CompositionalConfig{} )
+        , m_transMult(         construction.components().transMult
+                               ? construction.timed("TransMult", [this, &deck]() {
+                                   return TransMult { GridDims(deck), deck, field_props };
+                               })
+                               : TransMult{} )
+        , tracer_config(       construction.components().tracers
+                               ? TracerConfig { m_deckUnitSystem, deck }
+                               : TracerConfig{} )
+        , wag_hyst_config(     deck )
+        , co2_store_config(    deck )
     {
+        const auto& components = construction.components();
+        this->m_components = components;
+
         this->assignRunTitle(deck);
         this->reportNumberOfActivePhases();
 
-        if (field_props.has_double("MINPVV")) {
+        if (components.fieldProps && field_props.has_double("MINPVV")) {
             this->m_inputGrid.setMINPVV(field_props.get_global_double("MINPVV"));
         }
-        this->conveyNumericalAquiferEffects();
-        if (field_props.has_double("MINPVV")) {
+        if (components.aquifers) {
+            this->conveyNumericalAquiferEffects();
+        }
+        if (components.fieldProps && field_props.has_double("MINPVV")) {
             field_props.deleteMINPVV();
         }
-        this->initLgrs(deck);
-        this->aquifer_config.load_connections(deck, this->getInputGrid());
+        if (components.lgrs) {
+            construction.timed("LgrCollection", [this, &deck]() { this->initLgrs(deck); });
+        }
+        if (components.aquifers) {
+            this->aquifer_config.load_connections(deck, this->getInputGrid());
+        }
 
-        this->applyMULTXYZ();
-        this->initFaults(deck);
-        m_simulationConfig.m_ThresholdPressure.readFaults(deck,m_faults);
+        if (components.transMult) {
+            this->applyMULTXYZ();
+        }
+        if (components.faults) {
+            construction.timed("FaultCollection", [this, &deck]() { this->initFaults(deck); });
+            m_simulationConfig.m_ThresholdPressure.readFaults(deck,m_faults);
+        }
 
         if (this->getInitConfig().restartRequested()) {
             verify_consistent_restart_information(deck.get<ParserKeywords::RESTART>().back(),
                                                   this->getIOConfig(), this->getInitConfig());
         }
+
+        construction.report();
     }
     catch (const OpmInputError& opm_error) {
         OpmLog::error(opm_error.what());
@@ -200,10 +344,12 @@ namespace Opm {
 
 
     const FieldPropsManager& EclipseState::fieldProps() const {
+        this->ensureFieldProps("fieldProps()");
         return this->field_props;
     }
 
     const FieldPropsManager& EclipseState::globalFieldProps() const {
+        this->ensureFieldProps("globalFieldProps()");
         return this->field_props;
     }
 
@@ -358,15 +504,18 @@ namespace Opm {
 
     void EclipseState::prune_global_for_schedule_run()
     {
+        this->ensureFieldProps("prune_global_for_schedule_run()");
         this->field_props.prune_global_for_schedule_run();
     }
 
     void EclipseState::reset_actnum(const std::vector<int>& new_actnum) {
+        this->ensureFieldProps("reset_actnum()");
         this->field_props.reset_actnum(new_actnum);
     }
 
     void EclipseState::set_active_indices(const std::vector<int>& indices)
     {
+        this->ensureFieldProps("set_active_indices()");
         this->field_props.set_active_indices(indices);
     }
 
@@ -526,6 +675,16 @@ namespace Opm {
         }
     }
 
+    void EclipseState::ensureFieldProps(const std::string& operation) const
+    {
+        if (! this->m_components.fieldProps) {
+            throw std::logic_error {
+                fmt::format("EclipseState::{} is not available because field "
+                            "properties were not selected for construction", operation)
+            };
+        }
+    }
+
 
     /*
       The apply_schedule_keywords can apply a small set of keywords from the
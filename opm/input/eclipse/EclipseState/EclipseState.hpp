@@ -68,8 +68,42 @@ namespace Opm {
             AllProperties = IntProperties | DoubleProperties
         };
 
+        /// Selection of static model components to build from the input
+        /// deck.  The run specification, IO and init configuration, unit
+        /// systems and grid dimensions are always built.  Components which
+        /// are not selected are left default constructed, except for the
+        /// field properties which are unavailable.  In that case
+        /// fieldProps() and globalFieldProps() throw std::logic_error.
+        struct Components
+        {
+            bool tables{true};
+            bool grid{true};            ///< EclipseGrid and input NNCs.
+            bool fieldProps{true};      ///< Also SimulationConfig.
+            bool aquifers{true};
+            bool transMult{true};
+            bool faults{true};          ///< Faults and MULTFLT.
+            bool lgrs{true};
+            bool tracers{true};
+            bool compositional{true};
+
+            /// Tables, grid and field properties only.
+            static Components gridProperties();
+
+            /// Components needed to construct a Schedule.
+            static Components schedule();
+
+            /// Copy of this selection with all components required by a
+            /// selected component added.
+            Components withDependencies() const;
+        };
+
         EclipseState() = default;
         explicit EclipseState(const Deck& deck);
+
+        /// Build only the selected components.  Dependencies of selected
+        /// components are built as well, and the construction time of
+        /// each component is reported through OpmLog::debug().
+        EclipseState(const Deck& deck, const Components& components);
         virtual ~EclipseState() = default;
 
         const IOConfig& getIOConfig() const;
@@ -172,6 +206,14 @@ namespace Opm {
         static bool rst_cmp(const EclipseState& full_state, const EclipseState& rst_state);
 
     private:
+        class Construction;
+
+        /// Components built by the constructor.  Not serialised, since
+        /// only fully built objects are distributed.
+        Components m_components{};
+
+        EclipseState(const Deck& deck, Construction&& construction);
+
         void initIOConfigPostSchedule(const Deck& deck);
         void assignRunTitle(const Deck& deck);
         void reportNumberOfActivePhases() const;
@@ -186,6 +228,8 @@ namespace Opm {
         void complainAboutAmbiguousKeyword(const Deck& deck,
                                            const std::string& keywordName);
 
+        void ensureFieldProps(const std::string& operation) const;
+
      protected:
         TableManager m_tables;
         Runspec m_runspec;
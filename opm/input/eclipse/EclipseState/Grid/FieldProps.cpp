@@ -2147,10 +2147,69 @@ void FieldProps::init_satfunc(const std::string& keyword,
     satfunc.default_update(satfunc::init(keyword, this->tables, this->m_phases, this->m_rtep.value(), this->cell_depth, satreg, endnum));
 }
 
+void FieldProps::init_satfunc(const PROPSSection& props_section)
+{
+    // Default values of all saturation function endpoint arrays assigned
+    // in the section, computed in a single pass over the cells.
+    auto keywords = std::vector<std::string>{};
+    auto kw_infos = std::vector<Fieldprops::keywords::keyword_info<double>>{};
+
+    for (const auto& deck_keyword : props_section) {
+        const auto keyword = Fieldprops::keywords::get_keyword_from_alias(deck_keyword.name());
+
+        if ((this->double_data.count(keyword) != 0) ||
+            (std::find(keywords.begin(), keywords.end(), keyword) != keywords.end()))
+        {
+            continue;
+        }
+
+        if (Fieldprops::keywords::PROPS::satfunc.count(keyword) == 1) {
+            keywords.push_back(keyword);
+            kw_infos.emplace_back();
+        }
+        else if (is_capillary_pressure(keyword)) {
+            keywords.push_back(keyword);
+            kw_infos.push_back(Fieldprops::keywords::PROPS::double_keywords.at(keyword));
+        }
+    }
+
+    if (keywords.empty()) {
+        return;
+    }
+
+    if (!this->m_rtep.has_value())
+        this->m_rtep = satfunc::getRawTableEndpoints(this->tables, this->m_phases,
+                                                     this->m_satfuncctrl.minimumRelpermMobilityThreshold());
+
+    const auto any_imbibition =
+        std::any_of(keywords.begin(), keywords.end(),
+                    [](const std::string& keyword) { return keyword[0] == 'I'; });
+
+    const auto& endnum = this->get<int>("ENDNUM");
+    const auto& satnum = this->get<int>("SATNUM");
+    const auto& imbnum = any_imbibition ? this->get<int>("IMBNUM") : satnum;
+
+    const auto values = satfunc::init(keywords, this->tables, this->m_phases, this->m_rtep.value(),
+                                      this->cell_depth, satnum, imbnum, endnum);
+
+    for (std::size_t i = 0; i < keywords.size(); ++i) {
+        const auto& kw_info = kw_infos[i];
+
+        auto& satfunc = this->double_data
+            .try_emplace(keywords[i], kw_info, this->active_size,
+                         kw_info.global ? this->global_size : std::size_t{0})
+            .first->second;
+
+        satfunc.default_update(values[i]);
+    }
+}
+
 void FieldProps::scanPROPSSection(const PROPSSection& props_section)
 {
     auto box = makeGlobalGridBox(this->grid_ptr);
 
+    this->init_satfunc(props_section);
+
     for (const auto& keyword : props_section) {
         const std::string& name = keyword.name();
         if (Fieldprops::keywords::PROPS::satfunc.count(name) == 1) {
@@ -798,6 +798,7 @@ private:
                             const Box& box);
 
     void init_satfunc(const std::string& keyword, Fieldprops::FieldData<double>& satfunc);
+    void init_satfunc(const PROPSSection& props_section);
     void init_porv(Fieldprops::FieldData<double>& porv);
     void init_tempi(Fieldprops::FieldData<double>& tempi);
 
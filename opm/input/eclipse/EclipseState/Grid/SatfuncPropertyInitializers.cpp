@@ -40,9 +40,12 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -1427,29 +1430,24 @@ namespace {
         }
     }
 
-    double selectValue(const Opm::TableContainer& depthTables,
-                       int tableIdx,
-                       const std::string& columnName,
-                       double cellDepth,
-                       double fallbackValue,
-                       bool useOneMinusTableValue)
+    /// Per-region saturation function endpoint and the column of the
+    /// ENPTVD or IMPTVD table which may override it as a function of depth.
+    struct RegionEndpoints
     {
-        if( tableIdx < 0 ) return fallbackValue;
+        /// Column name in ENPTVD/IMPTVD.
+        std::string depthColumn{};
 
-        const auto& table = depthTables.getTable( tableIdx );
+        /// Endpoint value for each saturation region.
+        std::vector<double> values{};
 
-        if( tableIdx >= int( depthTables.size() ) )
-            throw std::invalid_argument("Not enough tables!");
+        /// Whether or not to use one minus the depth table value.
+        bool useOneMinusTableValue{false};
 
-        // evaluate the table at the cell depth
-        const double value = table.evaluate( columnName, cellDepth );
-
-        // a column can be fully defaulted. In this case, eval() returns a NaN
-        // and we have to use the data from saturation tables
-        if( !std::isfinite( value ) ) return fallbackValue;
-        if( useOneMinusTableValue ) return 1 - value;
-        return value;
-    }
+        /// Whether or not the endpoint is defined in terms of the
+        /// imbibition regions (IMBNUM, IMPTVD) rather than the drainage
+        /// regions (SATNUM, ENPTVD).
+        bool imbibition{false};
+    };
 
     void checkSatRegions(const std::size_t  cellIdx,
                          const int          satfunc,
@@ -1466,504 +1464,389 @@ namespace {
         }
     }
 
-    std::vector<double>
-    satnumApply(size_t size,
-                const std::string& columnName,
-                const std::vector< double >& fallbackValues,
-                const Opm::TableManager& tableManager,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>& satnum_data,
-                const std::vector<int>& endnum_data,
-                bool useOneMinusTableValue)
-    {
-        std::vector< double > values( size, 0 );
-
-        // Actually assign the defaults. If the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useEnptvd = tableManager.useEnptvd();
-        const auto& enptvdTables = tableManager.getEnptvdTables();
-        for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int satTableIdx = satnum_data[cellIdx] - 1;
-            int endNum = endnum_data[cellIdx] - 1;
-
-            // Active cell better have {SAT,END}NUM > 0.
-            checkSatRegions(cellIdx, satTableIdx, endNum, "SATNUM");
-
-            values[cellIdx] = selectValue(enptvdTables,
-                                          (useEnptvd && endNum >= 0) ? endNum : -1,
-                                          columnName,
-                                          cell_depth[cellIdx],
-                                          fallbackValues[ satTableIdx ],
-                                          useOneMinusTableValue);
+    void checkSatRegions(const std::vector<int>& satnum,
+                         const std::vector<int>& endnum,
+                         const std::string&      satregname)
+    {
+        for (std::size_t cellIdx = 0; cellIdx < satnum.size(); ++cellIdx) {
+            checkSatRegions(cellIdx, satnum[cellIdx] - 1,
+                            endnum[cellIdx] - 1, satregname);
         }
+    }
 
-        return values;
+    /// Depth and value columns of an endpoint-versus-depth table for each
+    /// ENDNUM region, or nullptr if the endpoint is not depth dependent.
+    /// Resolved once per region so that the per-cell work is just a table
+    /// lookup.
+    struct DepthColumns
+    {
+        const Opm::TableColumn* depth{nullptr};
+        const Opm::TableColumn* value{nullptr};
+    };
+
+    std::vector<DepthColumns>
+    depthColumns(const Opm::TableContainer& depthTables,
+                 const bool                 useDepthTables,
+                 const std::string&         columnName,
+                 const std::vector<int>&    endnum)
+    {
+        if (! useDepthTables || endnum.empty()) {
+            return {};
+        }
+
+        const auto numEndRegions = static_cast<std::size_t>
+            (*std::max_element(endnum.begin(), endnum.end()));
+
+        auto columns = std::vector<DepthColumns>(numEndRegions);
+        auto isUsed = std::vector<bool>(numEndRegions, false);
+        for (const auto& endNum : endnum) {
+            isUsed[endNum - 1] = true;
+        }
+
+        for (std::size_t tableIdx = 0; tableIdx < numEndRegions; ++tableIdx) {
+            if (! isUsed[tableIdx]) {
+                continue;
+            }
+
+            const auto& table = depthTables.getTable(tableIdx);
+
+            if (tableIdx >= depthTables.size())
+                throw std::invalid_argument("Not enough tables!");
+
+            columns[tableIdx].depth = &table.getColumn(0);
+            columns[tableIdx].value = &table.getColumn(columnName);
+        }
+
+        return columns;
     }
 
-    std::vector<double>
-    imbnumApply(size_t size,
-                const std::string& columnName,
-                const std::vector< double >& fallBackValues,
-                const Opm::TableManager& tableManager,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>& imbnum_data,
-                const std::vector<int>& endnum_data,
-                bool useOneMinusTableValue )
-    {
-        std::vector< double > values( size, 0 );
-
-        // Actually assign the defaults. if the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useImptvd = tableManager.useImptvd();
-        const Opm::TableContainer& imptvdTables = tableManager.getImptvdTables();
-        for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int imbTableIdx = imbnum_data[ cellIdx ] - 1;
-            int endNum = endnum_data[ cellIdx ] - 1;
-
-            // Active cell better have {IMB,END}NUM > 0.
-            checkSatRegions(cellIdx, imbTableIdx, endNum, "IMBNUM");
-
-            values[cellIdx] = selectValue(imptvdTables,
-                                          (useImptvd && endNum >= 0) ? endNum : -1,
-                                          columnName,
-                                          cell_depth[cellIdx],
-                                          fallBackValues[imbTableIdx],
-                                          useOneMinusTableValue);
+    double selectValue(const std::vector<DepthColumns>& depthCols,
+                       const int                        endNum,
+                       const double                     cellDepth,
+                       const double                     fallbackValue,
+                       const bool                       useOneMinusTableValue)
+    {
+        if (depthCols.empty()) return fallbackValue;
+
+        const auto& cols = depthCols[endNum];
+
+        // evaluate the table at the cell depth
+        const double value = cols.value->eval(cols.depth->lookup(cellDepth));
+
+        // a column can be fully defaulted. In this case, eval() returns a NaN
+        // and we have to use the data from saturation tables
+        if( !std::isfinite( value ) ) return fallbackValue;
+        if( useOneMinusTableValue ) return 1 - value;
+        return value;
+    }
+
+    /// Fill per-cell arrays for a set of endpoints in a single pass over
+    /// the cells.  The region arrays are validated up front so that the
+    /// cell loop itself cannot throw and may run in parallel.
+    std::vector<std::vector<double>>
+    regionApply(const std::vector<RegionEndpoints>& endpoints,
+                const Opm::TableManager&            tableManager,
+                const std::vector<double>&          cell_depth,
+                const std::vector<int>&             satnum,
+                const std::vector<int>&             imbnum,
+                const std::vector<int>&             endnum)
+    {
+        const auto numCells = cell_depth.size();
+        const auto numEp = endpoints.size();
+
+        if (std::any_of(endpoints.begin(), endpoints.end(),
+                        [](const auto& ep) { return ! ep.imbibition; }))
+        {
+            checkSatRegions(satnum, endnum, "SATNUM");
+        }
+
+        if (std::any_of(endpoints.begin(), endpoints.end(),
+                        [](const auto& ep) { return ep.imbibition; }))
+        {
+            checkSatRegions(imbnum, endnum, "IMBNUM");
+        }
+
+        auto depthCols = std::vector<std::vector<DepthColumns>>{};
+        auto regions = std::vector<const std::vector<int>*>{};
+        for (const auto& ep : endpoints) {
+            regions.push_back(ep.imbibition ? &imbnum : &satnum);
+            depthCols.push_back(ep.imbibition
+                                ? depthColumns(tableManager.getImptvdTables(),
+                                               tableManager.useImptvd(),
+                                               ep.depthColumn, endnum)
+                                : depthColumns(tableManager.getEnptvdTables(),
+                                               tableManager.useEnptvd(),
+                                               ep.depthColumn, endnum));
+        }
+
+        auto values = std::vector<std::vector<double>>
+            (numEp, std::vector<double>(numCells, 0.0));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            const int endNum = endnum[cellIdx] - 1;
+
+            for (std::size_t epIdx = 0; epIdx < numEp; ++epIdx) {
+                const int tableIdx = (*regions[epIdx])[cellIdx] - 1;
+
+                values[epIdx][cellIdx] =
+                    selectValue(depthCols[epIdx], endNum, cell_depth[cellIdx],
+                                endpoints[epIdx].values[tableIdx],
+                                endpoints[epIdx].useOneMinusTableValue);
+            }
         }
 
         return values;
     }
 
-    std::vector<double>
-    SGLEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         /* phases */,
-                const RawTableEndPoints&   ep,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    endnum)
+    RegionEndpoints
+    SGLEndpoint(const RawTableEndPoints& ep)
     {
-        return satnumApply(cell_depth.size(), "SGCO", ep.connate.gas,
-                           tableManager, cell_depth, satnum, endnum, false);
+        return { "SGCO", ep.connate.gas, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    ISGLEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         /* phases */,
-                 const RawTableEndPoints&   ep,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    ISGLEndpoint(const RawTableEndPoints& ep)
     {
-        return imbnumApply(cell_depth.size(), "SGCO", ep.connate.gas,
-                           tableManager, cell_depth, imbnum, endnum, false);
+        return { "SGCO", ep.connate.gas, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    SGUEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         /* phases */,
-                const RawTableEndPoints&   ep,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    endnum)
+    RegionEndpoints
+    SGUEndpoint(const RawTableEndPoints& ep)
     {
-        return satnumApply(cell_depth.size(), "SGMAX", ep.maximum.gas,
-                           tableManager, cell_depth, satnum, endnum, false);
+        return { "SGMAX", ep.maximum.gas, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    ISGUEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         /* phases */,
-                 const RawTableEndPoints&   ep,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    ISGUEndpoint(const RawTableEndPoints& ep)
     {
-        return imbnumApply(cell_depth.size(), "SGMAX", ep.maximum.gas,
-                           tableManager, cell_depth, imbnum, endnum, false);
+        return { "SGMAX", ep.maximum.gas, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    SWLEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         /* phases */,
-                const RawTableEndPoints&   ep,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    endnum)
+    RegionEndpoints
+    SWLEndpoint(const RawTableEndPoints& ep)
     {
-        return satnumApply(cell_depth.size(), "SWCO", ep.connate.water,
-                           tableManager, cell_depth, satnum, endnum, false);
+        return { "SWCO", ep.connate.water, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    ISWLEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         /* phases */,
-                 const RawTableEndPoints&   ep,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    ISWLEndpoint(const RawTableEndPoints& ep)
     {
-        return imbnumApply(cell_depth.size(), "SWCO", ep.connate.water,
-                           tableManager, cell_depth, imbnum, endnum, false);
+        return { "SWCO", ep.connate.water, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    SWUEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         /* phases */,
-                const RawTableEndPoints&   ep,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    endnum)
+    RegionEndpoints
+    SWUEndpoint(const RawTableEndPoints& ep)
     {
-        return satnumApply(cell_depth.size(), "SWMAX", ep.maximum.water,
-                           tableManager, cell_depth, satnum, endnum, true);
+        return { "SWMAX", ep.maximum.water, true, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    ISWUEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         /* phases */,
-                 const RawTableEndPoints&   ep,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    ISWUEndpoint(const RawTableEndPoints& ep)
     {
-        return imbnumApply(cell_depth.size(), "SWMAX", ep.maximum.water,
-                           tableManager, cell_depth, imbnum, endnum, true);
+        return { "SWMAX", ep.maximum.water, true, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    SGCREndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         /* phases */,
-                 const RawTableEndPoints&   ep,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    satnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    SGCREndpoint(const RawTableEndPoints& ep)
     {
-        return satnumApply(cell_depth.size(), "SGCRIT", ep.critical.gas,
-                           tableManager, cell_depth, satnum, endnum, false);
+        return { "SGCRIT", ep.critical.gas, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    ISGCREndpoint(const Opm::TableManager&   tableManager,
-                  const Opm::Phases&         /* phases */,
-                  const RawTableEndPoints&   ep,
-                  const std::vector<double>& cell_depth,
-                  const std::vector<int>&    imbnum,
-                  const std::vector<int>&    endnum)
+    RegionEndpoints
+    ISGCREndpoint(const RawTableEndPoints& ep)
     {
-        return imbnumApply(cell_depth.size(), "SGCRIT", ep.critical.gas,
-                           tableManager, cell_depth, imbnum, endnum, false);
+        return { "SGCRIT", ep.critical.gas, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    SOWCREndpoint(const Opm::TableManager&   tableManager,
-                  const Opm::Phases&         /* phases */,
-                  const RawTableEndPoints&   ep,
-                  const std::vector<double>& cell_depth,
-                  const std::vector<int>&    satnum,
-                  const std::vector<int>&    endnum)
+    RegionEndpoints
+    SOWCREndpoint(const RawTableEndPoints& ep)
     {
-        return satnumApply(cell_depth.size(), "SOWCRIT", ep.critical.oil_in_water,
-                           tableManager, cell_depth, satnum, endnum, false);
+        return { "SOWCRIT", ep.critical.oil_in_water, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    ISOWCREndpoint(const Opm::TableManager&   tableManager,
-                   const Opm::Phases&         /* phases */,
-                   const RawTableEndPoints&   ep,
-                   const std::vector<double>& cell_depth,
-                   const std::vector<int>&    imbnum,
-                   const std::vector<int>&    endnum)
+    RegionEndpoints
+    ISOWCREndpoint(const RawTableEndPoints& ep)
     {
-        return imbnumApply(cell_depth.size(), "SOWCRIT", ep.critical.oil_in_water,
-                           tableManager, cell_depth, imbnum, endnum, false);
+        return { "SOWCRIT", ep.critical.oil_in_water, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    SOGCREndpoint(const Opm::TableManager&   tableManager,
-                  const Opm::Phases&         /* phases */,
-                  const RawTableEndPoints&   ep,
-                  const std::vector<double>& cell_depth,
-                  const std::vector<int>&    satnum,
-                  const std::vector<int>&    endnum)
+    RegionEndpoints
+    SOGCREndpoint(const RawTableEndPoints& ep)
     {
-        return satnumApply(cell_depth.size(), "SOGCRIT", ep.critical.oil_in_gas,
-                           tableManager, cell_depth, satnum, endnum, false);
+        return { "SOGCRIT", ep.critical.oil_in_gas, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    ISOGCREndpoint(const Opm::TableManager&   tableManager,
-                   const Opm::Phases&         /* phases */,
-                   const RawTableEndPoints&   ep,
-                   const std::vector<double>& cell_depth,
-                   const std::vector<int>&    imbnum,
-                   const std::vector<int>&    endnum)
+    RegionEndpoints
+    ISOGCREndpoint(const RawTableEndPoints& ep)
     {
-        return imbnumApply(cell_depth.size(), "SOGCRIT", ep.critical.oil_in_gas,
-                           tableManager, cell_depth, imbnum, endnum, false);
+        return { "SOGCRIT", ep.critical.oil_in_gas, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    SWCREndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         /* phases */,
-                 const RawTableEndPoints&   ep,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    satnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    SWCREndpoint(const RawTableEndPoints& ep)
     {
-        return satnumApply(cell_depth.size(), "SWCRIT", ep.critical.water,
-                           tableManager, cell_depth, satnum, endnum, false);
+        return { "SWCRIT", ep.critical.water, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    ISWCREndpoint(const Opm::TableManager&   tableManager,
-                  const Opm::Phases&         /* phases */,
-                  const RawTableEndPoints&   ep,
-                  const std::vector<double>& cell_depth,
-                  const std::vector<int>&    imbnum,
-                  const std::vector<int>&    endnum)
+    RegionEndpoints
+    ISWCREndpoint(const RawTableEndPoints& ep)
     {
-        return imbnumApply(cell_depth.size(), "SWCRIT", ep.critical.water,
-                           tableManager, cell_depth, imbnum, endnum, false);
+        return { "SWCRIT", ep.critical.water, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    PCWEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         phases,
-                const RawTableEndPoints&   /* ep */,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    endnum)
+    RegionEndpoints
+    PCWEndpoint(const Opm::TableManager& tableManager,
+                const Opm::Phases&       phases)
     {
         const auto max_pcow = findMaxPcow(tableManager, phases);
-        return satnumApply(cell_depth.size(), "PCW", max_pcow, tableManager,
-                           cell_depth, satnum, endnum, false);
+        return { "PCW", max_pcow, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    IPCWEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         phases,
-                 const RawTableEndPoints&   /* ep */,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    IPCWEndpoint(const Opm::TableManager& tableManager,
+                 const Opm::Phases&       phases)
     {
         const auto max_pcow = findMaxPcow(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IPCW", max_pcow, tableManager,
-                           cell_depth, imbnum, endnum, false);
+        return { "IPCW", max_pcow, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    PCGEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         phases,
-                const RawTableEndPoints&   /* ep */,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    imbnum)
+    RegionEndpoints
+    PCGEndpoint(const Opm::TableManager& tableManager,
+                const Opm::Phases&       phases)
     {
         const auto max_pcog = findMaxPcog(tableManager, phases);
-        return satnumApply(cell_depth.size(), "PCG", max_pcog, tableManager,
-                           cell_depth, satnum, imbnum, false );
+        return { "PCG", max_pcog, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    IPCGEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         phases,
-                 const RawTableEndPoints&   /* ep */,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    IPCGEndpoint(const Opm::TableManager& tableManager,
+                 const Opm::Phases&       phases)
     {
         const auto max_pcog = findMaxPcog(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IPCG", max_pcog, tableManager,
-                           cell_depth, imbnum, endnum, false);
+        return { "IPCG", max_pcog, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    KRWEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         phases,
-                const RawTableEndPoints&   /* ep */,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    endnum)
+    RegionEndpoints
+    KRWEndpoint(const Opm::TableManager& tableManager,
+                const Opm::Phases&       phases)
     {
         const auto max_krw = findMaxKrw(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRW", max_krw, tableManager,
-                           cell_depth, satnum, endnum, false);
+        return { "KRW", max_krw, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    IKRWEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         phases,
-                 const RawTableEndPoints&   /* ep */,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    IKRWEndpoint(const Opm::TableManager& tableManager,
+                 const Opm::Phases&       phases)
     {
         const auto max_krw = findMaxKrw(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRW", max_krw, tableManager,
-                           cell_depth, imbnum, endnum, false );
+        return { "IKRW", max_krw, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
+    RegionEndpoints
     KRWREndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
-                 const RawTableEndPoints&   ep,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    satnum,
-                 const std::vector<int>&    endnum)
+                 const RawTableEndPoints&   ep)
     {
         const auto krwr = findKrwr(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRWR", krwr, tableManager,
-                           cell_depth, satnum, endnum, false);
+        return { "KRWR", krwr, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
+    RegionEndpoints
     IKRWREndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         phases,
-                  const RawTableEndPoints&   ep,
-                  const std::vector<double>& cell_depth,
-                  const std::vector<int>&    imbnum,
-                  const std::vector<int>&    endnum)
+                  const RawTableEndPoints&   ep)
     {
         const auto krwr = findKrwr(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRWR", krwr, tableManager,
-                           cell_depth, imbnum, endnum, false);
+        return { "IKRWR", krwr, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    KROEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         phases,
-                const RawTableEndPoints&   /* ep */,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    endnum)
+    RegionEndpoints
+    KROEndpoint(const Opm::TableManager& tableManager,
+                const Opm::Phases&       phases)
     {
         const auto max_kro = findMaxKro(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRO", max_kro, tableManager,
-                           cell_depth, satnum, endnum, false);
+        return { "KRO", max_kro, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    IKROEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         phases,
-                 const RawTableEndPoints&   /* ep */,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    IKROEndpoint(const Opm::TableManager& tableManager,
+                 const Opm::Phases&       phases)
     {
         const auto max_kro = findMaxKro(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRO", max_kro, tableManager,
-                           cell_depth, imbnum, endnum, false);
+        return { "IKRO", max_kro, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
+    RegionEndpoints
     KRORWEndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         phases,
-                  const RawTableEndPoints&   ep,
-                  const std::vector<double>& cell_depth,
-                  const std::vector<int>&    satnum,
-                  const std::vector<int>&    endnum)
+                  const RawTableEndPoints&   ep)
     {
         const auto krorw = findKrorw(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRORW", krorw, tableManager,
-                           cell_depth, satnum, endnum, false);
+        return { "KRORW", krorw, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
+    RegionEndpoints
     IKRORWEndpoint(const Opm::TableManager&   tableManager,
                    const Opm::Phases&         phases,
-                   const RawTableEndPoints&   ep,
-                   const std::vector<double>& cell_depth,
-                   const std::vector<int>&    imbnum,
-                   const std::vector<int>&    endnum)
+                   const RawTableEndPoints&   ep)
     {
         const auto krorw = findKrorw(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRORW", krorw, tableManager,
-                           cell_depth, imbnum, endnum, false);
+        return { "IKRORW", krorw, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
+    RegionEndpoints
     KRORGEndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         phases,
-                  const RawTableEndPoints&   ep,
-                  const std::vector<double>& cell_depth,
-                  const std::vector<int>&    satnum,
-                  const std::vector<int>&    endnum)
+                  const RawTableEndPoints&   ep)
     {
         const auto krorg = findKrorg(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRORG", krorg, tableManager,
-                           cell_depth, satnum, endnum, false);
+        return { "KRORG", krorg, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
+    RegionEndpoints
     IKRORGEndpoint(const Opm::TableManager&   tableManager,
                    const Opm::Phases&         phases,
-                   const RawTableEndPoints&   ep,
-                   const std::vector<double>& cell_depth,
-                   const std::vector<int>&    imbnum,
-                   const std::vector<int>&    endnum)
+                   const RawTableEndPoints&   ep)
     {
         const auto krorg = findKrorg(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRORG", krorg, tableManager,
-                           cell_depth, imbnum, endnum, false);
+        return { "IKRORG", krorg, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
-    KRGEndpoint(const Opm::TableManager&   tableManager,
-                const Opm::Phases&         phases,
-                const RawTableEndPoints&   /* ep */,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>&    satnum,
-                const std::vector<int>&    endnum)
+    RegionEndpoints
+    KRGEndpoint(const Opm::TableManager& tableManager,
+                const Opm::Phases&       phases)
     {
         const auto max_krg = findMaxKrg(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRG", max_krg, tableManager,
-                           cell_depth, satnum, endnum, false);
+        return { "KRG", max_krg, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
-    IKRGEndpoint(const Opm::TableManager&   tableManager,
-                 const Opm::Phases&         phases,
-                 const RawTableEndPoints&   /* ep */,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    imbnum,
-                 const std::vector<int>&    endnum)
+    RegionEndpoints
+    IKRGEndpoint(const Opm::TableManager& tableManager,
+                 const Opm::Phases&       phases)
     {
         const auto max_krg = findMaxKrg(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRG", max_krg, tableManager,
-                           cell_depth, imbnum, endnum, false);
+        return { "IKRG", max_krg, false, /* imbibition = */ true };
     }
 
-    std::vector<double>
+    RegionEndpoints
     KRGREndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
-                 const RawTableEndPoints&   ep,
-                 const std::vector<double>& cell_depth,
-                 const std::vector<int>&    satnum,
-                 const std::vector<int>&    endnum)
+                 const RawTableEndPoints&   ep)
     {
         const auto krgr = findKrgr(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRGR", krgr, tableManager,
-                           cell_depth, satnum, endnum, false);
+        return { "KRGR", krgr, false, /* imbibition = */ false };
     }
 
-    std::vector<double>
+    RegionEndpoints
     IKRGREndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         phases,
-                  const RawTableEndPoints&   ep,
-                  const std::vector<double>& cell_depth,
-                  const std::vector<int>&    imbnum,
-                  const std::vector<int>&    endnum)
+                  const RawTableEndPoints&   ep)
     {
         const auto krgr = findKrgr(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRGR", krgr, tableManager,
-                           cell_depth, imbnum, endnum, false);
+        return { "IKRGR", krgr, false, /* imbibition = */ true };
     }
 } // namespace Anonymous
 
@@ -2012,27 +1895,50 @@ Opm::satfunc::getRawFunctionValues(const Opm::TableManager& tm,
     return fval;
 }
 
-std::vector<double>
-Opm::satfunc::init(const std::string&         keyword,
-                   const TableManager&        tables,
-                   const Phases&              phases,
-                   const RawTableEndPoints&   ep,
-                   const std::vector<double>& cell_depth,
-                   const std::vector<int>&    num,
-                   const std::vector<int>&    endnum)
+namespace {
+
+using EndpointFunc = std::function<RegionEndpoints(const Opm::TableManager&,
+                                                   const Opm::Phases&,
+                                                   const RawTableEndPoints&)>;
+
+// Saturation endpoints depend only on the raw table endpoints, maximum
+// relative permeabilities and capillary pressures only on the tables, and
+// residual relative permeabilities on both.
+
+EndpointFunc wrap(RegionEndpoints (*func)(const RawTableEndPoints&))
+{
+    return [func](const auto&, const auto&, const auto& ep) { return func(ep); };
+}
+
+EndpointFunc wrap(RegionEndpoints (*func)(const Opm::TableManager&, const Opm::Phases&))
 {
-    using func_type = decltype(&IKRGEndpoint);
+    return [func](const auto& tables, const auto& phases, const auto&)
+    { return func(tables, phases); };
+}
 
+EndpointFunc wrap(RegionEndpoints (*func)(const Opm::TableManager&,
+                                          const Opm::Phases&,
+                                          const RawTableEndPoints&))
+{
+    return func;
+}
+
+RegionEndpoints
+regionEndpoints(const std::string&       keyword,
+                const Opm::TableManager& tables,
+                const Opm::Phases&       phases,
+                const RawTableEndPoints& ep)
+{
 #define dirfunc(base, func) \
-    {base, func}, \
-    {base "X", func}, {base "X-", func},  \
-    {base "Y", func}, {base "Y-", func},  \
-    {base "Z", func}, {base "Z-", func}
+    {base, wrap(func)}, \
+    {base "X", wrap(func)}, {base "X-", wrap(func)},  \
+    {base "Y", wrap(func)}, {base "Y-", wrap(func)},  \
+    {base "Z", wrap(func)}, {base "Z-", wrap(func)}
 
-    static const std::map<std::string, func_type> func_table = {
+    static const std::map<std::string, EndpointFunc> func_table = {
         // Drainage                      Imbibition
-        {"SGLPC", SGLEndpoint},          {"ISGLPC", ISGLEndpoint},
-        {"SWLPC", SWLEndpoint},          {"ISWLPC", ISWLEndpoint},
+        {"SGLPC", wrap(SGLEndpoint)},    {"ISGLPC", wrap(ISGLEndpoint)},
+        {"SWLPC", wrap(SWLEndpoint)},    {"ISWLPC", wrap(ISWLEndpoint)},
 
         dirfunc("SGL",   SGLEndpoint),   dirfunc("ISGL",   ISGLEndpoint),
         dirfunc("SGU",   SGUEndpoint),   dirfunc("ISGU",   ISGUEndpoint),
@@ -2044,8 +1950,8 @@ Opm::satfunc::init(const std::string&         keyword,
         dirfunc("SOWCR", SOWCREndpoint), dirfunc("ISOWCR", ISOWCREndpoint),
         dirfunc("SWCR",  SWCREndpoint),  dirfunc("ISWCR",  ISWCREndpoint),
 
-        {"PCG", PCGEndpoint},            {"IPCG", IPCGEndpoint},
-        {"PCW", PCWEndpoint},            {"IPCW", IPCWEndpoint},
+        {"PCG", wrap(PCGEndpoint)},      {"IPCG", wrap(IPCGEndpoint)},
+        {"PCW", wrap(PCWEndpoint)},      {"IPCW", wrap(IPCWEndpoint)},
 
         dirfunc("KRG",   KRGEndpoint),   dirfunc("IKRG",   IKRGEndpoint),
         dirfunc("KRGR",  KRGREndpoint),  dirfunc("IKRGR",  IKRGREndpoint),
@@ -2065,5 +1971,42 @@ Opm::satfunc::init(const std::string&         keyword,
             + keyword + '\''
         };
 
-    return func->second(tables, phases, ep, cell_depth, num, endnum);
+    return func->second(tables, phases, ep);
+}
+
+} // Anonymous namespace
+
+std::vector<double>
+Opm::satfunc::init(const std::string&         keyword,
+                   const TableManager&        tables,
+                   const Phases&              phases,
+                   const RawTableEndPoints&   ep,
+                   const std::vector<double>& cell_depth,
+                   const std::vector<int>&    num,
+                   const std::vector<int>&    endnum)
+{
+    auto values = regionApply({ regionEndpoints(keyword, tables, phases, ep) },
+                              tables, cell_depth, num, num, endnum);
+
+    return std::move(values.front());
+}
+
+std::vector<std::vector<double>>
+Opm::satfunc::init(const std::vector<std::string>& keywords,
+                   const TableManager&             tables,
+                   const Phases&                   phases,
+                   const RawTableEndPoints&        ep,
+                   const std::vector<double>&      cell_depth,
+                   const std::vector<int>&         satnum,
+                   const std::vector<int>&         imbnum,
+                   const std::vector<int>&         endnum)
+{
+    auto endpoints = std::vector<RegionEndpoints>{};
+    endpoints.reserve(keywords.size());
+
+    for (const auto& keyword : keywords) {
+        endpoints.push_back(regionEndpoints(keyword, tables, phases, ep));
+    }
+
+    return regionApply(endpoints, tables, cell_depth, satnum, imbnum, endnum);
 }
@@ -169,6 +169,24 @@ namespace Opm { namespace satfunc {
                              const std::vector<int>& num,
                              const std::vector<int>& endnum);
 
+    /// Initialise several saturation function endpoint arrays in a single
+    /// pass over the cells.
+    ///
+    /// Equivalent to calling init() once for each keyword, with drainage
+    /// keywords using \p satnum and imbibition keywords (I*) using \p
+    /// imbnum, but the per-region endpoints and depth table columns are
+    /// resolved once up front.  Returns one array for each keyword, in the
+    /// order of \p keywords.
+    std::vector<std::vector<double>>
+    init(const std::vector<std::string>& keywords,
+         const TableManager& tables,
+         const Phases& phases,
+         const RawTableEndPoints& ep,
+         const std::vector<double>& cell_depth,
+         const std::vector<int>& satnum,
+         const std::vector<int>& imbnum,
+         const std::vector<int>& endnum);
+
 }} // namespace Opm::satfunc
 
 #endif // ECLIPSE_SATFUNCPROPERTY_INITIALIZERS_HPP
@@ -21,13 +21,43 @@
 
 #include <opm/input/eclipse/EclipseState/Tables/SimpleTable.hpp>
 
+#include <functional>
+#include <set>
 #include <string>
+#include <typeinfo>
 #include <utility>
 
 #include <stddef.h>
 
 #include <fmt/format.h>
 
+namespace {
+
+    void hashCombine(std::size_t& seed, const std::size_t value)
+    {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+
+    // Hash of the dynamic type, the dimensions and the column values of
+    // 'table'.  Tables which compare equal have the same hash.
+    std::size_t contentHash(const Opm::SimpleTable& table)
+    {
+        auto seed = typeid(table).hash_code();
+
+        hashCombine(seed, table.numRows());
+        hashCombine(seed, table.numColumns());
+
+        for (std::size_t col = 0; col < table.numColumns(); ++col) {
+            for (const auto& value : table.getColumn(col)) {
+                hashCombine(seed, std::hash<double>{}(value));
+            }
+        }
+
+        return seed;
+    }
+
+} // Anonymous namespace
+
 namespace Opm {
 
     TableContainer::TableContainer()
@@ -109,6 +139,34 @@ namespace Opm {
         m_tables[tableNumber] = std::move(table);
     }
 
+    void TableContainer::addDeduplicatedTable(size_t tableNumber, std::shared_ptr<SimpleTable> table)
+    {
+        const auto hash = contentHash(*table);
+
+        auto [begin, end] = this->m_tablesByHash.equal_range(hash);
+        for (auto candidate = begin; candidate != end; ++candidate) {
+            const auto& existing = *candidate->second;
+
+            if ((typeid(existing) == typeid(*table)) && (existing == *table)) {
+                this->addTable(tableNumber, candidate->second);
+                return;
+            }
+        }
+
+        this->addTable(tableNumber, table);
+        this->m_tablesByHash.emplace(hash, std::move(table));
+    }
+
+    size_t TableContainer::numUniqueTables() const
+    {
+        std::set<const SimpleTable*> unique;
+        for (const auto& entry : this->m_tables) {
+            unique.insert(entry.second.get());
+        }
+
+        return unique.size();
+    }
+
     bool TableContainer::operator==(const TableContainer& data) const
     {
         if (this->max() != data.max()) {
@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 namespace Opm {
 
@@ -77,6 +78,22 @@ namespace Opm {
 
         void addTable(size_t tableNumber, std::shared_ptr<SimpleTable> table);
 
+        // Like addTable(), but if the container already holds a table of
+        // the same dynamic type which compares equal to \p table, then
+        // that table is shared by both table numbers instead.  Decks with
+        // many identical saturation or PVT regions thereby store--and
+        // serialize--each distinct table only once.
+        //
+        // Only use this for table types whose entire state is compared by
+        // SimpleTable::operator==(), and never modify a table after it has
+        // been added.  Only tables added by this function are candidates
+        // for sharing.
+        void addDeduplicatedTable(size_t tableNumber, std::shared_ptr<SimpleTable> table);
+
+        // Number of distinct table objects in the container.  Less than
+        // size() if some table numbers share a table.
+        size_t numUniqueTables() const;
+
         // Observe that the hasTable() method does not invoke the "If table
         // N is not implemented use table N - 1 behavior.
         bool hasTable(size_t tableNumber) const;
@@ -113,6 +130,11 @@ namespace Opm {
     private:
         size_t m_maxTables;
         TableMap m_tables;
+
+        // Tables added by addDeduplicatedTable(), keyed by a hash of their
+        // type and contents.  Candidates are compared in full only when
+        // the hashes match.  Not serialized, and not part of operator==().
+        std::unordered_multimap<std::size_t, std::shared_ptr<SimpleTable>> m_tablesByHash;
     };
 
 }
@@ -1575,7 +1575,7 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
             if (dataItem.data_size() > 0) {
                 try {
                     std::shared_ptr<TableType> table = std::make_shared<TableType>( dataItem, useJFunc(), tableIdx );
-                    container.addTable( tableIdx , table );
+                    container.addDeduplicatedTable( tableIdx , table );
                     lastComplete = tableIdx;
                 } catch (const std::runtime_error& err) {
                     throw OpmInputError(err, tableKeyword.location());
@@ -1585,7 +1585,7 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
             }
             else if (tableIdx > static_cast<size_t>(0)) {
                 const auto& item = tableKeyword.getRecord(lastComplete).getItem("DATA");
-                container.addTable(tableIdx, std::make_shared<TableType>(item, useJFunc(), tableIdx));
+                container.addDeduplicatedTable(tableIdx, std::make_shared<TableType>(item, useJFunc(), tableIdx));
             }
             else {
                 throw OpmInputError {
@@ -1620,7 +1620,7 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
 
             if (dataItem.data_size() > 0) {
                 try {
-                    container.addTable(tableIdx, std::make_shared<TableType>(dataItem, tableIdx));
+                    container.addDeduplicatedTable(tableIdx, std::make_shared<TableType>(dataItem, tableIdx));
                     lastComplete = tableIdx;
                 }
                 catch (const std::runtime_error& err) {
@@ -1632,7 +1632,7 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
             }
             else if (tableIdx > static_cast<size_t>(0)) {
                 const auto& item = tableKeyword.getRecord(lastComplete).getItem("DATA");
-                container.addTable(tableIdx, std::make_shared<TableType>(item, tableIdx));
+                container.addDeduplicatedTable(tableIdx, std::make_shared<TableType>(item, tableIdx));
             }
             else {
                 throw OpmInputError {
@@ -388,7 +388,7 @@ Opm::Action::ASTNode::getWellList(const Context& context) const
     wnames.reserve(wells.size());
 
     std::copy_if(wells.begin(), wells.end(), std::back_inserter(wnames),
-                 [wpatt = normalisePattern(this->arg_list.front())]
+                 [wpatt = this->wellPattern()]
                  (const auto& well) { return shmatch(wpatt, well); });
 
     return wnames;
@@ -400,6 +400,11 @@ bool Opm::Action::ASTNode::argListIsPattern() const
         && (this->arg_list.front().find("*") != std::string::npos);
 }
 
+std::string Opm::Action::ASTNode::wellPattern() const
+{
+    return normalisePattern(this->arg_list.front());
+}
+
 bool Opm::Action::ASTNode::argListIsWellList() const
 {
     const auto& well_arg = this->arg_list.front();
@@ -29,6 +29,7 @@
 #include <vector>
 
 namespace Opm::Action {
+    class ConditionProgram;
     class Context;
 } // namespace Opm::Action
 
@@ -165,6 +166,10 @@ public:
     }
 
 private:
+    /// Compiled form of a condition expression.  Needs read access to
+    /// the function arguments and child nodes.
+    friend class ConditionProgram;
+
     // Note: data member order here is dictated by initialisation list in
     // four-argument constructor.
 
@@ -278,6 +283,10 @@ private:
     /// arg_list.front() \endcode) is the name of a well list or a well list
     /// template (pattern).
     bool argListIsWellList() const;
+
+    /// Well name template in front of the function argument list, without
+    /// any leading escape character.
+    std::string wellPattern() const;
 };
 
 } // namespace Opm::Action
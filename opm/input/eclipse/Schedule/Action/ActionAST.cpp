@@ -24,6 +24,8 @@
 #include <opm/input/eclipse/Schedule/Action/ActionParser.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
 
+#include "ConditionProgram.hpp"
+
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -33,7 +35,9 @@ Opm::Action::AST::AST() = default;
 
 Opm::Action::AST::AST(const std::vector<std::string>& tokens)
     : condition { Parser::parseCondition(tokens) }
-{}
+{
+    this->compileProgram();
+}
 
 Opm::Action::AST::~AST() = default;
 
@@ -42,41 +46,32 @@ Opm::Action::AST::AST(const AST& rhs)
     if (rhs.condition != nullptr) {
         this->condition = std::make_unique<ASTNode>(*rhs.condition);
     }
+
+    if (rhs.program_ != nullptr) {
+        this->program_ = std::make_unique<ConditionProgram>(*rhs.program_);
+    }
 }
 
-Opm::Action::AST::AST(AST&& rhs)
-    : condition { std::move(rhs.condition) }
-{}
+Opm::Action::AST::AST(AST&& rhs) = default;
 
 Opm::Action::AST&
 Opm::Action::AST::operator=(const AST& rhs)
 {
     if (this != &rhs) {
-        if (rhs.condition == nullptr) {
-            this->condition.reset();
-        }
-        else {
-            this->condition = std::make_unique<ASTNode>(*rhs.condition);
-        }
+        *this = AST { rhs };
     }
 
     return *this;
 }
 
 Opm::Action::AST&
-Opm::Action::AST::operator=(AST&& rhs)
-{
-    if (this != &rhs) {
-        this->condition = std::move(rhs.condition);
-    }
-
-    return *this;
-}
+Opm::Action::AST::operator=(AST&& rhs) = default;
 
 Opm::Action::AST Opm::Action::AST::serializationTestObject()
 {
     AST result;
     result.condition = std::make_unique<ASTNode>(ASTNode::serializationTestObject());
+    result.compileProgram();
 
     return result;
 }
@@ -88,6 +83,10 @@ Opm::Action::AST::eval(const Action::Context& context) const
         return Result { false };
     }
 
+    if (this->program_ != nullptr) {
+        return this->program_->eval(context);
+    }
+
     return this->condition->eval(context);
 }
 
@@ -107,3 +106,10 @@ void Opm::Action::AST::required_summary(std::unordered_set<std::string>& require
 
     this->condition->required_summary(required_summary);
 }
+
+void Opm::Action::AST::compileProgram()
+{
+    this->program_ = ((this->condition != nullptr) && ! this->condition->empty())
+        ? ConditionProgram::compile(*this->condition)
+        : nullptr;
+}
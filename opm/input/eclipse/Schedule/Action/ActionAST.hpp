@@ -29,8 +29,9 @@
 
 namespace Opm::Action {
 
-class Context;
 class ASTNode;
+class ConditionProgram;
+class Context;
 
 } // namespace Opm::Action
 
@@ -119,6 +120,10 @@ public:
     void serializeOp(Serializer& serializer)
     {
         serializer(condition);
+
+        if (! serializer.isSerializing()) {
+            this->compileProgram();
+        }
     }
 
     /// Export all summary vectors needed to evaluate the expression tree.
@@ -132,6 +137,14 @@ public:
 private:
     /// Internalised condition object in expression tree form.
     std::unique_ptr<ASTNode> condition{};
+
+    /// Compiled form of the condition.  Created whenever the condition is
+    /// assigned.  Null if there is no condition or if the condition could
+    /// not be compiled, in which case eval() uses the expression tree.
+    std::unique_ptr<ConditionProgram> program_{};
+
+    /// Compile current condition, e.g., after deserialisation.
+    void compileProgram();
 };
 
 } // namespace Opm::Action
@@ -20,15 +20,23 @@
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 
 #include <opm/common/utility/TimeService.hpp>
+#include <opm/common/utility/shmatch.hpp>
 
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -43,6 +51,20 @@ Opm::Action::Context::Context(const SummaryState& summary_state,
                               const WListManager& wlm)
     : summaryState_ { std::cref(summary_state) }
     , wListMgr_     { std::cref(wlm) }
+    , ownCache_     { std::make_unique<Cache>() }
+    , cache_        { std::ref(*ownCache_) }
+{
+    for (const auto& [month, idx] : TimeService::eclipseMonthIndices()) {
+        this->add(month, idx);
+    }
+}
+
+Opm::Action::Context::Context(const SummaryState& summary_state,
+                              const WListManager& wlm,
+                              Cache&              cache)
+    : summaryState_ { std::cref(summary_state) }
+    , wListMgr_     { std::cref(wlm) }
+    , cache_        { std::ref(cache) }
 {
     for (const auto& [month, idx] : TimeService::eclipseMonthIndices()) {
         this->add(month, idx);
@@ -60,6 +82,7 @@ void Opm::Action::Context::add(const std::string& func,
                                const double       value)
 {
     this->values_.insert_or_assign(func, value);
+    this->idValues_.insert_or_assign(this->summaryState_.get().key_id(func), value);
 }
 
 double Opm::Action::Context::get(std::string_view func,
@@ -77,8 +100,100 @@ double Opm::Action::Context::get(const std::string& key) const
         : iter->second;
 }
 
+double Opm::Action::Context::get(const SummaryState::KeyId id) const
+{
+    auto iter = this->idValues_.find(id);
+
+    return (iter == this->idValues_.end())
+        ? this->summaryState_.get().get_value(id)
+        : iter->second;
+}
+
+const std::vector<Opm::SummaryState::KeyId>&
+Opm::Action::Context::key_ids(const std::uint64_t             program,
+                              const std::vector<std::string>& keys) const
+{
+    auto [pos, inserted] = this->cache().keyIds_.try_emplace(program);
+
+    if (inserted) {
+        const auto& st = this->summaryState_.get();
+
+        pos->second.reserve(keys.size());
+        std::transform(keys.begin(), keys.end(),
+                       std::back_inserter(pos->second),
+                       [&st](const std::string& key)
+                       { return st.key_id(key); });
+    }
+
+    return pos->second;
+}
+
 std::vector<std::string>
 Opm::Action::Context::wells(const std::string& key) const
 {
     return this->summaryState_.get().wells(key);
 }
+
+const Opm::Action::Context::WellKeys&
+Opm::Action::Context::template_well_keys(const std::uint64_t program,
+                                         const std::size_t   operand,
+                                         const std::string&  func,
+                                         const std::string&  pattern) const
+{
+    const auto& st = this->summaryState_.get();
+    auto& cache = this->cache();
+
+    if (cache.wellSet_ != st.well_set_version()) {
+        cache.templateWells_.clear();
+        cache.wellSet_ = st.well_set_version();
+    }
+
+    auto [pos, inserted] = cache.templateWells_.try_emplace({ program, operand });
+
+    if (inserted) {
+        for (auto& well : this->wells(func)) {
+            if (shmatch(pattern, well)) {
+                const auto id = st.key_id(combinedKey(func, well));
+                pos->second.emplace_back(std::move(well), id);
+            }
+        }
+    }
+
+    return pos->second;
+}
+
+const Opm::Action::Context::WellKeys&
+Opm::Action::Context::wlist_well_keys(const std::uint64_t program,
+                                      const std::size_t   operand,
+                                      const std::string&  func,
+                                      const std::string&  wlist) const
+{
+    auto wells = this->wListMgr_.get().wells(wlist);
+    auto& entry = this->cache().wlistWells_[{ program, operand }];
+
+    if (entry.wells != wells) {
+        const auto& st = this->summaryState_.get();
+
+        entry.keys.clear();
+        for (const auto& well : wells) {
+            entry.keys.emplace_back(well, st.key_id(combinedKey(func, well)));
+        }
+
+        entry.wells = std::move(wells);
+    }
+
+    return entry.keys;
+}
+
+Opm::Action::Context::Cache& Opm::Action::Context::cache() const
+{
+    auto& cache = this->cache_.get();
+
+    const auto scope = this->summaryState_.get().key_scope();
+    if (cache.keyScope_ != scope) {
+        cache = Cache{};
+        cache.keyScope_ = scope;
+    }
+
+    return cache;
+}
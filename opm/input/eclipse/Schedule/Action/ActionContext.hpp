@@ -20,15 +20,22 @@
 #ifndef ActionContext_HPP
 #define ActionContext_HPP
 
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
 
-class SummaryState;
 class WListManager;
 
 } // namespace Opm
@@ -38,17 +45,83 @@ namespace Opm::Action {
 /// Manager of summary vector values.
 ///
 /// Mainly a small wrapper around a SummaryState object.
+///
+/// A Context is meant to be created for each evaluation of the run's
+/// actions, and refers to a summary state and a set of well lists which do
+/// not change during its lifetime.  Summary vector identifiers and well
+/// name expansions of the conditions evaluated against it are kept in a
+/// Cache object, which may outlive the Context.  The cache is updated by
+/// const member functions, so neither a Context nor its Cache may be
+/// shared between threads.
 class Context
 {
 public:
+    /// Well names and summary vector identifiers, e.g., of "PROD1" and
+    /// "WOPR:PROD1", of a well-level summary function.
+    using WellKeys = std::vector<std::pair<std::string, SummaryState::KeyId>>;
+
+    /// Summary vector identifiers and well name expansions of compiled
+    /// conditions.
+    ///
+    /// Identifiers are looked up again when the summary state's
+    /// key_scope() changes and well name templates are expanded again
+    /// when its well_set_version() changes.  Well list expansions are
+    /// reused for as long as the list has the same members.
+    class Cache
+    {
+    private:
+        friend class Context;
+
+        /// Compiled condition and operand index.
+        using Slot = std::pair<std::uint64_t, std::size_t>;
+
+        /// Well list members and their summary vector identifiers.
+        struct WellList
+        {
+            std::vector<std::string> wells{};
+            WellKeys keys{};
+        };
+
+        /// Key scope of the summary state for which the entries were
+        /// created.
+        std::optional<std::uint64_t> keyScope_{};
+
+        /// Well set stamp for which templateWells_ were expanded.
+        std::uint64_t wellSet_{};
+
+        /// Summary vector identifiers, keyed by compiled condition.
+        std::unordered_map<std::uint64_t, std::vector<SummaryState::KeyId>> keyIds_{};
+
+        /// Expansions of well name templates.
+        std::map<Slot, WellKeys> templateWells_{};
+
+        /// Expansions of well lists.
+        std::map<Slot, WellList> wlistWells_{};
+    };
+
     /// Constructor.
     ///
+    /// Condition evaluation data is retained for the lifetime of this
+    /// object only.
+    ///
     /// \param[in] summary_state Run's current summary vectors.
     ///
     /// \param[in] wlm Run's active well lists (WLIST keyword).
     explicit Context(const SummaryState& summary_state,
                      const WListManager& wlm);
 
+    /// Constructor.
+    ///
+    /// \param[in] summary_state Run's current summary vectors.
+    ///
+    /// \param[in] wlm Run's active well lists (WLIST keyword).
+    ///
+    /// \param[in,out] cache Condition evaluation data, typically that of
+    /// the run's Action::State.  Must outlive this object.
+    Context(const SummaryState& summary_state,
+            const WListManager& wlm,
+            Cache&              cache);
+
     /// Assign function value for named entity.
     ///
     /// \param[in] func Named summary function, e.g., WOPR, GWCT, or WURST.
@@ -86,6 +159,26 @@ public:
     /// \return Current value of summary function for named entity.
     double get(const std::string& key) const;
 
+    /// Retrieve function value by summary vector identifier.
+    ///
+    /// \param[in] id Identifier from key_ids(), template_well_keys(), or
+    /// wlist_well_keys().
+    ///
+    /// \return Same as get() for the key of \p id.
+    double get(SummaryState::KeyId id) const;
+
+    /// Retrieve summary vector identifiers of a compiled condition.
+    ///
+    /// \param[in] program Unique identifier of compiled condition.
+    ///
+    /// \param[in] keys Summary vector keys used by compiled condition,
+    /// e.g., FOPR or WOPR:PROD1.  Must be the same in all calls for the
+    /// same \p program.
+    ///
+    /// \return Identifiers of \p keys, in the same order.
+    const std::vector<SummaryState::KeyId>&
+    key_ids(std::uint64_t program, const std::vector<std::string>& keys) const;
+
     /// Retrieve name of all wells for which specified summary function is
     /// defined.
     ///
@@ -95,6 +188,47 @@ public:
     /// \return All wells for which the named summary function is defined.
     std::vector<std::string> wells(const std::string& func) const;
 
+    /// Retrieve wells matching a well name template for which a
+    /// well-level summary function is defined.
+    ///
+    /// Computed on first request and retained in the cache until the set
+    /// of wells changes.
+    ///
+    /// \param[in] program Unique identifier of compiled condition.
+    ///
+    /// \param[in] operand Index of operand within compiled condition.
+    ///
+    /// \param[in] func Named well-level summary function, e.g., WOPR.
+    ///
+    /// \param[in] pattern Well name template, e.g., 'PROD*'.
+    ///
+    /// \return Matching wells, in the order of wells(), and their summary
+    /// vector identifiers for \p func.
+    const WellKeys& template_well_keys(std::uint64_t      program,
+                                       std::size_t        operand,
+                                       const std::string& func,
+                                       const std::string& pattern) const;
+
+    /// Retrieve members of a well list.
+    ///
+    /// Summary vector identifiers are retained in the cache until the
+    /// members of the well list change.
+    ///
+    /// \param[in] program Unique identifier of compiled condition.
+    ///
+    /// \param[in] operand Index of operand within compiled condition.
+    ///
+    /// \param[in] func Named well-level summary function, e.g., WOPR.
+    ///
+    /// \param[in] wlist Well list name, e.g., '*PRODUCERS'.
+    ///
+    /// \return Members of \p wlist and their summary vector identifiers
+    /// for \p func.
+    const WellKeys& wlist_well_keys(std::uint64_t      program,
+                                    std::size_t        operand,
+                                    const std::string& func,
+                                    const std::string& wlist) const;
+
     /// Get read-only access to run's well lists.
     ///
     /// Convenience method.
@@ -115,6 +249,20 @@ private:
     /// Primary source for get() requests, and only object for which add()
     /// requests are destined.
     std::map<std::string, double> values_{};
+
+    /// Function values of values_, keyed by summary vector identifier.
+    std::unordered_map<SummaryState::KeyId, double> idValues_{};
+
+    /// Condition evaluation data owned by this object.  Null if the
+    /// constructor was given a cache.
+    std::unique_ptr<Cache> ownCache_{};
+
+    /// Condition evaluation data.  Either *ownCache_ or external.
+    std::reference_wrapper<Cache> cache_;
+
+    /// Condition evaluation data, reset if it pertains to a different
+    /// key registry than that of summaryState_.
+    Cache& cache() const;
 };
 
 } // namespace Opm::Action
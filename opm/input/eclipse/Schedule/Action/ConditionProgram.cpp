@@ -0,0 +1,258 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ConditionProgram.hpp"
+
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+namespace {
+
+    bool isComparison(const Opm::Action::TokenType type)
+    {
+        using TT = Opm::Action::TokenType;
+
+        return (type == TT::op_gt)
+            || (type == TT::op_ge)
+            || (type == TT::op_lt)
+            || (type == TT::op_le)
+            || (type == TT::op_eq)
+            || (type == TT::op_ne);
+    }
+
+    std::uint64_t next_program_id()
+    {
+        static std::atomic<std::uint64_t> id{0};
+        return ++id;
+    }
+
+} // Anonymous namespace
+
+std::unique_ptr<Opm::Action::ConditionProgram>
+Opm::Action::ConditionProgram::compile(const ASTNode& condition)
+{
+    auto program = std::make_unique<ConditionProgram>();
+
+    if (! program->compileNode(condition)) {
+        return {};
+    }
+
+    program->id_ = next_program_id();
+
+    return program;
+}
+
+Opm::Action::Result
+Opm::Action::ConditionProgram::eval(const Context& context) const
+{
+    return this->evalNode(0, context, context.key_ids(this->id_, this->keys_));
+}
+
+// ===========================================================================
+// Private member functions
+// ===========================================================================
+
+bool Opm::Action::ConditionProgram::compileNode(const ASTNode& node)
+{
+    if (node.empty()) {
+        // Leaf nodes only appear as comparison operands.
+        return false;
+    }
+
+    const auto self = this->nodes_.size();
+    this->nodes_.emplace_back().type = node.type;
+
+    if ((node.type == TokenType::op_and) ||
+        (node.type == TokenType::op_or))
+    {
+        for (const auto& child : node.children) {
+            if (! this->compileNode(child)) {
+                return false;
+            }
+        }
+    }
+    else {
+        if (! isComparison(node.type) || (node.size() != 2)) {
+            return false;
+        }
+
+        auto lhs = compileOperand(node.children.front());
+        auto rhs = compileOperand(node.children.back());
+        if (! lhs.has_value() || ! rhs.has_value()) {
+            return false;
+        }
+
+        // Numeric month values compare against the nearest month index.
+        // See ASTNode::evalComparison().
+        if ((node.children.front().func_type == FuncType::time_month) &&
+            (rhs->kind == Operand::Kind::Number))
+        {
+            rhs->number = std::round(rhs->number);
+        }
+
+        this->nodes_[self].lhs = std::move(*lhs);
+        this->nodes_[self].rhs = std::move(*rhs);
+    }
+
+    this->nodes_[self].end = this->nodes_.size();
+
+    return true;
+}
+
+std::optional<Opm::Action::ConditionProgram::Operand>
+Opm::Action::ConditionProgram::compileOperand(const ASTNode& leaf)
+{
+    if (! leaf.empty()) {
+        return std::nullopt;
+    }
+
+    auto operand = Operand{};
+
+    if (leaf.type == TokenType::number) {
+        operand.kind = Operand::Kind::Number;
+        operand.number = leaf.number;
+    }
+    else if (leaf.arg_list.empty()) {
+        operand.kind = Operand::Kind::Scalar;
+        operand.key = leaf.func;
+        operand.slot = this->keys_.size();
+
+        this->keys_.push_back(operand.key);
+    }
+    else if (leaf.argListIsPattern()) {
+        if (leaf.func_type != FuncType::well) {
+            return std::nullopt;
+        }
+
+        operand.key = leaf.func;
+        operand.slot = this->numWellSets_++;
+
+        if (leaf.argListIsWellList()) {
+            operand.kind = Operand::Kind::WellList;
+            operand.name = leaf.arg_list.front();
+        }
+        else {
+            operand.kind = Operand::Kind::WellTemplate;
+            operand.name = leaf.wellPattern();
+        }
+    }
+    else {
+        operand.kind = (leaf.func_type == FuncType::well)
+            ? Operand::Kind::Well
+            : Operand::Kind::Scalar;
+
+        operand.key = fmt::format("{}:{}", leaf.func, fmt::join(leaf.arg_list, ":"));
+        operand.name = leaf.arg_list.front();
+        operand.slot = this->keys_.size();
+
+        this->keys_.push_back(operand.key);
+    }
+
+    return operand;
+}
+
+Opm::Action::Result
+Opm::Action::ConditionProgram::evalNode(const std::size_t                       node,
+                                        const Context&                          context,
+                                        const std::vector<SummaryState::KeyId>& ids) const
+{
+    const auto& n = this->nodes_[node];
+
+    if ((n.type == TokenType::op_and) || (n.type == TokenType::op_or)) {
+        const auto is_and = n.type == TokenType::op_and;
+
+        auto result = Result { is_and };
+
+        for (auto child = node + 1; child < n.end; child = this->nodes_[child].end) {
+            if (is_and) {
+                result.makeSetIntersection(this->evalNode(child, context, ids));
+            }
+            else {
+                result.makeSetUnion(this->evalNode(child, context, ids));
+            }
+        }
+
+        return result;
+    }
+
+    // Right hand side first, as in ASTNode::evalComparison().
+    const auto rhs = this->evalOperand(n.rhs, context, ids);
+
+    return this->evalOperand(n.lhs, context, ids).eval_cmp(n.type, rhs);
+}
+
+Opm::Action::Value
+Opm::Action::ConditionProgram::evalOperand(const Operand&                          operand,
+                                           const Context&                          context,
+                                           const std::vector<SummaryState::KeyId>& ids) const
+{
+    switch (operand.kind) {
+    case Operand::Kind::Number:
+        return Value { operand.number };
+
+    case Operand::Kind::Scalar:
+        return Value { context.get(ids[operand.slot]) };
+
+    case Operand::Kind::Well:
+        return Value { operand.name, context.get(ids[operand.slot]) };
+
+    case Operand::Kind::WellTemplate: {
+        auto well_values = Value{};
+
+        const auto& wells = context
+            .template_well_keys(this->id_, operand.slot, operand.key, operand.name);
+
+        for (const auto& [well, id] : wells) {
+            well_values.add_well(well, context.get(id));
+        }
+
+        return well_values;
+    }
+
+    case Operand::Kind::WellList: {
+        auto well_values = Value{};
+
+        const auto& wells = context
+            .wlist_well_keys(this->id_, operand.slot, operand.key, operand.name);
+
+        for (const auto& [well, id] : wells) {
+            well_values.add_well(well, context.get(id));
+        }
+
+        return well_values;
+    }
+    }
+
+    return Value{};
+}
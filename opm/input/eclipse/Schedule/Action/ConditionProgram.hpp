@@ -0,0 +1,166 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACTION_CONDITION_PROGRAM_HPP
+#define ACTION_CONDITION_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm::Action {
+
+class ASTNode;
+class Context;
+
+} // namespace Opm::Action
+
+namespace Opm::Action {
+
+/// Compiled form of an ACTIONX condition block.
+///
+/// The expression tree is flattened into a pre-order array of nodes in
+/// which each node knows the extent of its subtree.  Summary vector keys,
+/// such as 'WOPR:PROD1', are formed once at compile time, and resolved to
+/// summary vector identifiers by the evaluation Context.  The Context also
+/// expands well name templates and well lists.  It keeps the identifiers
+/// and expansions in a cache, keyed by the program's unique identifier,
+/// which may be retained across evaluations.  The program itself is
+/// immutable after compilation.  All operands of conjunctions and disjunctions are
+/// evaluated, as in the expression tree, so references to unknown summary
+/// vectors are reported even if an earlier operand already decides the
+/// result.
+///
+/// Conditions using constructs which the expression tree evaluator would
+/// reject at evaluation time are not compiled.  The caller is then
+/// expected to use the expression tree, so that the compiled program never
+/// has to replicate the error reporting.
+class ConditionProgram
+{
+public:
+    /// Compile condition block.
+    ///
+    /// \param[in] condition Root of non-empty condition expression tree.
+    ///
+    /// \return Compiled condition, or nullptr if \p condition uses
+    ///   constructs that are not supported by the compiled evaluator.
+    static std::unique_ptr<ConditionProgram> compile(const ASTNode& condition);
+
+    /// Evaluate condition at current dynamic state.
+    ///
+    /// \param[in] context Current summary vectors and wells.
+    ///
+    /// \return Condition value.  Same as ASTNode::eval() for the
+    ///   expression tree from which this program was compiled.
+    Result eval(const Context& context) const;
+
+private:
+    /// Leaf node of a comparison.
+    struct Operand
+    {
+        enum class Kind
+        {
+            /// Numeric constant.
+            Number,
+
+            /// Single summary vector, e.g., FOPR or GGOR:FIELD.
+            Scalar,
+
+            /// Single well-level summary vector, e.g., WOPR:PROD1.
+            Well,
+
+            /// Well-level summary function applied to all wells matching
+            /// a well name template, e.g., WOPR 'PROD*'.
+            WellTemplate,
+
+            /// Well-level summary function applied to all wells of a well
+            /// list, e.g., WOPR '*PRODUCERS'.
+            WellList,
+        };
+
+        Kind kind{Kind::Number};
+
+        /// Numeric constant.  Number operands only.
+        double number{0.0};
+
+        /// Summary vector key for Scalar and Well operands, summary
+        /// function name otherwise.
+        std::string key{};
+
+        /// Well name, well name template, or well list name.
+        std::string name{};
+
+        /// Index of key in keys_ for Scalar and Well operands.  Unique
+        /// index among WellTemplate and WellList operands otherwise.
+        std::size_t slot{0};
+    };
+
+    /// Logical operator or comparison.
+    struct Node
+    {
+        /// Logical operator (op_and, op_or) or comparison (op_gt &c).
+        TokenType type{TokenType::error};
+
+        /// One past the last node of this node's subtree.  Child nodes of
+        /// a logical operator are stored consecutively after the node
+        /// itself.
+        std::size_t end{0};
+
+        /// Left hand side of comparison.
+        Operand lhs{};
+
+        /// Right hand side of comparison.
+        Operand rhs{};
+    };
+
+    /// Unique identifier.  Shared with copies, which have the same keys.
+    std::uint64_t id_{0};
+
+    /// Flattened expression tree, in pre-order.
+    std::vector<Node> nodes_{};
+
+    /// Summary vector keys of Scalar and Well operands.
+    std::vector<std::string> keys_{};
+
+    /// Number of WellTemplate and WellList operands.
+    std::size_t numWellSets_{0};
+
+    bool compileNode(const ASTNode& node);
+    std::optional<Operand> compileOperand(const ASTNode& leaf);
+
+    Result evalNode(std::size_t                             node,
+                    const Context&                          context,
+                    const std::vector<SummaryState::KeyId>& ids) const;
+
+    Value evalOperand(const Operand&                          operand,
+                      const Context&                          context,
+                      const std::vector<SummaryState::KeyId>& ids) const;
+};
+
+} // namespace Opm::Action
+
+#endif // ACTION_CONDITION_PROGRAM_HPP
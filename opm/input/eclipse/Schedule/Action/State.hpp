@@ -20,6 +20,8 @@
 #ifndef ACTION_STATE_HPP
 #define ACTION_STATE_HPP
 
+#include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+
 #include <cstddef>
 #include <ctime>
 #include <map>
@@ -142,6 +144,13 @@ public:
     /// \return PyAction result.  Nullopt if the action has not yet run.
     std::optional<bool> python_result(const std::string& action) const;
 
+    /// Condition evaluation data for Action::Context objects.
+    ///
+    /// Retains summary vector identifiers and well name expansions of the
+    /// run's ACTIONX conditions between evaluations.  Not part of the
+    /// object's serialised state, nor of its equality predicate.
+    Context::Cache& context_cache() { return this->context_cache_; }
+
     /// Load action state from restart file
     ///
     /// \param[in] action_config Run's ActionX and PyAction objects.
@@ -257,6 +266,9 @@ private:
 
     /// PyAction results.
     std::map<std::string, bool> m_python_result{};
+
+    /// Condition evaluation data.
+    Context::Cache context_cache_{};
 };
 
 } // namespace Opm::Action
@@ -40,6 +40,7 @@ class DeckKeyword;
 class DeckRecord;
 class ErrorGuard;
 class ParseContext;
+class PrebuiltKeywordObjects;
 class Schedule;
 class ScheduleBlock;
 class ScheduleGrid;
@@ -68,6 +69,7 @@ public:
     /// \param wpimult_global_factor_ Global well production index multipliers
     /// \param welsegs_wells_ All wells with a WELSEGS entry for checks.
     /// \param compsegs_wells_ All wells with a COMPSEGS entry for checks.
+    /// \param prebuilt_ Objects built ahead of the sequential pass, if any.
     HandlerContext(Schedule& schedule,
                    const ScheduleBlock& block_,
                    const DeckKeyword& keyword_,
@@ -81,7 +83,8 @@ public:
                    const std::unordered_map<std::string, double>* target_wellpi_,
                    std::unordered_map<std::string, double>& wpimult_global_factor_,
                    WelSegsSet* welsegs_wells_,
-                   std::set<std::string>* compsegs_wells_)
+                   std::set<std::string>* compsegs_wells_,
+                   PrebuiltKeywordObjects* prebuilt_ = nullptr)
         : block(block_)
         , keyword(keyword_)
         , currentStep(currentStep_)
@@ -94,6 +97,7 @@ public:
         , target_wellpi(target_wellpi_)
         , welsegs_wells(welsegs_wells_)
         , compsegs_wells(compsegs_wells_)
+        , prebuilt_objects(prebuilt_)
         , sim_update(sim_update_)
         , schedule_(schedule)
     {}
@@ -122,6 +126,12 @@ public:
     /// \brief Mark that the well occured in a COMPSEGS keyword.
     void compsegs_handled(const std::string& well_name);
 
+    //! \brief Objects built ahead of the sequential pass, or nullptr.
+    PrebuiltKeywordObjects* prebuilt() const
+    {
+        return this->prebuilt_objects;
+    }
+
     //! \brief Set exit code.
     void setExitCode(int code);
 
@@ -208,6 +218,7 @@ private:
     const std::unordered_map<std::string, double>* target_wellpi{nullptr};
     WelSegsSet* welsegs_wells{nullptr};
     std::set<std::string>* compsegs_wells{nullptr};
+    PrebuiltKeywordObjects* prebuilt_objects{nullptr};
     SimulatorUpdate* sim_update{nullptr};
     Schedule& schedule_;
 };
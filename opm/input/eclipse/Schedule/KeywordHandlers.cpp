@@ -51,6 +51,7 @@
 #include "MixingRateControlKeywordHandlers.hpp"
 #include "MSW/MSWKeywordHandlers.hpp"
 #include "Network/NetworkKeywordHandlers.hpp"
+#include "PrebuiltKeywordObjects.hpp"
 #include "ResCoup/ReservoirCouplingKeywordHandlers.hpp"
 #include "RXXKeywordHandlers.hpp"
 #include "UDQ/UDQKeywordHandlers.hpp"
@@ -61,6 +62,7 @@
 #include <fmt/format.h>
 
 #include <exception>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -334,19 +336,35 @@ void handleTUNING(HandlerContext& handlerContext)
 
 void handleVFPINJ(HandlerContext& handlerContext)
 {
-    auto table = VFPInjTable(handlerContext.keyword,
-                             handlerContext.static_schedule().m_unit_system);
+    auto table = std::optional<VFPInjTable>{};
+    if (auto* prebuilt = handlerContext.prebuilt(); prebuilt != nullptr) {
+        table = prebuilt->takeVFPInj(handlerContext.keyword);
+    }
+
+    if (! table.has_value()) {
+        table.emplace(handlerContext.keyword,
+                      handlerContext.static_schedule().m_unit_system);
+    }
+
     handlerContext.state().events().addEvent( ScheduleEvents::VFPINJ_UPDATE );
-    handlerContext.state().vfpinj.update( std::move(table) );
+    handlerContext.state().vfpinj.update( std::move(*table) );
 }
 
 void handleVFPPROD(HandlerContext& handlerContext)
 {
-    auto table = VFPProdTable(handlerContext.keyword,
-                              handlerContext.static_schedule().gaslift_opt_active,
-                              handlerContext.static_schedule().m_unit_system);
+    auto table = std::optional<VFPProdTable>{};
+    if (auto* prebuilt = handlerContext.prebuilt(); prebuilt != nullptr) {
+        table = prebuilt->takeVFPProd(handlerContext.keyword);
+    }
+
+    if (! table.has_value()) {
+        table.emplace(handlerContext.keyword,
+                      handlerContext.static_schedule().gaslift_opt_active,
+                      handlerContext.static_schedule().m_unit_system);
+    }
+
     handlerContext.state().events().addEvent( ScheduleEvents::VFPPROD_UPDATE );
-    handlerContext.state().vfpprod.update( std::move(table) );
+    handlerContext.state().vfpprod.update( std::move(*table) );
 }
 
 }
@@ -35,9 +35,12 @@
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
 
 #include "../HandlerContext.hpp"
+#include "../PrebuiltKeywordObjects.hpp"
 
 #include <fmt/format.h>
 
+#include <memory>
+
 namespace Opm {
 
 namespace {
@@ -88,7 +91,20 @@ void handleWELSEGS(HandlerContext& handlerContext)
     const auto& wname = record1.getItem("WELL").getTrimmedString(0);
     if (handlerContext.state().wells.has(wname)) {
         auto well = handlerContext.state().wells.get(wname);
-        if (well.handleWELSEGS(handlerContext.keyword)) {
+
+        // Segments loaded ahead of time only apply to wells without
+        // existing segment structure.
+        auto segments = std::shared_ptr<WellSegments>{};
+        if (auto* prebuilt = handlerContext.prebuilt(); prebuilt != nullptr) {
+            segments = prebuilt->takeWellSegments(handlerContext.keyword);
+        }
+
+        if ((segments != nullptr) && !well.isMultiSegment()) {
+            well.updateSegments(std::move(segments));
+            handlerContext.state().wells.update( std::move(well) );
+            handlerContext.record_well_structure_change();
+        }
+        else if (well.handleWELSEGS(handlerContext.keyword)) {
             handlerContext.state().wells.update( std::move(well) );
             handlerContext.record_well_structure_change();
         }
@@ -0,0 +1,141 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
+
+#include <opm/common/utility/AppendOnlyArray.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace {
+
+    /// Storage of interned names.
+    ///
+    /// Names are never moved or freed while the process runs, so name()
+    /// can hand out references without holding a lock.
+    class Table
+    {
+    public:
+        using Index = Opm::NameTable::Index;
+
+        Table()
+        {
+            this->insert(std::string{});
+        }
+
+        Table(const Table&) = delete;
+        Table& operator=(const Table&) = delete;
+
+        Index index(const std::string& name)
+        {
+            if (const auto idx = this->find(name); idx.has_value()) {
+                return *idx;
+            }
+
+            std::unique_lock lock { this->mutex_ };
+
+            if (auto pos = this->index_.find(name); pos != this->index_.end()) {
+                return pos->second;
+            }
+
+            return this->insert(name);
+        }
+
+        std::optional<Index> find(std::string_view name) const
+        {
+            std::shared_lock lock { this->mutex_ };
+
+            auto pos = this->index_.find(name);
+            if (pos == this->index_.end()) {
+                return std::nullopt;
+            }
+
+            return pos->second;
+        }
+
+        const std::string& name(const Index idx) const
+        {
+            if (idx >= this->size()) {
+                throw std::out_of_range {
+                    fmt::format("Name index {} is not assigned", idx)
+                };
+            }
+
+            return this->names_[idx];
+        }
+
+        std::size_t size() const
+        {
+            return this->names_.size();
+        }
+
+    private:
+        mutable std::shared_mutex mutex_{};
+        std::unordered_map<std::string_view, Index> index_{};
+        Opm::AppendOnlyArray<std::string> names_{};
+
+        /// Caller holds exclusive lock, except in the constructor.
+        Index insert(const std::string& name)
+        {
+            const auto idx = this->names_.size();
+            const auto& stored = this->names_.push_back(std::string { name });
+
+            this->index_.emplace(std::string_view { stored }, idx);
+
+            return idx;
+        }
+    };
+
+    Table& table()
+    {
+        static Table t;
+        return t;
+    }
+
+} // Anonymous namespace
+
+Opm::NameTable::Index Opm::NameTable::index(const std::string& name)
+{
+    return table().index(name);
+}
+
+std::optional<Opm::NameTable::Index>
+Opm::NameTable::find(std::string_view name)
+{
+    return table().find(name);
+}
+
+const std::string& Opm::NameTable::name(const Index idx)
+{
+    return table().name(idx);
+}
+
+std::size_t Opm::NameTable::size()
+{
+    return table().size();
+}
@@ -0,0 +1,88 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NAME_TABLE_HPP
+#define NAME_TABLE_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Opm {
+
+/// Process wide table of interned names.
+///
+/// Every distinct name is assigned a small, stable integer index the first
+/// time it is seen.  Containers of per-well or per-group values, such as
+/// UDQSet and UDQState, store these indices instead of the names
+/// themselves.  Since the table is shared by all runs in the process, the
+/// indices must not be used directly as positions in long lived dense
+/// arrays, which would then grow with the number of names ever interned.
+/// Names are materialised from the table only when needed for output.
+/// The registry of summary vectors in SummaryState stores the variable and
+/// entity names of its vectors in this table as well, but not their full
+/// keys such as WOPR:PROD1, since those would spread out the indices of the
+/// well and group names.
+///
+/// The table only ever grows, without any fixed upper limit, and all
+/// operations are thread safe.  Name lookup from an index does not take any
+/// locks.  Indices are specific to the current process and must never be
+/// written to file or communicated to other processes--use the names for
+/// that purpose.
+class NameTable
+{
+public:
+    /// Interned name index.
+    using Index = std::size_t;
+
+    /// Index of the empty name.
+    static constexpr Index empty_index = 0;
+
+    /// Intern a name.
+    ///
+    /// \param[in] name Well, group, or summary vector name.
+    ///
+    /// \return Index of \p name.  Same value for all calls with the same
+    ///   name.
+    static Index index(const std::string& name);
+
+    /// Look up a name without interning it.
+    ///
+    /// \param[in] name Well, group, or summary vector name.
+    ///
+    /// \return Index of \p name, or nullopt if \p name has never been
+    ///   interned.
+    static std::optional<Index> find(std::string_view name);
+
+    /// Name of interned index.
+    ///
+    /// Throws an exception of type std::out_of_range if \p idx has not
+    /// been assigned.
+    ///
+    /// \param[in] idx Result of a previous call to index().
+    static const std::string& name(Index idx);
+
+    /// Number of interned names, including the empty name.
+    static std::size_t size();
+};
+
+} // namespace Opm
+
+#endif // NAME_TABLE_HPP
@@ -0,0 +1,243 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PrebuiltKeywordObjects.hpp"
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/ParallelWithFallback.hpp>
+
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+
+#include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/E.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/V.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/W.hpp>
+
+#include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleDeck.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleStatic.hpp>
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    enum class ObjectType { VFPProd, VFPInj, Segments };
+
+    struct Task
+    {
+        const Opm::DeckKeyword* keyword{nullptr};
+        ObjectType type{ObjectType::VFPProd};
+        std::unique_ptr<Opm::VFPProdTable> vfpprod{};
+        std::unique_ptr<Opm::VFPInjTable> vfpinj{};
+        std::shared_ptr<Opm::WellSegments> segments{};
+
+        // Messages logged while building the object.
+        Opm::OpmLog::DeferredMessages messages{};
+    };
+
+    std::optional<ObjectType> objectType(const Opm::DeckKeyword& keyword)
+    {
+        if (keyword.is<Opm::ParserKeywords::VFPPROD>()) {
+            return ObjectType::VFPProd;
+        }
+
+        if (keyword.is<Opm::ParserKeywords::VFPINJ>()) {
+            return ObjectType::VFPInj;
+        }
+
+        if (keyword.is<Opm::ParserKeywords::WELSEGS>()) {
+            return ObjectType::Segments;
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<Task> collectTasks(const Opm::ScheduleDeck& sched_deck,
+                                   const std::size_t load_start,
+                                   const std::size_t load_end,
+                                   const std::size_t restart_step,
+                                   std::set<std::string> multisegment_wells)
+    {
+        auto tasks = std::vector<Task>{};
+
+        for (auto report_step = load_start; report_step < load_end; ++report_step) {
+            auto in_action = false;
+
+            for (const auto& keyword : sched_deck[report_step]) {
+                if (keyword.is<Opm::ParserKeywords::ACTIONX>()) {
+                    in_action = true;
+                    continue;
+                }
+                else if (keyword.is<Opm::ParserKeywords::ENDACTIO>()) {
+                    in_action = false;
+                    continue;
+                }
+
+                const auto type = objectType(keyword);
+                if (! type.has_value() || in_action) {
+                    continue;
+                }
+
+                // Later WELSEGS keywords of a well are applied
+                // incrementally to its existing segments.
+                if ((*type == ObjectType::Segments) &&
+                    ((report_step < restart_step) ||
+                     ! multisegment_wells.insert(keyword.getRecord(0).getItem("WELL")
+                                                 .getTrimmedString(0)).second))
+                {
+                    continue;
+                }
+
+                tasks.emplace_back().keyword = &keyword;
+                tasks.back().type = *type;
+            }
+        }
+
+        return tasks;
+    }
+
+    void buildObject(Task& task,
+                     const bool gaslift_opt_active,
+                     const Opm::UnitSystem& unit_system)
+    {
+        switch (task.type) {
+        case ObjectType::VFPProd:
+            task.vfpprod = std::make_unique<Opm::VFPProdTable>
+                (*task.keyword, gaslift_opt_active, unit_system);
+            break;
+
+        case ObjectType::VFPInj:
+            task.vfpinj = std::make_unique<Opm::VFPInjTable>
+                (*task.keyword, unit_system);
+            break;
+
+        case ObjectType::Segments:
+            task.segments = std::make_shared<Opm::WellSegments>();
+            task.segments->loadWELSEGS(*task.keyword, unit_system);
+            break;
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+PrebuiltKeywordObjects::PrebuiltKeywordObjects() = default;
+
+PrebuiltKeywordObjects::~PrebuiltKeywordObjects() = default;
+
+void PrebuiltKeywordObjects::build(const ScheduleDeck& sched_deck,
+                                   const std::size_t load_start,
+                                   const std::size_t load_end,
+                                   const ScheduleStatic& static_schedule,
+                                   const std::set<std::string>& multisegment_wells)
+{
+    auto tasks = collectTasks(sched_deck, load_start, load_end,
+                              static_schedule.rst_info.report_step,
+                              multisegment_wells);
+
+    const auto attempt = [&tasks, &static_schedule]
+        (const UnitSystem& unit_system, const std::size_t i)
+    {
+        // Log backends are not thread safe.
+        const auto defer = OpmLog::DeferMessages { tasks[i].messages };
+
+        buildObject(tasks[i], static_schedule.gaslift_opt_active, unit_system);
+    };
+
+    // Failed objects are left to the keyword handlers, which build them
+    // again.  The messages of the others are logged when taken.
+    const auto complete = [this, &tasks](const std::size_t i, const bool failed)
+    {
+        auto& task = tasks[i];
+        if (failed) {
+            return;
+        }
+
+        if (task.vfpprod != nullptr) {
+            this->vfpprod_.insert_or_assign(task.keyword, Entry<std::unique_ptr<VFPProdTable>> {
+                std::move(task.vfpprod), std::move(task.messages)
+            });
+        }
+        else if (task.vfpinj != nullptr) {
+            this->vfpinj_.insert_or_assign(task.keyword, Entry<std::unique_ptr<VFPInjTable>> {
+                std::move(task.vfpinj), std::move(task.messages)
+            });
+        }
+        else if (task.segments != nullptr) {
+            this->segments_.insert_or_assign(task.keyword, Entry<std::shared_ptr<WellSegments>> {
+                std::move(task.segments), std::move(task.messages)
+            });
+        }
+    };
+
+    parallelWithSequentialFallback(tasks.size(), 1, static_schedule.m_unit_system,
+                                   attempt, complete);
+}
+
+std::optional<VFPProdTable>
+PrebuiltKeywordObjects::takeVFPProd(const DeckKeyword& keyword)
+{
+    auto node = this->vfpprod_.extract(&keyword);
+    if (node.empty()) {
+        return std::nullopt;
+    }
+
+    node.mapped().messages.release();
+
+    return std::move(*node.mapped().object);
+}
+
+std::optional<VFPInjTable>
+PrebuiltKeywordObjects::takeVFPInj(const DeckKeyword& keyword)
+{
+    auto node = this->vfpinj_.extract(&keyword);
+    if (node.empty()) {
+        return std::nullopt;
+    }
+
+    node.mapped().messages.release();
+
+    return std::move(*node.mapped().object);
+}
+
+std::shared_ptr<WellSegments>
+PrebuiltKeywordObjects::takeWellSegments(const DeckKeyword& keyword)
+{
+    auto node = this->segments_.extract(&keyword);
+    if (node.empty()) {
+        return {};
+    }
+
+    node.mapped().messages.release();
+
+    return std::move(node.mapped().object);
+}
+
+} // namespace Opm
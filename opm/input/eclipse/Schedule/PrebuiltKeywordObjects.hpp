@@ -0,0 +1,103 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PREBUILT_KEYWORD_OBJECTS_HPP
+#define PREBUILT_KEYWORD_OBJECTS_HPP
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+namespace Opm {
+
+class DeckKeyword;
+class ScheduleDeck;
+struct ScheduleStatic;
+class VFPInjTable;
+class VFPProdTable;
+class WellSegments;
+
+/// Objects which depend only on a single SCHEDULE keyword and the static
+/// schedule information, built concurrently ahead of the sequential pass in
+/// Schedule::iterateScheduleSection() when the deck is first loaded.  The
+/// keyword handlers take the prebuilt objects instead of constructing them
+/// from the keyword.  Re-iterations after actions or WELPI construct the
+/// objects in the handlers as before.
+///
+/// Keywords whose object could not be built, e.g. because the input is
+/// invalid, are left out and handled as usual by the sequential pass, so
+/// that errors are reported in deck order.  Warnings issued while building
+/// an object are held back and logged when the keyword handler takes the
+/// object, i.e., at the point where the handler would have logged them.
+/// Warnings for objects which are never taken are discarded, since the
+/// handler then builds the object itself.
+class PrebuiltKeywordObjects
+{
+public:
+    PrebuiltKeywordObjects();
+    ~PrebuiltKeywordObjects();
+
+    /// Build objects for the VFPPROD, VFPINJ and WELSEGS keywords in report
+    /// steps [load_start, load_end).  Keywords inside ACTIONX blocks are
+    /// skipped.
+    ///
+    /// Segments are only built for WELSEGS keywords which the handler
+    /// applies from scratch, i.e., the first WELSEGS keyword of each well
+    /// which is not in \p multisegment_wells, and not for report steps
+    /// preceding the restart step, whose keywords a restarted run skips.
+    void build(const ScheduleDeck& sched_deck,
+               std::size_t load_start,
+               std::size_t load_end,
+               const ScheduleStatic& static_schedule,
+               const std::set<std::string>& multisegment_wells);
+
+    /// Prebuilt table for a VFPPROD keyword, or nullopt if none.  Logs
+    /// the warnings issued while building the table.
+    std::optional<VFPProdTable> takeVFPProd(const DeckKeyword& keyword);
+
+    /// Prebuilt table for a VFPINJ keyword, or nullopt if none.  Logs the
+    /// warnings issued while building the table.
+    std::optional<VFPInjTable> takeVFPInj(const DeckKeyword& keyword);
+
+    /// Segments for a WELSEGS keyword applied to a well without existing
+    /// segments, or nullptr if none.  Logs the warnings issued while
+    /// building the segments.
+    std::shared_ptr<WellSegments> takeWellSegments(const DeckKeyword& keyword);
+
+private:
+    /// Prebuilt object and the messages held back while building it.
+    template <typename Ptr>
+    struct Entry
+    {
+        Ptr object{};
+        OpmLog::DeferredMessages messages{};
+    };
+
+    std::unordered_map<const DeckKeyword*, Entry<std::unique_ptr<VFPProdTable>>> vfpprod_{};
+    std::unordered_map<const DeckKeyword*, Entry<std::unique_ptr<VFPInjTable>>> vfpinj_{};
+    std::unordered_map<const DeckKeyword*, Entry<std::shared_ptr<WellSegments>>> segments_{};
+};
+
+} // namespace Opm
+
+#endif // PREBUILT_KEYWORD_OBJECTS_HPP
@@ -104,6 +104,7 @@
 #include "KeywordHandlers.hpp"
 #include "MSW/Compsegs.hpp"
 #include "MSW/WelSegsSet.hpp"
+#include "PrebuiltKeywordObjects.hpp"
 #include "Well/injection.hpp"
 
 #include <algorithm>
@@ -111,6 +112,7 @@
 #include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -191,12 +193,16 @@ namespace Opm {
 
             auto restart_step = this->m_static.rst_info.report_step;
             this->iterateScheduleSection(0, restart_step, parseContext, errors,
-                                         grid, nullptr, "", keepKeywords);
+                                         grid, nullptr, "", keepKeywords,
+                                         /* log_to_debug = */ false,
+                                         /* initial_load = */ true);
             this->load_rst(*rst, *tracer_config, grid, fp);
             if (! this->restart_output.writeRestartFile(restart_step))
                 this->restart_output.addRestartOutput(restart_step);
             this->iterateScheduleSection(restart_step, this->m_sched_deck.size(),
-                                         parseContext, errors, grid, nullptr, "", keepKeywords);
+                                         parseContext, errors, grid, nullptr, "", keepKeywords,
+                                         /* log_to_debug = */ false,
+                                         /* initial_load = */ true);
             // Events added during restart reading well be added to previous step, but need to be active at the
             // restart step to ensure well potentials and guide rates are available at the first step.
             const auto prev_step = std::max(static_cast<int>(restart_step-1), 0);
@@ -204,7 +210,9 @@ namespace Opm {
             this->snapshots[restart_step].events().merge(this->snapshots[prev_step].events());
         } else {
             this->iterateScheduleSection(0, this->m_sched_deck.size(),
-                                         parseContext, errors, grid, nullptr, "", keepKeywords);
+                                         parseContext, errors, grid, nullptr, "", keepKeywords,
+                                         /* log_to_debug = */ false,
+                                         /* initial_load = */ true);
         }
     }
     catch (const OpmInputError& opm_error) {
@@ -429,12 +437,14 @@ namespace Opm {
                                  const std::unordered_map<std::string, double>* target_wellpi,
                                  std::unordered_map<std::string, double>& wpimult_global_factor,
                                  WelSegsSet* welsegs_wells,
-                                 std::set<std::string>* compsegs_wells)
+                                 std::set<std::string>* compsegs_wells,
+                                 PrebuiltKeywordObjects* prebuilt)
     {
         HandlerContext handlerContext { *this, block, keyword, grid, currentStep,
                                         matches, action_mode,
                                         parseContext, errors, sim_update, target_wellpi,
-                                        wpimult_global_factor, welsegs_wells, compsegs_wells};
+                                        wpimult_global_factor, welsegs_wells, compsegs_wells,
+                                        prebuilt };
 
         if (!KeywordHandlers::getInstance().handleKeyword(handlerContext)) {
             OpmLog::warning(fmt::format("No handler registered for keyword {} "
@@ -614,7 +624,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                       const std::unordered_map<std::string, double> * target_wellpi,
                                       const std::string& prefix,
                                       const bool keepKeywords,
-                                      const bool log_to_debug)
+                                      const bool log_to_debug,
+                                      const bool initial_load)
 {
         std::vector<std::pair< const DeckKeyword* , std::size_t> > rftProperties;
         std::string time_unit = this->m_static.m_unit_system.name(UnitSystem::measure::time);
@@ -667,8 +678,40 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         std::set<std::string> compsegs_wells;
         WelSegsSet welsegs_wells;
 
+        // Snapshots from the previous pass over the same report steps, if
+        // any.  Once a new snapshot is identical to its counterpart from
+        // the previous pass then so are all subsequent snapshots.
+        auto previous = std::vector<ScheduleState>{};
+        if (load_start == this->previous_pass_start) {
+            previous.swap(this->previous_pass);
+        }
+        this->previous_pass.clear();
+        const auto num_previous = std::min(previous.size(), load_end - load_start);
+
         const auto matches = Action::Result { false }.matches();
 
+        // Objects which depend only on their own keyword are built
+        // concurrently up front and picked up by the keyword handlers.
+        // Only done when loading the deck; re-iterations triggered by
+        // actions and WELPI run during the simulation and typically stop
+        // after a few report steps, so they build objects on demand.
+        auto prebuilt = std::optional<PrebuiltKeywordObjects>{};
+        if (initial_load) {
+            // Wells loaded from a restart file may already have segments.
+            auto multisegment_wells = std::set<std::string>{};
+            if (! this->snapshots.empty()) {
+                const auto& wells = this->snapshots.back().wells;
+                for (const auto& wname : wells.keys()) {
+                    if (wells(wname).isMultiSegment()) {
+                        multisegment_wells.insert(wname);
+                    }
+                }
+            }
+
+            prebuilt.emplace().build(this->m_sched_deck, load_start, load_end,
+                                     this->m_static, multisegment_wells);
+        }
+
         for (auto report_step = load_start; report_step < load_end; report_step++) {
             std::size_t keyword_index = 0;
             auto& block = this->m_sched_deck[report_step];
@@ -758,7 +801,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                     target_wellpi,
                                     wpimult_global_factor,
                                     &welsegs_wells,
-                                    &compsegs_wells);
+                                    &compsegs_wells,
+                                    prebuilt.has_value() ? &*prebuilt : nullptr);
                 keyword_index++;
             }
 
@@ -773,6 +817,19 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
             if (!keepKeywords) {
                 this->m_sched_deck.clearKeywords(report_step);
             }
+
+            if (const auto prev = report_step - load_start;
+                (prev + 1 < num_previous) && (this->snapshots.back() == previous[prev]))
+            {
+                logger(fmt::format("Report step {} unchanged from previous pass, "
+                                   "reusing report steps {} to {}",
+                                   report_step, report_step + 1, load_start + num_previous - 1));
+
+                this->snapshots.insert(this->snapshots.end(),
+                                       std::make_move_iterator(previous.begin() + prev + 1),
+                                       std::make_move_iterator(previous.begin() + num_previous));
+                break;
+            }
         } // for (auto report_step = load_start
     }
 
@@ -785,6 +842,18 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         }
     }
 
+    void Schedule::truncateSnapshots(const std::size_t num_snapshots) {
+        // Repeated truncation at the same report step, e.g. from several
+        // actions in one PYACTION, keeps the original previous pass.
+        if (this->snapshots.size() > num_snapshots) {
+            this->previous_pass.assign(std::make_move_iterator(this->snapshots.begin() + num_snapshots),
+                                       std::make_move_iterator(this->snapshots.end()));
+            this->previous_pass_start = num_snapshots;
+        }
+
+        this->snapshots.resize(num_snapshots);
+    }
+
     void Schedule::addACTIONX(const Action::ActionX& action) {
         auto new_actions = this->snapshots.back().actions.get();
         new_actions.add( action );
@@ -1713,7 +1782,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         const auto matches = Action::Result{false}.matches();
         const std::string prefix = "| "; // logger prefix string
 
-        this->snapshots.resize(reportStep + 1);
+        this->truncateSnapshots(reportStep + 1);
 
         auto& input_block = this->m_sched_deck[reportStep];
         ScheduleLogger logger(ScheduleLogger::select_stream(true, false), // will log to OpmLog::debug
@@ -1820,7 +1889,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                                   "keywords and\n{0}rerun Schedule section.\n{0}",
                                   prefix, action.name()));
 
-        this->snapshots.resize(reportStep + 1);
+        this->truncateSnapshots(reportStep + 1);
         auto& input_block = this->m_sched_deck[reportStep];
 
         std::unordered_map<std::string, double> wpimult_global_factor;
@@ -1878,7 +1947,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     {
         SimulatorUpdate sim_update{};
 
-        this->snapshots.resize(reportStep + 1);
+        this->truncateSnapshots(reportStep + 1);
         for (const auto& [well, newConns] : extraConns) {
             if (newConns.empty()) { continue; }
 
@@ -64,6 +64,7 @@ namespace Opm {
     enum class InputErrorAction;
     class NumericalAquifers;
     class ParseContext;
+    class PrebuiltKeywordObjects;
     class Python;
     class Runspec;
     class RPTConfig;
@@ -430,7 +431,7 @@ namespace Opm {
             serializer(this->action_wgnames);
             serializer(this->potential_wellopen_patterns);
             serializer(this->exit_status);
-            serializer(this->snapshots);
+            this->serializeSnapshots(serializer);
             serializer(this->restart_output);
             serializer(this->completed_cells);
             serializer(this->completed_cells_lgr);
@@ -455,6 +456,29 @@ namespace Opm {
             }
         }
 
+        // The first snapshot is serialized in full and every later one as
+        // a difference to its predecessor.  Objects shared by consecutive
+        // snapshots are thus only serialized once, and the sharing is
+        // restored when unpacking.
+        template<class Serializer>
+        void serializeSnapshots(Serializer& serializer)
+        {
+            auto num_snapshots = this->snapshots.size();
+            serializer(num_snapshots);
+            if (!serializer.isSerializing()) {
+                this->snapshots.assign(num_snapshots, ScheduleState{});
+            }
+
+            for (std::size_t step = 0; step < num_snapshots; ++step) {
+                if (step == 0) {
+                    serializer(this->snapshots[step]);
+                }
+                else {
+                    this->snapshots[step].serializeDelta(serializer, this->snapshots[step - 1]);
+                }
+            }
+        }
+
         template <typename T>
         std::vector<std::pair<std::size_t,  T>> unique() const
         {
@@ -511,6 +535,14 @@ namespace Opm {
         // The copy constructor is needed for creating a mocked simulator (msim).
         std::shared_ptr<SimulatorUpdate> simUpdateFromPython{};
 
+        // Snapshots removed by the most recent truncateSnapshots() call,
+        // i.e. the previous pass over report steps previous_pass_start and
+        // later.  Used by iterateScheduleSection() to stop re-iterating
+        // once a new snapshot is identical to the previous pass.  This is
+        // transient state, and not part of serializeOp() or operator==().
+        std::vector<ScheduleState> previous_pass{};
+        std::size_t previous_pass_start = 0;
+
         void init_completed_cells_lgr(const EclipseGrid& ecl_grid);
         void init_completed_cells_lgr_map(const EclipseGrid& ecl_grid);
 
@@ -546,7 +578,9 @@ namespace Opm {
                                     const std::unordered_map<std::string, double> * target_wellpi,
                                     const std::string& prefix,
                                     const bool keepKeywords,
-                                    const bool log_to_debug = false);
+                                    const bool log_to_debug = false,
+                                    const bool initial_load = false);
+        void truncateSnapshots(std::size_t num_snapshots);
         void addACTIONX(const Action::ActionX& action);
         void addGroupToGroup( const std::string& parent_group, const std::string& child_group);
         void addGroup(const std::string& groupName , std::size_t timeStep);
@@ -570,7 +604,8 @@ namespace Opm {
                            const std::unordered_map<std::string, double>* target_wellpi,
                            std::unordered_map<std::string, double>& wpimult_global_factor,
                            WelSegsSet* welsegs_wells = nullptr,
-                           std::set<std::string>* compsegs_wells = nullptr);
+                           std::set<std::string>* compsegs_wells = nullptr,
+                           PrebuiltKeywordObjects* prebuilt = nullptr);
 
         void internalWELLSTATUSACTIONXFromPYACTION(const std::string& well_name, std::size_t report_step, const std::string& wellStatus);
         void prefetchPossibleFutureConnections(const ScheduleGrid& grid, const DeckKeyword& keyword,
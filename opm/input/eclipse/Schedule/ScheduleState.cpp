@@ -27,6 +27,7 @@
 #include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
 #include <opm/input/eclipse/Schedule/Group/GSatProd.hpp>
 #include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupSatelliteInjection.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
 #include <opm/input/eclipse/Schedule/Network/Balance.hpp>
 #include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
@@ -38,6 +39,7 @@
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
 #include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellFractureSeeds.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellTestConfig.hpp>
 
@@ -349,29 +351,38 @@ bool ScheduleState::operator==(const ScheduleState& other) const {
         && this->m_message_limits == other.m_message_limits
         && this->m_whistctl_mode == other.m_whistctl_mode
         && this->m_nupcol == other.m_nupcol
-        && this->network.get() == other.network.get()
-        && this->network_balance.get() == other.network_balance.get()
-        && this->wtest_config.get() == other.wtest_config.get()
-        && this->well_order.get() == other.well_order.get()
-        && this->group_order.get() == other.group_order.get()
-        && this->gconsale.get() == other.gconsale.get()
-        && this->gconsump.get() == other.gconsump.get()
-        && this->gsatprod.get() == other.gsatprod.get()
-        && this->wlist_manager.get() == other.wlist_manager.get()
-        && this->rpt_config.get() == other.rpt_config.get()
-        && this->actions.get() == other.actions.get()
-        && this->udq_active.get() == other.udq_active.get()
-        && this->glo.get() == other.glo.get()
-        && this->guide_rate.get() == other.guide_rate.get()
-        && this->rft_config.get() == other.rft_config.get()
-        && this->udq.get() == other.udq.get()
-        && this->bhp_defaults.get() == other.bhp_defaults.get()
-        && this->source.get() == other.source.get()
+        && this->network == other.network
+        && this->network_balance == other.network_balance
+        && this->wtest_config == other.wtest_config
+        && this->well_order == other.well_order
+        && this->group_order == other.group_order
+        && this->gconsale == other.gconsale
+        && this->gconsump == other.gconsump
+        && this->gsatprod == other.gsatprod
+        && this->gecon == other.gecon
+        && this->wlist_manager == other.wlist_manager
+        && this->rpt_config == other.rpt_config
+        && this->actions == other.actions
+        && this->udq_active == other.udq_active
+        && this->glo == other.glo
+        && this->guide_rate == other.guide_rate
+        && this->rft_config == other.rft_config
+        && this->rst_config == other.rst_config
+        && this->udq == other.udq
+        && this->pavg == other.pavg
+        && this->rescoup == other.rescoup
+        && this->bhp_defaults == other.bhp_defaults
+        && this->source == other.source
+        && this->wcycle == other.wcycle
         && this->wells == other.wells
         && this->inj_streams == other.inj_streams
         && this->groups == other.groups
         && this->vfpprod == other.vfpprod
         && this->vfpinj == other.vfpinj
+        && this->satelliteInjection == other.satelliteInjection
+        && this->wseed == other.wseed
+        && this->aqufluxs == other.aqufluxs
+        && this->bcprop == other.bcprop
         && this->m_sumthin == other.m_sumthin
         && this->next_tstep == other.next_tstep
         && this->m_rptonly == other.m_rptonly
@@ -150,6 +150,20 @@ namespace Opm {
                 return *this->m_data;
             }
 
+            /*
+              Members shared between snapshots compare equal without
+              inspecting the pointed-to objects.
+            */
+            bool operator==(const ptr_member<T>& other) const {
+                if (this->m_data == other.m_data)
+                    return true;
+
+                if (!this->m_data || !other.m_data)
+                    return false;
+
+                return *this->m_data == *other.m_data;
+            }
+
             template<class Serializer>
             void serializeOp(Serializer& serializer)
             {
@@ -265,6 +279,9 @@ namespace Opm {
                     if (!ptr2)
                         return false;
 
+                    if (ptr1 == ptr2)
+                        continue;
+
                     if (!(*ptr1 == *ptr2))
                         return false;
                 }
@@ -299,6 +316,42 @@ namespace Opm {
                 serializer(m_data);
             }
 
+            /*
+              Serialize only the entries which differ from @prev, typically
+              the same member of the preceding snapshot. When unpacking, the
+              unchanged entries share storage with @prev.
+            */
+            template<class Serializer>
+            void serializeDelta(Serializer& serializer, const map_member<K,T>& prev)
+            {
+                std::unordered_map<K, std::shared_ptr<T>> changed;
+                std::vector<K> removed;
+                if (serializer.isSerializing()) {
+                    for (const auto& [key, ptr] : this->m_data) {
+                        if (prev.get_ptr(key) != ptr)
+                            changed.emplace(key, ptr);
+                    }
+
+                    for (const auto& [key, _] : prev.m_data) {
+                        (void)_;
+                        if (this->m_data.count(key) == 0)
+                            removed.push_back(key);
+                    }
+                }
+
+                serializer(changed);
+                serializer(removed);
+
+                if (!serializer.isSerializing()) {
+                    this->m_data = prev.m_data;
+                    for (const auto& key : removed)
+                        this->m_data.erase(key);
+
+                    for (auto& [key, ptr] : changed)
+                        this->m_data.insert_or_assign(key, std::move(ptr));
+                }
+            }
+
         private:
             std::unordered_map<K, std::shared_ptr<T>> m_data;
         };
@@ -526,61 +579,125 @@ namespace Opm {
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
-            serializer(gconsale);
-            serializer(gconsump);
-            serializer(gsatprod);
-            serializer(gecon);
-            serializer(guide_rate);
-            serializer(wlist_manager);
-            serializer(well_order);
-            serializer(group_order);
-            serializer(actions);
-            serializer(udq);
-            serializer(udq_active);
-            serializer(pavg);
-            serializer(wtest_config);
-            serializer(glo);
-            serializer(network);
-            serializer(network_balance);
-            serializer(rescoup);
-            serializer(rpt_config);
-            serializer(rft_config);
-            serializer(rst_config);
-            serializer(bhp_defaults);
-            serializer(source);
-            serializer(wcycle);
-            serializer(vfpprod);
-            serializer(vfpinj);
-            serializer(groups);
-            serializer(wells);
-            serializer(this->satelliteInjection);
-            serializer(wseed);
-            serializer(aqufluxs);
-            serializer(bcprop);
-            serializer(inj_streams);
-            serializer(target_wellpi);
-            serializer(this->next_tstep);
-            serializer(m_start_time);
-            serializer(m_end_time);
-            serializer(m_sim_step);
-            serializer(m_month_num);
-            serializer(m_year_num);
-            serializer(m_first_in_year);
-            serializer(m_first_in_month);
-            serializer(m_save_step);
-            serializer(m_tuning);
-            serializer(m_nupcol);
-            serializer(m_oilvap);
-            serializer(m_events);
-            serializer(m_wellgroup_events);
-            serializer(m_geo_keywords);
-            serializer(m_message_limits);
-            serializer(m_whistctl_mode);
-            serializer(m_sumthin);
-            serializer(this->m_rptonly);
+            this->serializeMembers(serializer, nullptr);
+        }
+
+        /*
+          Serialize as a difference to @prev, typically the preceding
+          snapshot. Map members only carry the entries which have changed,
+          and value members which compare equal to those of @prev are
+          replaced by a flag. Used by Schedule::serializeOp() so that the
+          objects shared between consecutive snapshots are only sent once.
+        */
+        template<class Serializer>
+        void serializeDelta(Serializer& serializer, const ScheduleState& prev)
+        {
+            this->serializeMembers(serializer, &prev);
         }
 
     private:
+        template<class Serializer>
+        void serializeMembers(Serializer& serializer, const ScheduleState* prev)
+        {
+            auto member = [this, &serializer, prev](auto ptr)
+            {
+                serializeMember(serializer, this->*ptr,
+                                (prev != nullptr) ? &(prev->*ptr) : nullptr);
+            };
+
+            member(&ScheduleState::gconsale);
+            member(&ScheduleState::gconsump);
+            member(&ScheduleState::gsatprod);
+            member(&ScheduleState::gecon);
+            member(&ScheduleState::guide_rate);
+            member(&ScheduleState::wlist_manager);
+            member(&ScheduleState::well_order);
+            member(&ScheduleState::group_order);
+            member(&ScheduleState::actions);
+            member(&ScheduleState::udq);
+            member(&ScheduleState::udq_active);
+            member(&ScheduleState::pavg);
+            member(&ScheduleState::wtest_config);
+            member(&ScheduleState::glo);
+            member(&ScheduleState::network);
+            member(&ScheduleState::network_balance);
+            member(&ScheduleState::rescoup);
+            member(&ScheduleState::rpt_config);
+            member(&ScheduleState::rft_config);
+            member(&ScheduleState::rst_config);
+            member(&ScheduleState::bhp_defaults);
+            member(&ScheduleState::source);
+            member(&ScheduleState::wcycle);
+            member(&ScheduleState::vfpprod);
+            member(&ScheduleState::vfpinj);
+            member(&ScheduleState::groups);
+            member(&ScheduleState::wells);
+            member(&ScheduleState::satelliteInjection);
+            member(&ScheduleState::wseed);
+            member(&ScheduleState::aqufluxs);
+            member(&ScheduleState::bcprop);
+            member(&ScheduleState::inj_streams);
+            member(&ScheduleState::target_wellpi);
+            member(&ScheduleState::next_tstep);
+            member(&ScheduleState::m_start_time);
+            member(&ScheduleState::m_end_time);
+            member(&ScheduleState::m_sim_step);
+            member(&ScheduleState::m_month_num);
+            member(&ScheduleState::m_year_num);
+            member(&ScheduleState::m_first_in_year);
+            member(&ScheduleState::m_first_in_month);
+            member(&ScheduleState::m_save_step);
+            member(&ScheduleState::m_tuning);
+            member(&ScheduleState::m_nupcol);
+            member(&ScheduleState::m_oilvap);
+            member(&ScheduleState::m_events);
+            member(&ScheduleState::m_wellgroup_events);
+            member(&ScheduleState::m_geo_keywords);
+            member(&ScheduleState::m_message_limits);
+            member(&ScheduleState::m_whistctl_mode);
+            member(&ScheduleState::m_sumthin);
+            member(&ScheduleState::m_rptonly);
+        }
+
+        template<class Serializer, class K, class T>
+        static void serializeMember(Serializer& serializer,
+                                    map_member<K,T>& member,
+                                    const map_member<K,T>* prev)
+        {
+            if (prev == nullptr)
+                serializer(member);
+            else
+                member.serializeDelta(serializer, *prev);
+        }
+
+        // Objects shared with @prev are only serialized once by virtue of
+        // the serializer's shared_ptr handling.
+        template<class Serializer, class T>
+        static void serializeMember(Serializer& serializer,
+                                    ptr_member<T>& member,
+                                    const ptr_member<T>*)
+        {
+            serializer(member);
+        }
+
+        template<class Serializer, class T>
+        static void serializeMember(Serializer& serializer,
+                                    T& member,
+                                    const T* prev)
+        {
+            if (prev == nullptr) {
+                serializer(member);
+                return;
+            }
+
+            bool unchanged = serializer.isSerializing() && (member == *prev);
+            serializer(unchanged);
+            if (!unchanged)
+                serializer(member);
+            else if (!serializer.isSerializing())
+                member = *prev;
+        }
+
         time_point m_start_time{};
         std::optional<time_point> m_end_time{};
 
@@ -19,24 +19,35 @@
 
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 
+#include <opm/common/utility/AppendOnlyArray.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
+
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
+#include <functional>
 #include <iomanip>
 #include <limits>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <set>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -113,60 +124,15 @@ namespace {
             return is_total(key.substr(0,sep_pos));
     }
 
-    template <class T>
-    using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
-
-    template <class T>
-    bool has_var(const map2<T>& values,
-                 const std::string& var1,
-                 const std::string& var2)
-    {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return false;
-
-        const auto& var2_iter = var1_iter->second.find(var2);
-        if (var2_iter == var1_iter->second.end())
-            return false;
-
-        return true;
-    }
-
-    template <class T>
-    void erase_var(map2<T>& values,
-                   std::set<std::string>& var2_set,
-                   const std::string& var1,
-                   const std::string& var2)
+    std::uint64_t next_version()
     {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return;
-
-        var1_iter->second.erase(var2);
-        var2_set.clear();
-        for (const auto& [_, var2_map] : values) {
-            (void)_;
-            for (const auto& [v2, __] : var2_map) {
-                (void)__;
-                var2_set.insert(v2);
-            }
-        }
+        static std::atomic<std::uint64_t> version{0};
+        return ++version;
     }
 
-    template <class T>
-    std::vector<std::string>
-    var2_list(const map2<T>& values, const std::string& var1)
+    std::string variable_name(const std::string& key)
     {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return {};
-
-        std::vector<std::string> l;
-        std::transform(var1_iter->second.begin(), var1_iter->second.end(),
-                       std::back_inserter(l),
-                       [](const auto& pair) { return pair.first; });
-
-        return l;
+        return key.substr(0, key.find(':'));
     }
 
     std::string normalise_region_set_name(const std::string& regSet)
@@ -205,16 +171,416 @@ namespace {
         return node.unique_key();
     }
 
+    enum class Category : unsigned char
+    {
+        Scalar, Well, Group, Connection, Segment, Region,
+    };
+
+    constexpr auto num_categories = std::size_t{6};
+
+    /// Registered summary vector.  Variable and entity names are stored in
+    /// the process wide NameTable.  The full key is stored in the entry
+    /// itself, since there is one key per vector and the NameTable indices
+    /// of well and group names also serve as positions in dense per-well
+    /// and per-group arrays.
+    struct KeyEntry
+    {
+        using KeyId = Opm::SummaryState::KeyId;
+        using Name = Opm::NameTable::Index;
+
+        /// Full summary key, e.g., WOPR:OP1.
+        std::string key{};
+
+        /// Variable, e.g., WOPR.
+        Name var{Opm::NameTable::empty_index};
+
+        /// Well, group, or normalised region set name.  Empty for
+        /// vectors in the general structure.
+        Name entity{Opm::NameTable::empty_index};
+
+        /// Connection (global index), segment, or region number.
+        std::size_t number{0};
+
+        Category category{Category::Scalar};
+
+        /// Whether or not this is a cumulative quantity.
+        bool total{false};
+
+        /// Registry index of 'var'.
+        std::size_t var_index{0};
+
+        /// Identifier of 'key' in the general structure.  Same as the
+        /// entry's own identifier for Category::Scalar.
+        KeyId scalar{0};
+    };
+
+    /// Lookup key of a registered summary vector outside the general
+    /// structure, i.e., of variable, entity and number.  Vectors in the
+    /// general structure are identified by their full key alone.
+    struct EntryKey
+    {
+        Opm::NameTable::Index name{};
+        Opm::NameTable::Index entity{};
+        std::size_t number{};
+
+        bool operator==(const EntryKey& that) const
+        {
+            return (this->name == that.name)
+                && (this->entity == that.entity)
+                && (this->number == that.number);
+        }
+    };
+
+    struct EntryKeyHash
+    {
+        std::size_t operator()(const EntryKey& k) const
+        {
+            // Name indices are small, dense integers.  Multiplicative
+            // mixing spreads them over the full range.
+            constexpr auto mult = std::size_t{0x9e3779b97f4a7c15ULL};
+
+            auto h = k.name;
+            h = h*mult + k.entity;
+            h = h*mult + k.number;
+
+            return h ^ (h >> 29);
+        }
+    };
+
+    const std::string& name_of(const Opm::NameTable::Index name)
+    {
+        return Opm::NameTable::name(name);
+    }
+
+    /// Whether or not a missing value of a vector should be reported as
+    /// the UDQ undefined value.  The 'name' is the full key for
+    /// Category::Scalar and the variable otherwise.
+    bool udq_fallback(const Category cat, const std::string_view name)
+    {
+        switch (cat) {
+        case Category::Scalar:  return is_udq(name);
+        case Category::Well:    return is_well_udq(name);
+        case Category::Group:   return is_group_udq(name);
+        case Category::Segment: return is_segment_udq(name);
+
+        case Category::Connection: [[fallthrough]];
+        case Category::Region:
+            return false;
+        }
+
+        return false;
+    }
+
+    /// Full key for Category::Scalar, variable otherwise.
+    std::string_view query_name(const KeyEntry& entry)
+    {
+        return (entry.category == Category::Scalar)
+            ? std::string_view { entry.key }
+            : std::string_view { name_of(entry.var) };
+    }
+
+    bool udq_fallback(const KeyEntry& entry)
+    {
+        return udq_fallback(entry.category, query_name(entry));
+    }
+
+    std::string_view level_name(const Category cat)
+    {
+        switch (cat) {
+        case Category::Scalar:     return "field";
+        case Category::Well:       return "well";
+        case Category::Group:      return "group";
+        case Category::Connection: return "connection";
+        case Category::Segment:    return "segment";
+        case Category::Region:     return "region";
+        }
+
+        return "unknown";
+    }
+
 } // Anonymous namespace
 
 namespace Opm
 {
 
+    /// Registry of summary vectors.
+    ///
+    /// Shared by a SummaryState object and its copies.  Entries are never
+    /// moved or freed while the registry exists, so entry() can hand out
+    /// references without holding a lock.
+    class SummaryState::KeyTable
+    {
+    public:
+        using Name = NameTable::Index;
+
+        KeyTable() = default;
+        KeyTable(const KeyTable&) = delete;
+        KeyTable& operator=(const KeyTable&) = delete;
+
+        std::uint64_t scope() const
+        {
+            return this->scope_;
+        }
+
+        /// Identifier of vector, or nullopt if the vector has never been
+        /// registered.  Never creates entries, so it is safe to use in
+        /// queries.  The 'name' is the full key for Category::Scalar and
+        /// the variable otherwise.
+        std::optional<KeyId> find(const Category         cat,
+                                  const std::string_view name,
+                                  const std::string_view entity,
+                                  const std::size_t      number) const
+        {
+            if (cat == Category::Scalar) {
+                std::shared_lock lock { this->mutex_ };
+
+                auto pos = this->scalar_index_.find(name);
+                if (pos == this->scalar_index_.end()) {
+                    return std::nullopt;
+                }
+
+                return pos->second;
+            }
+
+            const auto var = NameTable::find(name);
+            const auto ent = NameTable::find(entity);
+            if (! var.has_value() || ! ent.has_value()) {
+                return std::nullopt;
+            }
+
+            return this->find({ *var, *ent, number }, cat);
+        }
+
+        /// Identifier of vector in the general structure, registering it
+        /// if needed.
+        KeyId register_scalar(const std::string& key)
+        {
+            if (auto id = this->find(Category::Scalar, key, "", 0); id.has_value()) {
+                return *id;
+            }
+
+            const auto var = NameTable::index(variable_name(key));
+
+            auto entry = KeyEntry{};
+            entry.key = key;
+            entry.var = var;
+
+            return this->insert(std::move(entry), var);
+        }
+
+        /// Identifier of vector outside the general structure,
+        /// registering it if needed.  The full key is only formatted for
+        /// new vectors.
+        template <typename MakeKey>
+        KeyId register_key(const Category    cat,
+                           const Name        var,
+                           const Name        entity,
+                           const std::size_t number,
+                           MakeKey&&         make_key)
+        {
+            if (auto id = this->find({ var, entity, number }, cat); id.has_value()) {
+                return *id;
+            }
+
+            auto entry = KeyEntry{};
+            entry.key = make_key();
+            entry.var = var;
+            entry.entity = entity;
+            entry.number = number;
+            entry.category = cat;
+
+            const auto scalar_var = NameTable::index(variable_name(entry.key));
+
+            return this->insert(std::move(entry), scalar_var);
+        }
+
+        /// Identifier in this registry of vector 'id' of registry 'other',
+        /// registering it if needed.
+        KeyId import(const KeyTable& other, const KeyId id)
+        {
+            const auto& from = other.entry(id);
+
+            auto entry = KeyEntry{};
+            entry.key = from.key;
+            entry.var = from.var;
+            entry.entity = from.entity;
+            entry.number = from.number;
+            entry.category = from.category;
+
+            return this->insert(std::move(entry), other.entry(from.scalar).var);
+        }
+
+        const KeyEntry& entry(const KeyId id) const
+        {
+            if (id >= this->size()) {
+                throw std::out_of_range {
+                    fmt::format("Summary key identifier {} is not assigned", id)
+                };
+            }
+
+            return this->entries_[id];
+        }
+
+        std::optional<std::size_t> find_var(const Name var) const
+        {
+            std::shared_lock lock { this->mutex_ };
+
+            auto pos = this->var_index_.find(var);
+            if (pos == this->var_index_.end()) {
+                return std::nullopt;
+            }
+
+            return pos->second;
+        }
+
+        /// Whether or not any registered vector of a particular kind and
+        /// variable, e.g., any WOPR vector at the well level, satisfies
+        /// 'pred'.  Vectors are visited in registration order while holding
+        /// a shared lock, so 'pred' must not register new vectors.
+        template <typename Predicate>
+        bool any_var_key(const Category cat, const Name var, Predicate&& pred) const
+        {
+            std::shared_lock lock { this->mutex_ };
+
+            auto pos = this->var_index_.find(var);
+            if (pos == this->var_index_.end()) {
+                return false;
+            }
+
+            const auto& ids = this->var_keys_[pos->second][static_cast<std::size_t>(cat)];
+            return std::any_of(ids.begin(), ids.end(), std::forward<Predicate>(pred));
+        }
+
+        /// Same as any_var_key(), for all vectors of a particular kind.
+        template <typename Predicate>
+        bool any_key(const Category cat, Predicate&& pred) const
+        {
+            std::shared_lock lock { this->mutex_ };
+
+            const auto& ids = this->category_keys_[static_cast<std::size_t>(cat)];
+            return std::any_of(ids.begin(), ids.end(), std::forward<Predicate>(pred));
+        }
+
+        /// Whether or not any segment vector of variable 'var' for well
+        /// 'well' satisfies 'is_present'.
+        template <typename IsPresent>
+        bool any_segment_of_well(const Name var, const Name well, IsPresent&& is_present) const
+        {
+            return this->any_var_key(Category::Segment, var,
+                                     [this, &is_present, well](const KeyId other)
+            {
+                return is_present(other) && (this->entry(other).entity == well);
+            });
+        }
+
+        std::size_t size() const
+        {
+            return this->entries_.size();
+        }
+
+    private:
+        /// Distinguishes this registry's identifiers from those of all
+        /// other registries.  Stamps are never reused.
+        const std::uint64_t scope_ { next_version() };
+
+        mutable std::shared_mutex mutex_{};
+
+        /// Keys are views of the full keys stored in 'entries_'.
+        std::unordered_map<std::string_view, KeyId> scalar_index_{};
+        std::array<std::unordered_map<EntryKey, KeyId, EntryKeyHash>, num_categories> index_{};
+        std::unordered_map<Name, std::size_t> var_index_{};
+        std::vector<std::array<std::vector<KeyId>, num_categories>> var_keys_{};
+        std::array<std::vector<KeyId>, num_categories> category_keys_{};
+        AppendOnlyArray<KeyEntry> entries_{};
+
+        /// Vectors outside the general structure only.
+        std::optional<KeyId> find(const EntryKey& key, const Category cat) const
+        {
+            std::shared_lock lock { this->mutex_ };
+
+            const auto& index = this->index_[static_cast<std::size_t>(cat)];
+            auto pos = index.find(key);
+            if (pos == index.end()) {
+                return std::nullopt;
+            }
+
+            return pos->second;
+        }
+
+        /// Register vector.  The general structure counterpart of
+        /// non-scalar vectors gets the variable 'scalar_var'.
+        KeyId insert(KeyEntry&& entry, const Name scalar_var)
+        {
+            std::unique_lock lock { this->mutex_ };
+
+            return this->insert_locked(std::move(entry), scalar_var);
+        }
+
+        /// Caller holds exclusive lock.
+        KeyId insert_locked(KeyEntry&& entry, const Name scalar_var)
+        {
+            const auto cat = static_cast<std::size_t>(entry.category);
+            const auto key = EntryKey { entry.var, entry.entity, entry.number };
+
+            if (entry.category == Category::Scalar) {
+                if (auto pos = this->scalar_index_.find(entry.key);
+                    pos != this->scalar_index_.end())
+                {
+                    return pos->second;
+                }
+            }
+            else if (auto pos = this->index_[cat].find(key);
+                     pos != this->index_[cat].end())
+            {
+                return pos->second;
+            }
+
+            if (entry.category != Category::Scalar) {
+                auto scalar = KeyEntry{};
+                scalar.key = entry.key;
+                scalar.var = scalar_var;
+
+                entry.scalar = this->insert_locked(std::move(scalar), scalar_var);
+            }
+
+            const auto id = this->entries_.size();
+
+            if (entry.category == Category::Scalar) {
+                entry.scalar = id;
+            }
+
+            entry.total = is_total(NameTable::name(entry.var));
+
+            auto [varPos, inserted] = this->var_index_
+                .try_emplace(entry.var, this->var_keys_.size());
+            if (inserted) {
+                this->var_keys_.emplace_back();
+            }
+
+            entry.var_index = varPos->second;
+            this->var_keys_[entry.var_index][cat].push_back(id);
+            this->category_keys_[cat].push_back(id);
+
+            const auto& stored = this->entries_.push_back(std::move(entry));
+
+            if (stored.category == Category::Scalar) {
+                this->scalar_index_.emplace(stored.key, id);
+            }
+            else {
+                this->index_[cat].emplace(key, id);
+            }
+
+            return id;
+        }
+    };
+
     SummaryState::SummaryState(const time_point sim_start_arg,
                                const double     udqUndefined)
         : sim_start     { sim_start_arg }
         , udq_undefined { udqUndefined }
+        , keys_         { std::make_shared<KeyTable>() }
     {
+        this->reset_versions();
         this->update_elapsed(0);
     }
 
@@ -223,13 +589,109 @@ namespace Opm
                          std::numeric_limits<double>::lowest() }
     {}
 
+    std::uint64_t SummaryState::key_scope() const
+    {
+        return this->keys_->scope();
+    }
+
+    SummaryState::KeyId SummaryState::key_id(const std::string& key) const
+    {
+        return this->keys_->register_scalar(key);
+    }
+
+    SummaryState::KeyId
+    SummaryState::well_key_id(const std::string& well,
+                              const std::string& var) const
+    {
+        return this->well_key_id(NameTable::index(well), NameTable::index(var));
+    }
+
+    SummaryState::KeyId
+    SummaryState::well_key_id(const NameTable::Index well,
+                              const NameTable::Index var) const
+    {
+        return this->keys_->register_key(Category::Well, var, well, 0, [well, var]()
+        {
+            return fmt::format("{}:{}", name_of(var), name_of(well));
+        });
+    }
+
+    SummaryState::KeyId
+    SummaryState::group_key_id(const std::string& group,
+                               const std::string& var) const
+    {
+        return this->group_key_id(NameTable::index(group), NameTable::index(var));
+    }
+
+    SummaryState::KeyId
+    SummaryState::group_key_id(const NameTable::Index group,
+                               const NameTable::Index var) const
+    {
+        return this->keys_->register_key(Category::Group, var, group, 0, [group, var]()
+        {
+            return fmt::format("{}:{}", name_of(var), name_of(group));
+        });
+    }
+
+    SummaryState::KeyId
+    SummaryState::conn_key_id(const std::string& well,
+                              const std::string& var,
+                              const std::size_t  global_index) const
+    {
+        return this->keys_->register_key(Category::Connection,
+                                         NameTable::index(var), NameTable::index(well), global_index,
+                                         [&well, &var, global_index]()
+                                         {
+                                             return fmt::format("{}:{}:{}", var, well, global_index);
+                                         });
+    }
+
+    SummaryState::KeyId
+    SummaryState::segment_key_id(const std::string& well,
+                                 const std::string& var,
+                                 const std::size_t  segment) const
+    {
+        return this->keys_->register_key(Category::Segment,
+                                         NameTable::index(var), NameTable::index(well), segment,
+                                         [&well, &var, segment]()
+                                         {
+                                             return fmt::format("{}:{}:{}", var, well, segment);
+                                         });
+    }
+
+    SummaryState::KeyId
+    SummaryState::region_key_id(const std::string& regSet,
+                                const std::string& var,
+                                const std::size_t  region) const
+    {
+        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
+        const auto set = normalise_region_set_name(regSet);
+
+        return this->keys_->register_key(Category::Region,
+                                         NameTable::index(regKw), NameTable::index(set), region,
+                                         [&regKw, &set, region]()
+                                         {
+                                             return region_key(regKw, set, region);
+                                         });
+    }
+
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
+        const auto id = key_id(key);
+
+        this->assign_present(id, value);
+        this->touch(this->keys_->entry(id).var_index);
     }
 
-    bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+    bool SummaryState::erase(const std::string& key)
+    {
+        const auto id = this->keys_->find(Category::Scalar, key, "", 0);
+        if (! id.has_value() || ! this->clear_present(*id)) {
+            return false;
+        }
+
+        this->touch(this->keys_->entry(*id).var_index);
+        return true;
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
@@ -238,7 +700,23 @@ namespace Opm
         if (!this->erase(key))
             return false;
 
-        erase_var(this->well_values, this->m_wells, var, well);
+        if (const auto well_id = this->keys_->find(Category::Well, var, well, 0);
+            well_id.has_value() && this->clear_present(*well_id))
+        {
+            // Only well level vectors need to be visited to decide whether
+            // the well still has any variables.
+            const auto entity = this->keys_->entry(*well_id).entity;
+            const auto has_vars = this->keys_->any_key(Category::Well,
+                                                       [this, entity](const KeyId id)
+            {
+                return this->is_present(id) && (this->keys_->entry(id).entity == entity);
+            });
+
+            if (! has_vars) {
+                this->m_wells.erase(well);
+            }
+        }
+
         this->well_names.reset();
         return true;
     }
@@ -249,149 +727,338 @@ namespace Opm
         if (!this->erase(key))
             return false;
 
-        erase_var(this->group_values, this->m_groups, var, group);
+        if (const auto group_id = this->keys_->find(Category::Group, var, group, 0);
+            group_id.has_value() && this->clear_present(*group_id))
+        {
+            // Only group level vectors need to be visited to decide whether
+            // the group still has any variables.
+            const auto entity = this->keys_->entry(*group_id).entity;
+            const auto has_vars = this->keys_->any_key(Category::Group,
+                                                       [this, entity](const KeyId id)
+            {
+                return this->is_present(id) && (this->keys_->entry(id).entity == entity);
+            });
+
+            if (! has_vars) {
+                this->m_groups.erase(group);
+            }
+        }
+
         this->group_names.reset();
         return true;
     }
 
+    /// Summary vector named in a query.  Need not be registered.
+    struct SummaryState::VectorName
+    {
+        Category category{Category::Scalar};
+
+        /// Full key, e.g., FOPT, for Category::Scalar.  Variable, e.g.,
+        /// WOPR, otherwise.
+        std::string_view name{};
+
+        /// Well, group, or normalised region set name.
+        std::string_view entity{};
+
+        /// Connection (global index), segment, or region number.
+        std::size_t number{0};
+    };
+
     bool SummaryState::has(const std::string& key) const
     {
-        return (this->values.find(key) != this->values.end()) || is_udq(key);
+        return this->has_vector({ Category::Scalar, key });
     }
 
     bool SummaryState::has_well_var(const std::string& well,
                                     const std::string& var) const
     {
-        return has_var(this->well_values, var, well)
-            || is_well_udq(var);
+        return this->has_vector({ Category::Well, var, well });
     }
 
     bool SummaryState::has_well_var(const std::string& var) const
     {
-        return (this->well_values.count(var) != 0) || is_well_udq(var);
+        if (is_well_udq(var)) {
+            return true;
+        }
+
+        const auto name = NameTable::find(var);
+        return name.has_value()
+            && this->keys_->any_var_key(Category::Well, *name,
+                                       [this](const KeyId id) { return this->is_present(id); });
     }
 
     bool SummaryState::has_group_var(const std::string& group,
                                      const std::string& var) const
     {
-        return has_var(this->group_values, var, group) || is_group_udq(var);
+        return this->has_vector({ Category::Group, var, group });
     }
 
     bool SummaryState::has_group_var(const std::string& var) const
     {
-        return (this->group_values.count(var) != 0) || is_group_udq(var);
+        if (is_group_udq(var)) {
+            return true;
+        }
+
+        const auto name = NameTable::find(var);
+        return name.has_value()
+            && this->keys_->any_var_key(Category::Group, *name,
+                                       [this](const KeyId id) { return this->is_present(id); });
     }
 
     bool SummaryState::has_conn_var(const std::string& well,
                                     const std::string& var,
                                     const std::size_t  global_index) const
     {
-        // Connection Values = [var][well][index] -> double
+        return this->has_vector({ Category::Connection, var, well, global_index });
+    }
 
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
-            return false;
+    bool SummaryState::has_segment_var(const std::string& well,
+                                       const std::string& var,
+                                       const std::size_t  segment) const
+    {
+        return this->has_vector({ Category::Segment, var, well, segment });
+    }
+
+    bool SummaryState::has_region_var(const std::string& regSet,
+                                      const std::string& var,
+                                      const std::size_t  region) const
+    {
+        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
+        const auto set = normalise_region_set_name(regSet);
+
+        return this->has_vector({ Category::Region, regKw, set, region });
+    }
+
+    bool SummaryState::has_value(const KeyId id) const
+    {
+        if (this->is_present(id)) {
+            return true;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto& entry = this->keys_->entry(id);
+        if (! udq_fallback(entry)) {
             return false;
         }
 
-        return wellPos->second.find(global_index) != wellPos->second.end();
+        // Segment level UDQs are only reported for wells which have at
+        // least one segment value for the same quantity.
+        return (entry.category != Category::Segment)
+            || this->keys_->any_segment_of_well(entry.var, entry.entity,
+                                   [this](const KeyId other) { return this->is_present(other); });
     }
 
-    bool SummaryState::has_segment_var(const std::string& well,
-                                       const std::string& var,
-                                       const std::size_t  segment) const
+    bool SummaryState::has_vector(const VectorName& vector) const
     {
-        // Segment Values = [var][well][segment] -> double
+        if (const auto id = this->keys_->find(vector.category, vector.name,
+                                     vector.entity, vector.number);
+            id.has_value())
+        {
+            return this->has_value(*id);
+        }
 
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
+        if (! udq_fallback(vector.category, vector.name)) {
             return false;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return false;
+        if (vector.category != Category::Segment) {
+            return true;
         }
 
-        return (wellPos->second.find(segment) != wellPos->second.end())
-            || is_segment_udq(var);
+        const auto var = NameTable::find(vector.name);
+        const auto well = NameTable::find(vector.entity);
+
+        return var.has_value() && well.has_value()
+            && this->keys_->any_segment_of_well(*var, *well,
+                                   [this](const KeyId other) { return this->is_present(other); });
     }
 
-    bool SummaryState::has_region_var(const std::string& regSet,
-                                      const std::string& var,
-                                      const std::size_t  region) const
+    void SummaryState::update_value(const KeyId id, const double value)
     {
-        // Region Values = [var][regSet][region] -> double
+        const auto& entry = this->keys_->entry(id);
 
-        auto varPos = this->region_values.find(EclIO::SummaryNode::normalise_region_keyword(var));
-        if (varPos == this->region_values.end()) {
-            return false;
+        auto accumulate = [&entry, value](const double prev)
+        {
+            return entry.total ? prev + value : value;
+        };
+
+        if (entry.category != Category::Scalar) {
+            // Specialised structures are also reflected in the general
+            // structure.
+            const auto prev = this->is_present(entry.scalar)
+                ? this->values[entry.scalar] : 0.0;
+
+            this->assign_present(entry.scalar, accumulate(prev));
         }
 
-        auto regSetPos = varPos->second.find(normalise_region_set_name(regSet));
-        if (regSetPos == varPos->second.end()) {
-            return false;
+        const auto inserted = ! this->is_present(id);
+        const auto prev = inserted ? 0.0 : this->values[id];
+        const auto next = accumulate(prev);
+
+        this->assign_present(id, next);
+
+        if (inserted || (next != prev)) {
+            this->touch(entry.var_index);
+        }
+
+        if (! inserted) {
+            return;
+        }
+
+        if (entry.category == Category::Well) {
+            if (this->m_wells.insert(name_of(entry.entity)).second) {
+                this->well_names.reset();
+            }
+        }
+        else if (entry.category == Category::Group) {
+            if (this->m_groups.insert(name_of(entry.entity)).second) {
+                this->group_names.reset();
+            }
+        }
+    }
+
+    double SummaryState::get_value(const KeyId id) const
+    {
+        if (this->is_present(id)) {
+            return this->values[id];
         }
 
-        return regSetPos->second.find(region) != regSetPos->second.end();
+        const auto& entry = this->keys_->entry(id);
+        if (udq_fallback(entry)) {
+            return this->udq_undefined;
+        }
+
+        this->throw_missing({
+            entry.category,
+            query_name(entry),
+            name_of(entry.entity),
+            entry.number
+        });
     }
 
-    void SummaryState::update(const std::string& key, double value)
+    double SummaryState::get_vector(const VectorName& vector) const
     {
-        auto& val_ref = this->values[key];
+        if (const auto id = this->keys_->find(vector.category, vector.name,
+                                     vector.entity, vector.number);
+            id.has_value())
+        {
+            return this->get_value(*id);
+        }
 
-        if (is_total(key)) {
-            val_ref += value;
+        if (udq_fallback(vector.category, vector.name)) {
+            return this->udq_undefined;
         }
-        else {
-            val_ref = value;
+
+        this->throw_missing(vector);
+    }
+
+    double SummaryState::get_vector(const VectorName& vector,
+                                    const double      default_value) const
+    {
+        if (const auto id = this->keys_->find(vector.category, vector.name,
+                                     vector.entity, vector.number);
+            id.has_value())
+        {
+            return this->get_value(*id, default_value);
         }
+
+        return udq_fallback(vector.category, vector.name)
+            ? this->udq_undefined
+            : default_value;
+    }
+
+    void SummaryState::throw_missing(const VectorName& vector) const
+    {
+        if (vector.category == Category::Scalar) {
+            throw std::out_of_range {
+                fmt::format("Summary vector {} is unknown", vector.name)
+            };
+        }
+
+        auto var_exists = false;
+        auto entity_exists = false;
+
+        const auto var = NameTable::find(vector.name);
+        const auto entity = NameTable::find(vector.entity);
+        if (var.has_value()) {
+            this->keys_->any_var_key(vector.category, *var,
+                                    [this, &entity, &var_exists, &entity_exists](const KeyId other)
+            {
+                if (this->is_present(other)) {
+                    var_exists = true;
+                    entity_exists = entity.has_value()
+                        && (this->keys_->entry(other).entity == *entity);
+                }
+
+                return entity_exists;
+            });
+        }
+
+        const auto level = level_name(vector.category);
+
+        if (! var_exists) {
+            throw std::invalid_argument {
+                fmt::format("Summary vector {} does not "
+                            "exist at the {} level", vector.name, level)
+            };
+        }
+
+        if (! entity_exists || (vector.category == Category::Well) ||
+            (vector.category == Category::Group))
+        {
+            const auto* entity_kind = (vector.category == Category::Group)
+                ? "group" : (vector.category == Category::Region)
+                ? "region set" : "well";
+
+            throw std::invalid_argument {
+                fmt::format("Summary vector {} does not "
+                            "exist at the {} level for {} {}",
+                            vector.name, level, entity_kind, vector.entity)
+            };
+        }
+
+        const auto* item_kind = (vector.category == Category::Connection)
+            ? "connection" : (vector.category == Category::Segment)
+            ? "segment" : "region";
+
+        const auto* entity_kind = (vector.category == Category::Region)
+            ? "region set" : "well";
+
+        throw std::invalid_argument {
+            fmt::format("Summary vector {} does not "
+                        "exist for {} {} in {} {}",
+                        vector.name, item_kind, vector.number,
+                        entity_kind, vector.entity)
+        };
+    }
+
+    double SummaryState::get_value(const KeyId id, const double default_value) const
+    {
+        if (this->is_present(id)) {
+            return this->values[id];
+        }
+
+        return udq_fallback(this->keys_->entry(id))
+            ? this->udq_undefined
+            : default_value;
+    }
+
+    void SummaryState::update(const std::string& key, double value)
+    {
+        this->update_value(key_id(key), value);
     }
 
     void SummaryState::update_well_var(const std::string& well,
                                        const std::string& var,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            wval_ref += value;
-        }
-        else {
-            val_ref = wval_ref = value;
-        }
-
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+        this->update_value(well_key_id(well, var), value);
     }
 
     void SummaryState::update_group_var(const std::string& group,
                                         const std::string& var,
                                         const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            gval_ref += value;
-        }
-        else {
-            val_ref = gval_ref = value;
-        }
-
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
-        }
+        this->update_value(group_key_id(group, var), value);
     }
 
     void SummaryState::update_elapsed(double delta)
@@ -431,16 +1098,7 @@ namespace Opm
                                        const std::size_t  global_index,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, global_index)];
-        auto& cval_ref = this->conn_values[var][well][global_index];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            cval_ref += value;
-        }
-        else {
-            val_ref = cval_ref = value;
-        }
+        this->update_value(conn_key_id(well, var, global_index), value);
     }
 
     void SummaryState::update_segment_var(const std::string& well,
@@ -448,16 +1106,7 @@ namespace Opm
                                           const std::size_t  segment,
                                           const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, segment)];
-        auto& sval_ref = this->segment_values[var][well][segment];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            sval_ref += value;
-        }
-        else {
-            val_ref = sval_ref = value;
-        }
+        this->update_value(segment_key_id(well, var, segment), value);
     }
 
     void SummaryState::update_region_var(const std::string& regSet,
@@ -465,49 +1114,18 @@ namespace Opm
                                          const std::size_t  region,
                                          const double       value)
     {
-        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
-
-        auto& val_ref  = this->values[region_key(regKw, regSet, region)];
-        auto& rval_ref = this->region_values[regKw][normalise_region_set_name(regSet)][region];
-
-        if (is_total(regKw)) {
-            val_ref  += value;
-            rval_ref += value;
-        }
-        else {
-            val_ref = rval_ref = value;
-        }
+        this->update_value(region_key_id(regSet, var, region), value);
     }
 
     double SummaryState::get(const std::string& key) const
     {
-        auto iter = this->values.find(key);
-        if (iter != this->values.end()) {
-            return iter->second;
-        }
-
-        if (is_udq(key)) {
-            return this->udq_undefined;
-        }
-
-        throw std::out_of_range {
-            fmt::format("Summary vector {} is unknown", key)
-        };
+        return this->get_vector({ Category::Scalar, key });
     }
 
     double SummaryState::get(const std::string& key,
                              const double       default_value) const
     {
-        auto iter = this->values.find(key);
-        if (iter != this->values.end()) {
-            return iter->second;
-        }
-
-        if (is_udq(key)) {
-            return this->udq_undefined;
-        }
-
-        return default_value;
+        return this->get_vector({ Category::Scalar, key }, default_value);
     }
 
     double SummaryState::get_elapsed() const
@@ -518,224 +1136,51 @@ namespace Opm
     double SummaryState::get_well_var(const std::string& well,
                                       const std::string& var) const
     {
-        const auto use_udq_fallback = is_well_udq(var);
-
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
-            if (! use_udq_fallback) {
-                throw std::invalid_argument {
-                    fmt::format("Summary vector {} does not "
-                                "exist at the well level", var)
-                };
-            }
-
-            return this->udq_undefined;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            if (! use_udq_fallback) {
-                throw std::invalid_argument {
-                    fmt::format("Summary vector {} does not "
-                                "exist at the well level for well {}",
-                                var, well)
-                };
-            }
-
-            return this->udq_undefined;
-        }
-
-        return wellPos->second;
+        return this->get_vector({ Category::Well, var, well });
     }
 
     double SummaryState::get_group_var(const std::string& group,
                                        const std::string& var) const
     {
-        const auto use_udq_fallback = is_group_udq(var);
-
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
-            if (! use_udq_fallback) {
-                throw std::invalid_argument {
-                    fmt::format("Summary vector {} does not "
-                                "exist at the group level", var)
-                };
-            }
-
-            return this->udq_undefined;
-        }
-
-        auto groupPos = varPos->second.find(group);
-        if (groupPos == varPos->second.end()) {
-            if (! use_udq_fallback) {
-                throw std::invalid_argument {
-                    fmt::format("Summary vector {} does not "
-                                "exist at the group level for group {}",
-                                var, group)
-                };
-            }
-
-            return this->udq_undefined;
-        }
-
-        return groupPos->second;
+        return this->get_vector({ Category::Group, var, group });
     }
 
     double SummaryState::get_conn_var(const std::string& well,
                                       const std::string& var,
                                       const std::size_t  global_index) const
     {
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
-            throw std::invalid_argument {
-                fmt::format("Summary vector {} does not "
-                            "exist at the connection level", var)
-            };
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            throw std::invalid_argument {
-                fmt::format("Summary vector {} does not "
-                            "exist at the connection "
-                            "level for well {}",
-                            var, well)
-            };
-        }
-
-        auto connPos = wellPos->second.find(global_index);
-        if (connPos == wellPos->second.end()) {
-            throw std::invalid_argument {
-                fmt::format("Summary vector {} does not "
-                            "exist for connection {} "
-                            "in well {}",
-                            var, global_index, well)
-            };
-        }
-
-        return connPos->second;
+        return this->get_vector({ Category::Connection, var, well, global_index });
     }
 
     double SummaryState::get_segment_var(const std::string& well,
                                          const std::string& var,
                                          const std::size_t  segment) const
     {
-        const auto use_udq_fallback = is_segment_udq(var);
-
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            if (! use_udq_fallback) {
-                throw std::invalid_argument {
-                    fmt::format("Summary vector {} does not "
-                                "exist at the segment level", var)
-                };
-            }
-
-            return this->udq_undefined;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            if (! use_udq_fallback) {
-                throw std::invalid_argument {
-                    fmt::format("Summary vector {} does not "
-                                "exist at the segment "
-                                "level for well {}",
-                                var, well)
-                };
-            }
-
-            return this->udq_undefined;
-        }
-
-        auto segPos = wellPos->second.find(segment);
-        if (segPos == wellPos->second.end()) {
-            if (! use_udq_fallback) {
-                throw std::invalid_argument {
-                    fmt::format("Summary vector {} does not "
-                                "exist for segment {} "
-                                "in well {}",
-                                var, segment, well)
-                };
-            }
-
-            return this->udq_undefined;
-        }
-
-        return segPos->second;
+        return this->get_vector({ Category::Segment, var, well, segment });
     }
 
     double SummaryState::get_region_var(const std::string& regSet,
                                         const std::string& var,
                                         const std::size_t  region) const
     {
-        auto varPos = this->region_values.find(EclIO::SummaryNode::normalise_region_keyword(var));
-        if (varPos == this->region_values.end()) {
-            throw std::invalid_argument {
-                fmt::format("Summary vector {} does not "
-                            "exist at the region level", var)
-            };
-        }
-
-        auto regSetPos = varPos->second.find(normalise_region_set_name(regSet));
-        if (regSetPos == varPos->second.end()) {
-            throw std::invalid_argument {
-                fmt::format("Summary vector {} does not "
-                            "exist at the region "
-                            "level for region set {}",
-                            var, regSet)
-            };
-        }
-
-        auto regionPos = regSetPos->second.find(region);
-        if (regionPos == regSetPos->second.end()) {
-            throw std::invalid_argument {
-                fmt::format("Summary vector {} does not "
-                            "exist for region {} "
-                            "in region set {}",
-                            var, region, regSet)
-            };
-        }
+        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
+        const auto set = normalise_region_set_name(regSet);
 
-        return regionPos->second;
+        return this->get_vector({ Category::Region, regKw, set, region });
     }
 
     double SummaryState::get_well_var(const std::string& well,
                                       const std::string& var,
                                       const double       default_value) const
     {
-        const auto fallback = is_well_udq(var)
-            ? this->udq_undefined
-            : default_value;
-
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
-            return fallback;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        return (wellPos == varPos->second.end())
-            ? fallback
-            : wellPos->second;
+        return this->get_vector({ Category::Well, var, well }, default_value);
     }
 
     double SummaryState::get_group_var(const std::string& group,
                                        const std::string& var,
                                        const double       default_value) const
     {
-        const auto fallback = is_group_udq(var)
-            ? this->udq_undefined
-            : default_value;
-
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
-            return fallback;
-        }
-
-        auto groupPos = varPos->second.find(group);
-        return (groupPos == varPos->second.end())
-            ? fallback
-            : groupPos->second;
+        return this->get_vector({ Category::Group, var, group }, default_value);
     }
 
     double SummaryState::get_conn_var(const std::string& well,
@@ -743,20 +1188,7 @@ namespace Opm
                                       const std::size_t  global_index,
                                       const double       default_value) const
     {
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
-            return default_value;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
-        }
-
-        auto connPos = wellPos->second.find(global_index);
-        return (connPos == wellPos->second.end())
-            ? default_value
-            : connPos->second;
+        return this->get_vector({ Category::Connection, var, well, global_index }, default_value);
     }
 
     double SummaryState::get_segment_var(const std::string& well,
@@ -764,20 +1196,18 @@ namespace Opm
                                          const std::size_t  segment,
                                          const double       default_value) const
     {
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return default_value;
-        }
+        return this->get_vector({ Category::Segment, var, well, segment }, default_value);
+    }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
-        }
+    double SummaryState::get_region_var(const std::string& regSet,
+                                        const std::string& var,
+                                        const std::size_t  region,
+                                        const double       default_value) const
+    {
+        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
+        const auto set = normalise_region_set_name(regSet);
 
-        auto valPos = wellPos->second.find(segment);
-        return (valPos == wellPos->second.end())
-            ? default_value
-            : valPos->second;
+        return this->get_vector({ Category::Region, regKw, set, region }, default_value);
     }
 
     const std::vector<std::string>& SummaryState::wells() const
@@ -791,7 +1221,20 @@ namespace Opm
 
     std::vector<std::string> SummaryState::wells(const std::string& var) const
     {
-        return var2_list(this->well_values, var);
+        auto wells = std::vector<std::string>{};
+
+        if (const auto name = NameTable::find(var); name.has_value()) {
+            this->keys_->any_var_key(Category::Well, *name, [this, &wells](const KeyId id)
+            {
+                if (this->is_present(id)) {
+                    wells.push_back(name_of(this->keys_->entry(id).entity));
+                }
+
+                return false;
+            });
+        }
+
+        return wells;
     }
 
     const std::vector<std::string>& SummaryState::groups() const
@@ -805,44 +1248,104 @@ namespace Opm
 
     std::vector<std::string> SummaryState::groups(const std::string& var) const
     {
-        return var2_list(this->group_values, var);
+        auto groups = std::vector<std::string>{};
+
+        if (const auto name = NameTable::find(var); name.has_value()) {
+            this->keys_->any_var_key(Category::Group, *name, [this, &groups](const KeyId id)
+            {
+                if (this->is_present(id)) {
+                    groups.push_back(name_of(this->keys_->entry(id).entity));
+                }
+
+                return false;
+            });
+        }
+
+        return groups;
     }
 
     void SummaryState::append(const SummaryState& buffer)
     {
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
-        this->values = buffer.values;
         this->well_names.reset();
         this->group_names.reset();
 
         this->m_wells.insert(buffer.m_wells.begin(), buffer.m_wells.end());
-        for (const auto& [var, vals] : buffer.well_values) {
-            this->well_values.insert_or_assign(var, vals);
-        }
-
         this->m_groups.insert(buffer.m_groups.begin(), buffer.m_groups.end());
-        for (const auto& [var, vals] : buffer.group_values) {
-            this->group_values.insert_or_assign(var, vals);
+
+        // The general structure is replaced in its entirety.  Well, group,
+        // connection, and segment level variables present in 'buffer'
+        // replace the same variables in *this.  Region level values are
+        // left untouched.
+        auto replaced = [](const KeyEntry& entry)
+        {
+            return (entry.category == Category::Well)
+                || (entry.category == Category::Group)
+                || (entry.category == Category::Connection)
+                || (entry.category == Category::Segment);
+        };
+
+        // Variables are compared by name, since 'buffer' need not share
+        // this object's key registry.
+        auto replaced_vars = std::set<std::pair<Category, NameTable::Index>>{};
+        for (auto id = 0*buffer.present.size(); id < buffer.present.size(); ++id) {
+            const auto& entry = buffer.keys_->entry(id);
+            if (buffer.present[id] && replaced(entry)) {
+                replaced_vars.emplace(entry.category, entry.var);
+            }
         }
 
-        for (const auto& [var, vals] : buffer.conn_values) {
-            this->conn_values.insert_or_assign(var, vals);
+        for (auto id = 0*this->present.size(); id < this->present.size(); ++id) {
+            const auto& entry = this->keys_->entry(id);
+            if ((entry.category == Category::Scalar) ||
+                (replaced_vars.count({ entry.category, entry.var }) > 0))
+            {
+                this->clear_present(id);
+            }
         }
 
-        for (const auto& [var, vals] : buffer.segment_values) {
-            this->segment_values.insert_or_assign(var, vals);
+        const auto same_keys = buffer.keys_ == this->keys_;
+
+        for (auto id = 0*buffer.present.size(); id < buffer.present.size(); ++id) {
+            const auto& entry = buffer.keys_->entry(id);
+            if (buffer.present[id] &&
+                ((entry.category == Category::Scalar) || replaced(entry)))
+            {
+                const auto this_id = same_keys
+                    ? id : this->keys_->import(*buffer.keys_, id);
+
+                this->assign_present(this_id, buffer.values[id]);
+            }
         }
+
+        this->reset_versions();
     }
 
     SummaryState::const_iterator SummaryState::begin() const
     {
-        return this->values.begin();
+        return { this, 0 };
     }
 
     SummaryState::const_iterator SummaryState::end() const
     {
-        return this->values.end();
+        return { this, this->present.size() };
+    }
+
+    std::uint64_t SummaryState::var_version(const std::string& var) const
+    {
+        const auto name = NameTable::find(var);
+        const auto var_index = name.has_value()
+            ? this->keys_->find_var(*name) : std::nullopt;
+
+        if (! var_index.has_value() ||
+            (*var_index >= this->var_versions.size()) ||
+            (this->var_versions[*var_index] == 0))
+        {
+            return this->base_version;
+        }
+
+        return this->var_versions[*var_index];
     }
 
     std::size_t SummaryState::num_wells() const
@@ -852,7 +1355,7 @@ namespace Opm
 
     std::size_t SummaryState::size() const
     {
-        return this->values.size();
+        return this->num_values;
     }
 
     bool SummaryState::operator==(const SummaryState& other) const
@@ -860,16 +1363,11 @@ namespace Opm
         return (this->sim_start == other.sim_start)
             && (this->udq_undefined == other.udq_undefined)
             && (this->elapsed == other.elapsed)
-            && (this->values == other.values)
-            && (this->well_values == other.well_values)
+            && (this->named_values() == other.named_values())
             && (this->m_wells == other.m_wells)
             && (this->wells() == other.wells())
-            && (this->group_values == other.group_values)
             && (this->m_groups == other.m_groups)
             && (this->groups() == other.groups())
-            && (this->conn_values == other.conn_values)
-            && (this->segment_values == other.segment_values)
-            && (this->region_values == other.region_values)
             ;
     }
 
@@ -877,18 +1375,20 @@ namespace Opm
     {
         auto st = SummaryState{TimeService::from_time_t(101), 1.234};
 
+        auto named = NamedValues{};
+
         st.elapsed = 1.0;
-        st.values = {{"test1", 2.0}};
-        st.well_values = {{"test2", {{"test3", 3.0}}}};
+        named.values = {{"test1", 2.0}};
+        named.well_values = {{"test2", {{"test3", 3.0}}}};
         st.m_wells = {"test4"};
         st.well_names = {"test5"};
-        st.group_values = {{"test6", {{"test7", 4.0}}}},
+        named.group_values = {{"test6", {{"test7", 4.0}}}},
         st.m_groups = {"test7"};
         st.group_names = {"test8"},
-        st.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
+        named.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
 
         {
-            auto& sval = st.segment_values["SU1"];
+            auto& sval = named.segment_values["SU1"];
             sval.emplace("W1", std::unordered_map<std::size_t, double> {
                     { std::size_t{ 1},  123.456   },
                     { std::size_t{ 2},   17.29    },
@@ -901,7 +1401,7 @@ namespace Opm
         }
 
         {
-            auto& sval = st.segment_values["SUVIS"];
+            auto& sval = named.segment_values["SUVIS"];
             sval.emplace("I2", std::unordered_map<std::size_t, double> {
                     { std::size_t{17},  29.0   },
                     { std::size_t{42}, - 1.618 },
@@ -909,22 +1409,234 @@ namespace Opm
         }
 
         {
-            auto& rval = st.region_values["ROPT"]["NUM"];
+            auto& rval = named.region_values["ROPT"]["NUM"];
             rval.emplace(12, 34.56);
             rval.emplace(3,  14.15926);
         }
 
         {
-            auto& rval = st.region_values["RGPR"];
+            auto& rval = named.region_values["RGPR"];
             rval.try_emplace("RE2", std::unordered_map<std::size_t, double> {
                     { std::size_t{17},  29.0   },
                     { std::size_t{42}, - 1.618 },
                 });
         }
 
+        st.assign_values(named);
+
         return st;
     }
 
+    bool SummaryState::NamedValues::operator==(const NamedValues& that) const
+    {
+        return (this->values == that.values)
+            && (this->well_values == that.well_values)
+            && (this->group_values == that.group_values)
+            && (this->conn_values == that.conn_values)
+            && (this->segment_values == that.segment_values)
+            && (this->region_values == that.region_values)
+            ;
+    }
+
+    bool SummaryState::is_present(const KeyId id) const
+    {
+        return (id < this->present.size()) && (this->present[id] != 0);
+    }
+
+    void SummaryState::assign_present(const KeyId id, const double value)
+    {
+        if (id >= this->present.size()) {
+            const auto size = std::max(id + 1, this->keys_->size());
+
+            this->values.resize(size, 0.0);
+            this->present.resize(size, 0);
+        }
+
+        if (this->present[id] == 0) {
+            const auto cat = this->keys_->entry(id).category;
+
+            this->present[id] = 1;
+            this->num_values += cat == Category::Scalar;
+
+            if (cat == Category::Well) {
+                this->well_set_version_ = next_version();
+            }
+        }
+
+        this->values[id] = value;
+    }
+
+    bool SummaryState::clear_present(const KeyId id)
+    {
+        if (! this->is_present(id)) {
+            return false;
+        }
+
+        const auto cat = this->keys_->entry(id).category;
+
+        this->present[id] = 0;
+        this->num_values -= cat == Category::Scalar;
+
+        if (cat == Category::Well) {
+            this->well_set_version_ = next_version();
+        }
+
+        return true;
+    }
+
+    void SummaryState::touch(const std::size_t var)
+    {
+        if (var >= this->var_versions.size()) {
+            this->var_versions.resize(var + 1, 0);
+        }
+
+        this->var_versions[var] = next_version();
+    }
+
+    void SummaryState::reset_versions()
+    {
+        this->base_version = next_version();
+        this->var_versions.clear();
+    }
+
+    SummaryState::NamedValues SummaryState::named_values() const
+    {
+        auto named = NamedValues{};
+
+        for (auto id = 0*this->present.size(); id < this->present.size(); ++id) {
+            if (! this->present[id]) {
+                continue;
+            }
+
+            const auto& entry = this->keys_->entry(id);
+            const auto value = this->values[id];
+
+            switch (entry.category) {
+            case Category::Scalar:
+                named.values.emplace(entry.key, value);
+                break;
+
+            case Category::Well:
+                named.well_values[name_of(entry.var)].emplace(name_of(entry.entity), value);
+                break;
+
+            case Category::Group:
+                named.group_values[name_of(entry.var)].emplace(name_of(entry.entity), value);
+                break;
+
+            case Category::Connection:
+                named.conn_values[name_of(entry.var)][name_of(entry.entity)].emplace(entry.number, value);
+                break;
+
+            case Category::Segment:
+                named.segment_values[name_of(entry.var)][name_of(entry.entity)].emplace(entry.number, value);
+                break;
+
+            case Category::Region:
+                named.region_values[name_of(entry.var)][name_of(entry.entity)].emplace(entry.number, value);
+                break;
+            }
+        }
+
+        return named;
+    }
+
+    void SummaryState::assign_values(const NamedValues& named)
+    {
+        this->values.clear();
+        this->present.clear();
+        this->num_values = 0;
+        this->well_set_version_ = next_version();
+
+        for (const auto& [key, value] : named.values) {
+            this->assign_present(key_id(key), value);
+        }
+
+        for (const auto& [var, wells] : named.well_values) {
+            for (const auto& [well, value] : wells) {
+                this->assign_present(well_key_id(well, var), value);
+            }
+        }
+
+        for (const auto& [var, groups] : named.group_values) {
+            for (const auto& [group, value] : groups) {
+                this->assign_present(group_key_id(group, var), value);
+            }
+        }
+
+        for (const auto& [var, wells] : named.conn_values) {
+            for (const auto& [well, conns] : wells) {
+                for (const auto& [global_index, value] : conns) {
+                    this->assign_present(conn_key_id(well, var, global_index), value);
+                }
+            }
+        }
+
+        for (const auto& [var, wells] : named.segment_values) {
+            for (const auto& [well, segments] : wells) {
+                for (const auto& [segment, value] : segments) {
+                    this->assign_present(segment_key_id(well, var, segment), value);
+                }
+            }
+        }
+
+        for (const auto& [var, regSets] : named.region_values) {
+            for (const auto& [regSet, regions] : regSets) {
+                for (const auto& [region, value] : regions) {
+                    this->assign_present(region_key_id(regSet, var, region), value);
+                }
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------
+
+    SummaryState::const_iterator::const_iterator(const SummaryState* st,
+                                                 const KeyId         id)
+        : st_ { st }
+        , id_ { id }
+    {
+        this->skip_absent();
+    }
+
+    SummaryState::const_iterator::value_type
+    SummaryState::const_iterator::operator*() const
+    {
+        return { this->st_->keys_->entry(this->id_).key, this->st_->values[this->id_] };
+    }
+
+    SummaryState::const_iterator&
+    SummaryState::const_iterator::operator++()
+    {
+        ++this->id_;
+        this->skip_absent();
+
+        return *this;
+    }
+
+    SummaryState::const_iterator
+    SummaryState::const_iterator::operator++(int)
+    {
+        auto prev = *this;
+        ++(*this);
+
+        return prev;
+    }
+
+    void SummaryState::const_iterator::skip_absent()
+    {
+        const auto& present = this->st_->present;
+
+        while ((this->id_ < present.size()) &&
+               ((present[this->id_] == 0) ||
+                (this->st_->keys_->entry(this->id_).category != Category::Scalar)))
+        {
+            ++this->id_;
+        }
+    }
+
+    // -----------------------------------------------------------------------
+
     std::ostream& operator<<(std::ostream& stream, const SummaryState& st)
     {
         stream << "Simulated seconds: " << st.get_elapsed() << std::endl;
@@ -22,13 +22,19 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
+
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <iosfwd>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -71,7 +77,22 @@ namespace Opm {
 class SummaryState
 {
 public:
-    using const_iterator = std::unordered_map<std::string, double>::const_iterator;
+    class const_iterator;
+
+    /// Dense identifier of a summary vector such as WOPR:PROD1 or
+    /// FOPT.
+    ///
+    /// Identifiers are assigned by a key registry the first time a vector
+    /// is named, typically when the summary configuration is set up.  Each
+    /// independently constructed SummaryState object has its own registry,
+    /// which its copies share, so an identifier is only meaningful for the
+    /// objects with the same key_scope() as the object which assigned it.
+    /// The values of a SummaryState are stored in a contiguous array
+    /// indexed by this identifier, so the update_value() and get_value()
+    /// member functions avoid the string hashing of the name based
+    /// interface.  Like NameTable indices, identifiers must not be written
+    /// to file or communicated to other processes.
+    using KeyId = std::size_t;
 
     explicit SummaryState(time_point sim_start_arg, double udqUndefined);
 
@@ -82,6 +103,29 @@ public:
     SummaryState() : SummaryState(std::time_t{0}) {}
     ~SummaryState() = default;
 
+    // Identifier of this object's key registry.  Equal for an object and
+    // its copies, distinct for independently constructed objects, and
+    // never reused.  Clients which retain key identifiers between calls
+    // use this to decide whether the identifiers are still valid.
+    std::uint64_t key_scope() const;
+
+    // Register summary vectors in this object's key registry and return
+    // their identifiers.  The vectors are not added to the object, so
+    // registration does not change its observable state.  Repeated calls
+    // with the same arguments return the same identifier.
+    KeyId key_id(const std::string& key) const;
+    KeyId well_key_id(const std::string& well, const std::string& var) const;
+    KeyId group_key_id(const std::string& group, const std::string& var) const;
+
+    // Same as above, for names already interned in the NameTable.  Avoids
+    // string hashing and formatting for registered vectors.
+    KeyId well_key_id(NameTable::Index well, NameTable::Index var) const;
+    KeyId group_key_id(NameTable::Index group, NameTable::Index var) const;
+
+    KeyId conn_key_id(const std::string& well, const std::string& var, std::size_t global_index) const;
+    KeyId segment_key_id(const std::string& well, const std::string& var, std::size_t segment) const;
+    KeyId region_key_id(const std::string& regSet, const std::string& var, std::size_t region) const;
+
     // The canonical way to update the SummaryState is through the
     // update_xxx() methods which will inspect the variable and either
     // accumulate or just assign, depending on whether it represents a total
@@ -102,6 +146,15 @@ public:
     bool has_segment_var(const std::string& well, const std::string& var, std::size_t segment) const;
     bool has_region_var(const std::string& regSet, const std::string& var, std::size_t region) const;
 
+    // Identifier based access.  Equivalent to the name based member
+    // function for the kind of vector with which 'id' was registered, e.g.,
+    // update_value(well_key_id(well, var), value) is the same as
+    // update_well_var(well, var, value).
+    bool has_value(KeyId id) const;
+    void update_value(KeyId id, double value);
+    double get_value(KeyId id) const;
+    double get_value(KeyId id, double default_value) const;
+
     void update(const std::string& key, double value);
     void update_well_var(const std::string& well, const std::string& var, double value);
     void update_group_var(const std::string& group, const std::string& var, double value);
@@ -127,6 +180,20 @@ public:
 
     bool is_undefined_value(const double val) const { return val == udq_undefined; }
 
+    // Modification stamp of a summary variable such as WOPR or FUX.  The
+    // stamp changes whenever any value of the variable changes, and stamps
+    // are never reused--not even across SummaryState objects--so two equal
+    // stamps imply equal values.  Used by the UDQ machinery to skip
+    // recomputing quantities whose inputs did not change.  The stamps are
+    // not part of the object's serialised state.
+    std::uint64_t var_version(const std::string& var) const;
+
+    // Modification stamp of the set of well level vectors, i.e., of the
+    // result of wells(var) for all variables.  Changes only when a well
+    // level vector is added or removed, not when its value changes.  Like
+    // var_version(), never reused and not serialised.
+    std::uint64_t well_set_version() const { return this->well_set_version_; }
+
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
@@ -144,47 +211,141 @@ public:
         serializer(sim_start);
         serializer(this->udq_undefined);
         serializer(elapsed);
-        serializer(values);
-        serializer(well_values);
+
+        // Values are serialised by name, since the key identifiers are
+        // specific to the object's key registry.
+        auto named = serializer.isSerializing()
+            ? this->named_values() : NamedValues{};
+
+        serializer(named.values);
+        serializer(named.well_values);
         serializer(m_wells);
         serializer(well_names);
-        serializer(group_values);
+        serializer(named.group_values);
         serializer(m_groups);
         serializer(group_names);
-        serializer(conn_values);
-        serializer(segment_values);
-        serializer(this->region_values);
+        serializer(named.conn_values);
+        serializer(named.segment_values);
+        serializer(named.region_values);
+
+        if (! serializer.isSerializing()) {
+            this->assign_values(named);
+            this->reset_versions();
+        }
     }
 
     static SummaryState serializationTestObject();
 
+    // Iterator over all summary vectors, as (key, value) pairs, in the
+    // general structure.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const std::string&, double>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        value_type operator*() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator& that) const { return this->id_ == that.id_; }
+        bool operator!=(const const_iterator& that) const { return ! (*this == that); }
+
+    private:
+        friend class SummaryState;
+
+        const_iterator(const SummaryState* st, KeyId id);
+
+        const SummaryState* st_{nullptr};
+        KeyId id_{0};
+
+        void skip_absent();
+    };
+
 private:
+    template <class T>
+    using VarMap2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
+
+    template <class T>
+    using VarMap3 = VarMap2<std::unordered_map<std::size_t, T>>;
+
+    // Values keyed by name, in the form used for serialisation.
+    struct NamedValues
+    {
+        std::unordered_map<std::string, double> values{};
+
+        // The first key is the variable and the second key is the well.
+        VarMap2<double> well_values{};
+
+        // The first key is the variable and the second key is the group.
+        VarMap2<double> group_values{};
+
+        // The first key is the variable and the second key is the well and
+        // the third is the global index. NB: The global_index has offset 1!
+        VarMap3<double> conn_values{};
+
+        // The first key is the variable and the second key is the well and
+        // the third is the one-based segment number.
+        VarMap3<double> segment_values{};
+
+        // First key is variable (e.g., ROIP), second key is region set
+        // (e.g., FIPNUM, FIPABC), and the third key is the one-based
+        // region number.
+        VarMap3<double> region_values{};
+
+        bool operator==(const NamedValues& that) const;
+    };
+
     time_point sim_start;
     double udq_undefined{};
     double elapsed = 0;
-    std::unordered_map<std::string,double> values;
 
-    // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
+    // Registry of summary vectors.  Shared with copies of this object.
+    class KeyTable;
+    std::shared_ptr<KeyTable> keys_;
+
+    // Value of each registered summary vector, indexed by KeyId.  Vectors
+    // which have been registered, but not added to this object, have a
+    // zero entry in 'present'.  Both arrays grow on demand and may be
+    // shorter than the number of registered vectors.
+    std::vector<double> values;
+    std::vector<unsigned char> present;
+
+    // Number of vectors in the general structure.
+    std::size_t num_values{0};
+
     std::set<std::string> m_wells;
     mutable std::optional<std::vector<std::string>> well_names;
 
-    // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
     std::set<std::string> m_groups;
     mutable std::optional<std::vector<std::string>> group_names;
 
-    // The first key is the variable and the second key is the well and the
-    // third is the global index. NB: The global_index has offset 1!
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
-
-    // The first key is the variable and the second key is the well and the
-    // third is the one-based segment number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> segment_values;
-
-    // First key is variable (e.g., ROIP), second key is region set (e.g.,
-    // FIPNUM, FIPABC), and the third key is the one-based region number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> region_values;
+    // Modification stamps, indexed by registry variable index.  Variables
+    // with a zero entry have not changed since base_version was assigned.
+    std::uint64_t base_version{};
+    std::vector<std::uint64_t> var_versions;
+    std::uint64_t well_set_version_{};
+
+    bool is_present(KeyId id) const;
+    void assign_present(KeyId id, double value);
+    bool clear_present(KeyId id);
+
+    void touch(std::size_t var);
+    void reset_versions();
+
+    // Name based queries.  Vectors which have never been registered are
+    // treated as absent and are not registered by these queries.
+    struct VectorName;
+    bool has_vector(const VectorName& vector) const;
+    double get_vector(const VectorName& vector) const;
+    double get_vector(const VectorName& vector, double default_value) const;
+    [[noreturn]] void throw_missing(const VectorName& vector) const;
+
+    NamedValues named_values() const;
+    void assign_values(const NamedValues& named);
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
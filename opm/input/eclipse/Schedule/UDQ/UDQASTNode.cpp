@@ -306,6 +306,27 @@ void UDQASTNode::required_summary(std::unordered_set<std::string>& summary_keys)
     }
 }
 
+void UDQASTNode::required_udq(std::unordered_set<std::string>& udq_keys) const
+{
+    if ((this->type == UDQTokenType::ecl_expr) &&
+        std::holds_alternative<std::string>(this->value))
+    {
+        if (const auto& keyword = std::get<std::string>(this->value);
+            is_udq(keyword))
+        {
+            udq_keys.insert(keyword);
+        }
+    }
+
+    if (this->left) {
+        this->left->required_udq(udq_keys);
+    }
+
+    if (this->right) {
+        this->right->required_udq(udq_keys);
+    }
+}
+
 void UDQASTNode::requiredObjects(UDQ::RequisiteEvaluationObjects& objects) const
 {
     if ((this->type == UDQTokenType::ecl_expr) &&
@@ -370,13 +391,12 @@ UDQSet
 UDQASTNode::eval_well_expression(const std::string& string_value,
                                  const UDQContext&  context) const
 {
-    const auto& all_wells = context.wells();
-
     if (this->selector.empty()) {
-        auto res = UDQSet::wells(string_value, all_wells);
+        auto res = UDQSet::indexed_wells(string_value, context.well_indices());
 
-        for (const auto& well : all_wells) {
-            res.assign(well, context.get_well_var(well, string_value));
+        const auto values = context.well_var_values(string_value);
+        for (auto i = 0*values.size(); i < values.size(); ++i) {
+            res.assign(i, values[i]);
         }
 
         return res;
@@ -395,7 +415,7 @@ UDQASTNode::eval_well_expression(const std::string& string_value,
         // The right hand side is a set of wells.  The result set will be
         // updated for all wells in the right hand set, wells missing in the
         // right hand set will be undefined in the result set.
-        auto res = UDQSet::wells(string_value, all_wells);
+        auto res = UDQSet::indexed_wells(string_value, context.well_indices());
         for (const auto& wname : context.wells(well_pattern)) {
             res.assign(wname, context.get_well_var(wname, string_value));
         }
@@ -417,11 +437,11 @@ UDQASTNode::eval_group_expression(const std::string& string_value,
         throw std::logic_error("Group names with wildcards is not yet supported");
     }
 
-    const auto groups = context.nonFieldGroups();
+    auto res = UDQSet::indexed_groups(string_value, context.group_indices());
 
-    auto res = UDQSet::groups(string_value, groups);
-    for (const auto& group : groups) {
-        res.assign(group, context.get_group_var(group, string_value));
+    const auto values = context.group_var_values(string_value);
+    for (auto i = 0*values.size(); i < values.size(); ++i) {
+        res.assign(i, values[i]);
     }
 
     return res;
@@ -561,10 +581,10 @@ UDQASTNode::eval_number(const UDQVarType  target_type,
 
     switch (target_type) {
     case UDQVarType::WELL_VAR:
-        return UDQSet::wells(dummy_name, context.wells(), numeric_value);
+        return UDQSet::indexed_wells(dummy_name, context.well_indices(), numeric_value);
 
     case UDQVarType::GROUP_VAR:
-        return UDQSet::groups(dummy_name, context.nonFieldGroups(), numeric_value);
+        return UDQSet::indexed_groups(dummy_name, context.group_indices(), numeric_value);
 
     case UDQVarType::SEGMENT_VAR:
         return UDQSet::segments(dummy_name,
@@ -627,11 +647,11 @@ UDQASTNode::eval_table_lookup_group(const std::string& string_value,
 
     const auto groups = context.nonFieldGroups();
 
-    UDQSet result = UDQSet::groups("dummy", groups);
-    for (const auto& group : groups) {
-        const auto xvar = context.get_group_var(group, this->selector[0]);
+    UDQSet result = UDQSet::indexed_groups("dummy", context.group_indices());
+    for (auto i = 0*groups.size(); i < groups.size(); ++i) {
+        const auto xvar = context.get_group_var(groups[i], this->selector[0]);
         if (xvar.has_value()) {
-            result.assign(group, udt(*xvar));
+            result.assign(i, udt(*xvar));
         }
     }
 
@@ -667,11 +687,13 @@ UDQASTNode::eval_table_lookup_well(const std::string& string_value,
                                    const UDQContext& context) const
 {
     const UDT& udt = context.get_udt(string_value);
-    UDQSet result = UDQSet::wells("dummy", context.wells());
-    for (const auto& well : context.wells()) {
-        const auto xvar = context.get_well_var(well, this->selector[0]);
+    const auto& wells = context.wells();
+
+    UDQSet result = UDQSet::indexed_wells("dummy", context.well_indices());
+    for (auto i = 0*wells.size(); i < wells.size(); ++i) {
+        const auto xvar = context.get_well_var(wells[i], this->selector[0]);
         if (xvar.has_value()) {
-            result.assign(well, udt(*xvar));
+            result.assign(i, udt(*xvar));
         }
     }
 
@@ -71,9 +71,26 @@ public:
 
     UDQASTNode* get_left() const;
     UDQASTNode* get_right() const;
+
+    /// Token type of this node, e.g., ecl_expr, number or a function.
+    UDQTokenType token_type() const { return this->type; }
+
+    /// Vector/function name or numeric value of this node.
+    const std::variant<std::string, double>& token_value() const { return this->value; }
+
+    /// Well, group, segment or region selector of an ecl_expr node.
+    const std::vector<std::string>& token_selector() const { return this->selector; }
+
+    /// Sign factor applied to the value of this node.
+    double sign_factor() const { return this->sign; }
+
     bool operator==(const UDQASTNode& data) const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
 
+    /// Collect names of all UDQs referenced by this node and, recursively,
+    /// its children.
+    void required_udq(std::unordered_set<std::string>& udq_keys) const;
+
     /// Populate collection of requisite objects needed to evaluate this node.
     ///
     /// \param[in,out] objects Specific Schedule objects named in containing
@@ -31,6 +31,7 @@
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQInput.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
@@ -44,8 +45,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -221,9 +224,14 @@ namespace {
 
 namespace Opm {
 
+    UDQConfig::UDQConfig()
+        : dependency_graph_ { std::make_shared<const UDQDependencyGraph>() }
+    {}
+
     UDQConfig::UDQConfig(const UDQParams& params)
-        : udq_params { params }
-        , udqft      { udq_params }
+        : udq_params        { params }
+        , udqft             { udq_params }
+        , dependency_graph_ { std::make_shared<const UDQDependencyGraph>() }
     {}
 
     UDQConfig::UDQConfig(const UDQParams&           params,
@@ -404,8 +412,6 @@ namespace Opm {
                                const std::vector<std::string>& expression,
                                const std::size_t               report_step)
     {
-        this->add_node(quantity, UDQAction::DEFINE);
-
         this->m_definitions.insert_or_assign(quantity,
                                              UDQDefine {
                                                  this->udq_params,
@@ -415,12 +421,20 @@ namespace Opm {
                                                  expression
                                              });
 
+        // Recall: add_node() rebuilds the dependency graph from
+        // m_definitions, so the definition must be in place first.
+        this->add_node(quantity, UDQAction::DEFINE);
+
         this->define_order.insert(quantity);
     }
 
     void UDQConfig::add_table(const std::string& name, UDT udt)
     {
         m_tables.emplace(name, std::move(udt));
+
+        // Tables do not change the structure of the graph, but a new
+        // graph invalidates all recorded evaluations.
+        this->update_dependency_graph();
     }
 
     bool UDQConfig::clear_pending_assignments()
@@ -642,6 +656,11 @@ namespace Opm {
         return m_tables;
     }
 
+    const UDQDependencyGraph& UDQConfig::dependency_graph() const
+    {
+        return *this->dependency_graph_;
+    }
+
     bool UDQConfig::operator==(const UDQConfig& data) const
     {
         return (this->params() == data.params())
@@ -670,6 +689,8 @@ namespace Opm {
 
     void UDQConfig::add_node(const std::string& quantity, const UDQAction action)
     {
+        auto changes_definitions = action == UDQAction::DEFINE;
+
         auto index_iter = this->input_index.find(quantity);
         if (this->input_index.find(quantity) == this->input_index.end()) {
             auto var_type = UDQ::varType(quantity);
@@ -679,8 +700,28 @@ namespace Opm {
             this->input_index[quantity] = UDQIndex(insert_index, this->type_count[var_type], action, var_type);
         }
         else {
+            changes_definitions = changes_definitions
+                || (index_iter->second.action == UDQAction::DEFINE);
+
             index_iter->second.action = action;
         }
+
+        if (changes_definitions) {
+            this->update_dependency_graph();
+        }
+    }
+
+    void UDQConfig::update_dependency_graph()
+    {
+        auto definitions = std::vector<const UDQDefine*>{};
+
+        for (const auto& [keyword, index] : this->input_index) {
+            if (index.action == UDQAction::DEFINE) {
+                definitions.push_back(&this->m_definitions.at(keyword));
+            }
+        }
+
+        this->dependency_graph_ = std::make_shared<const UDQDependencyGraph>(definitions);
     }
 
     void UDQConfig::add_assign(const RestartIO::RstUDQ& udq,
@@ -745,7 +786,7 @@ namespace Opm {
     }
 
     void UDQConfig::eval_define(const std::size_t report_step,
-                                const UDQState&   udq_state,
+                                UDQState&         udq_state,
                                 UDQContext&       context) const
     {
         auto var_type_bit = [](const UDQVarType var_type)
@@ -759,6 +800,10 @@ namespace Opm {
         select_var_type |= var_type_bit(UDQVarType::FIELD_VAR);
         select_var_type |= var_type_bit(UDQVarType::SEGMENT_VAR);
 
+        const auto& graph = this->dependency_graph();
+
+        graph.begin_pass(context.well_indices(), context.group_indices(), udq_state);
+
         for (const auto& [keyword, index] : this->input_index) {
             if (index.action != UDQAction::DEFINE) {
                 continue;
@@ -779,9 +824,33 @@ namespace Opm {
                 continue;
             }
 
-            context.update_define(report_step, keyword, def.eval(context));
+            const auto node = graph.index(keyword).value();
+            auto versions = graph.input_versions(node, context.summary());
+
+            if (graph.up_to_date(node, versions, udq_state)) {
+                // No input changed since the previous evaluation, so
+                // evaluating again would produce the values we already
+                // have.
+                context.keep_define(report_step, keyword);
+                graph.record_skip(node, udq_state);
+            }
+            else {
+                const auto start = std::chrono::steady_clock::now();
+
+                context.update_define(report_step, keyword, def.eval(context));
+
+                const auto elapsed = std::chrono::duration<double>
+                    { std::chrono::steady_clock::now() - start };
+
+                graph.record_evaluation(node, std::move(versions),
+                                        context.summary(), elapsed.count(),
+                                        udq_state);
+            }
+
             def.clear_next();
         }
+
+        graph.end_pass(udq_state);
     }
 
     void UDQConfig::add_enumerated_assign(const std::string&              quantity,
@@ -52,6 +52,7 @@ namespace Opm {
     class Schedule;
     class SegmentMatcher;
     class SummaryState;
+    class UDQDependencyGraph;
     class UDQState;
     class WellMatcher;
 
@@ -180,7 +181,7 @@ namespace Opm {
         using SegmentMatcherFactory = std::function<std::unique_ptr<SegmentMatcher>()>;
 
         /// Default constructor
-        UDQConfig() = default;
+        UDQConfig();
 
         /// Constructor
         ///
@@ -499,6 +500,13 @@ namespace Opm {
         /// Retrieve run's active user defined tables.
         const std::unordered_map<std::string, UDT>& tables() const;
 
+        /// Dependencies between the current DEFINE statements.
+        ///
+        /// Evaluation statistics for each DEFINE statement are kept in
+        /// UDQState::define_history() of the state object passed to
+        /// eval().
+        const UDQDependencyGraph& dependency_graph() const;
+
         /// Equality predicate.
         ///
         /// \param[in] config Object against which \code *this \endcode will
@@ -538,6 +546,7 @@ namespace Opm {
             // just construct a new instance here.
             if (!serializer.isSerializing()) {
                 udqft = UDQFunctionTable(udq_params);
+                update_dependency_graph();
             }
         }
 
@@ -599,6 +608,12 @@ namespace Opm {
         ///    UDQConfig::eval_assign(step, sched, context) const
         mutable std::vector<std::string> pending_assignments_{};
 
+        /// Dependencies between DEFINE statements.
+        ///
+        /// Rebuilt whenever the collection of DEFINE statements or tables
+        /// changes.  Immutable, and therefore shared between copies.
+        std::shared_ptr<const UDQDependencyGraph> dependency_graph_{};
+
         /// Incorporate operation for new or existing UDQ
         ///
         /// Preserves order of operations in input_index.
@@ -609,6 +624,9 @@ namespace Opm {
         /// \param[in] action Kind of operation.
         void add_node(const std::string& quantity, UDQAction action);
 
+        /// Rebuild dependency graph from current DEFINE statements.
+        void update_dependency_graph();
+
         /// Reconstitute an assignment statement from restart file information.
         ///
         /// \param[in] udq Restart file representation of an assignment statement.
@@ -641,13 +659,14 @@ namespace Opm {
         ///
         /// \param[in] report_step Current report step.
         ///
-        /// \param[in] schedule Full dynamic input schedule.
+        /// \param[in,out] udq_state UDQ values and record of previous
+        /// evaluations, used to skip unchanged DEFINE statements.
         ///
         /// \param[in,out] context Pattern matchers and state objects.
         /// Values pertaining to UDQs being evaluated here will be updated.
-        void eval_define(std::size_t     report_step,
-                         const UDQState& udq_state,
-                         UDQContext&     context) const;
+        void eval_define(std::size_t report_step,
+                         UDQState&   udq_state,
+                         UDQContext& context) const;
 
         /// Incorporate an enumerated assignment statement into known UDQ
         /// collection.
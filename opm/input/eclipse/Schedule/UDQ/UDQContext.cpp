@@ -22,6 +22,7 @@
 #include <opm/input/eclipse/EclipseState/Grid/RegionSetMatcher.hpp>
 
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDT.hpp>
@@ -30,6 +31,7 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <functional>
@@ -50,6 +52,45 @@ bool is_udq(const std::string& key)
         && (key[1] == 'U');
 }
 
+std::vector<Opm::NameTable::Index>
+intern(const std::vector<std::string>& names)
+{
+    auto indices = std::vector<Opm::NameTable::Index>(names.size());
+
+    std::transform(names.begin(), names.end(), indices.begin(),
+                   [](const std::string& name)
+                   { return Opm::NameTable::index(name); });
+
+    return indices;
+}
+
+std::optional<double>
+summary_value(const Opm::SummaryState&       summary_state,
+              const Opm::SummaryState::KeyId id)
+{
+    if (summary_state.has_value(id)) {
+        return summary_state.get_value(id);
+    }
+
+    return std::nullopt;
+}
+
+template <typename KeyIdFunc>
+std::vector<std::optional<double>>
+summary_values(const Opm::SummaryState&                  summary_state,
+               const std::vector<Opm::NameTable::Index>& wgindices,
+               const Opm::NameTable::Index               var,
+               KeyIdFunc&&                               key_id)
+{
+    auto values = std::vector<std::optional<double>>(wgindices.size());
+
+    for (auto i = 0*wgindices.size(); i < wgindices.size(); ++i) {
+        values[i] = summary_value(summary_state, key_id(wgindices[i], var));
+    }
+
+    return values;
+}
+
 } // Anonymous namespace
 
 namespace Opm {
@@ -157,6 +198,106 @@ namespace Opm {
         };
     }
 
+    std::optional<double>
+    UDQContext::get_well_var(const NameTable::Index well,
+                             const NameTable::Index var) const
+    {
+        const auto& var_name = NameTable::name(var);
+        if (is_udq(var_name) || ! this->summary_state.has_well_var(var_name)) {
+            return this->get_well_var(NameTable::name(well), var_name);
+        }
+
+        return summary_value(this->summary_state, this->summary_state.well_key_id(well, var));
+    }
+
+    std::optional<double>
+    UDQContext::get_group_var(const NameTable::Index group,
+                              const NameTable::Index var) const
+    {
+        const auto& var_name = NameTable::name(var);
+        if (is_udq(var_name) || ! this->summary_state.has_group_var(var_name)) {
+            return this->get_group_var(NameTable::name(group), var_name);
+        }
+
+        return summary_value(this->summary_state, this->summary_state.group_key_id(group, var));
+    }
+
+    std::vector<std::optional<double>>
+    UDQContext::well_var_values(const std::string& var) const
+    {
+        return this->well_var_values(NameTable::index(var));
+    }
+
+    std::vector<std::optional<double>>
+    UDQContext::well_var_values(const NameTable::Index var) const
+    {
+        const auto& wells = this->wells();
+
+        if (wells.empty()) {
+            return {};
+        }
+
+        const auto& var_name = NameTable::name(var);
+
+        if (is_udq(var_name)) {
+            auto udq_values = std::vector<std::optional<double>>(wells.size());
+            std::transform(wells.begin(), wells.end(), udq_values.begin(),
+                           [&var_name, this](const std::string& well)
+                           { return this->get_well_var(well, var_name); });
+
+            return udq_values;
+        }
+
+        if (! this->summary_state.has_well_var(var_name)) {
+            throw std::logic_error {
+                fmt::format("Summary well variable: {} not registered", var_name)
+            };
+        }
+
+        return summary_values(this->summary_state, this->well_indices(), var,
+                              [this](const NameTable::Index well, const NameTable::Index v)
+                              { return this->summary_state.well_key_id(well, v); });
+    }
+
+    std::vector<std::optional<double>>
+    UDQContext::group_var_values(const std::string& var) const
+    {
+        return this->group_var_values(NameTable::index(var));
+    }
+
+    std::vector<std::optional<double>>
+    UDQContext::group_var_values(const NameTable::Index var) const
+    {
+        const auto& groups = this->group_indices();
+
+        if (groups.empty()) {
+            return {};
+        }
+
+        const auto& var_name = NameTable::name(var);
+
+        if (is_udq(var_name)) {
+            const auto names = this->nonFieldGroups();
+
+            auto udq_values = std::vector<std::optional<double>>(names.size());
+            std::transform(names.begin(), names.end(), udq_values.begin(),
+                           [&var_name, this](const std::string& group)
+                           { return this->get_group_var(group, var_name); });
+
+            return udq_values;
+        }
+
+        if (! this->summary_state.has_group_var(var_name)) {
+            throw std::logic_error {
+                fmt::format("Summary group variable: {} not registered", var_name)
+            };
+        }
+
+        return summary_values(this->summary_state, groups, var,
+                              [this](const NameTable::Index group, const NameTable::Index v)
+                              { return this->summary_state.group_key_id(group, v); });
+    }
+
     std::optional<double>
     UDQContext::get_segment_var(const std::string& well,
                                 const std::string& var,
@@ -240,6 +381,24 @@ namespace Opm {
         return this->group_order_.names(pattern);
     }
 
+    const std::vector<NameTable::Index>& UDQContext::well_indices() const
+    {
+        if (! this->well_indices_.has_value()) {
+            this->well_indices_ = intern(this->wells());
+        }
+
+        return *this->well_indices_;
+    }
+
+    const std::vector<NameTable::Index>& UDQContext::group_indices() const
+    {
+        if (! this->group_indices_.has_value()) {
+            this->group_indices_ = intern(this->nonFieldGroups());
+        }
+
+        return *this->group_indices_;
+    }
+
     SegmentSet UDQContext::segments() const
     {
         // Empty descriptor matches all segments in all existing MS wells.
@@ -308,6 +467,17 @@ namespace Opm {
         this->summary_state.update_udq(udq_result);
     }
 
+    void UDQContext::keep_define(const std::size_t  report_step,
+                                 const std::string& keyword)
+    {
+        this->udq_state.keep_define(report_step, keyword);
+    }
+
+    const SummaryState& UDQContext::summary() const
+    {
+        return this->summary_state;
+    }
+
     void UDQContext::ensure_segment_matcher_exists() const
     {
         if (this->matchers_.segments == nullptr) {
@@ -22,6 +22,7 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/RegionSetMatcher.hpp>
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
 
 #include <cstddef>
 #include <functional>
@@ -71,6 +72,30 @@ namespace Opm {
         std::optional<double>
         get_group_var(const std::string& group, const std::string& var) const;
 
+        /// Same as above, for names already interned in the NameTable.
+        std::optional<double>
+        get_well_var(NameTable::Index well, NameTable::Index var) const;
+
+        std::optional<double>
+        get_group_var(NameTable::Index group, NameTable::Index var) const;
+
+        /// Values of well level variable \p var for all wells(), in the
+        /// same order.  Same result as calling get_well_var() for each
+        /// well, but looks up summary vectors by interned name.
+        std::vector<std::optional<double>>
+        well_var_values(const std::string& var) const;
+
+        std::vector<std::optional<double>>
+        well_var_values(NameTable::Index var) const;
+
+        /// Values of group level variable \p var for all
+        /// nonFieldGroups(), in the same order.
+        std::vector<std::optional<double>>
+        group_var_values(const std::string& var) const;
+
+        std::vector<std::optional<double>>
+        group_var_values(NameTable::Index var) const;
+
         std::optional<double>
         get_segment_var(const std::string& well,
                         const std::string& var,
@@ -88,13 +113,22 @@ namespace Opm {
         void update_define(std::size_t report_step,
                            const std::string& keyword,
                            const UDQSet& udq_result);
+        void keep_define(std::size_t report_step, const std::string& keyword);
 
         const UDQFunctionTable& function_table() const;
+        const SummaryState& summary() const;
 
         const std::vector<std::string>& wells() const;
         std::vector<std::string> wells(const std::string& pattern) const;
         std::vector<std::string> nonFieldGroups() const;
         std::vector<std::string> groups(const std::string& pattern) const;
+
+        /// Interned names of wells(), in the same order.
+        const std::vector<NameTable::Index>& well_indices() const;
+
+        /// Interned names of nonFieldGroups(), in the same order.
+        const std::vector<NameTable::Index>& group_indices() const;
+
         SegmentSet segments() const;
         SegmentSet segments(const std::vector<std::string>& set_descriptor) const;
 
@@ -120,6 +154,9 @@ namespace Opm {
         MatcherFactories create_matchers_{};
         mutable Matchers matchers_{};
 
+        mutable std::optional<std::vector<NameTable::Index>> well_indices_{};
+        mutable std::optional<std::vector<NameTable::Index>> group_indices_{};
+
         //std::unordered_map<std::string, UDQSet> udq_results;
         std::unordered_map<std::string, double> values;
 
@@ -33,6 +33,7 @@
 #include "../../Parser/raw/RawConsts.hpp"
 
 #include "UDQParser.hpp"
+#include "UDQProgram.hpp"
 
 #include <cstddef>
 #include <cstring>
@@ -291,6 +292,8 @@ UDQDefine::UDQDefine(const UDQParams&                udq_params,
                                    this->m_tokens,
                                    parseContext,
                                    errors);
+
+    this->compileProgram();
 }
 
 void UDQDefine::update_status(const UDQUpdate   update,
@@ -311,6 +314,7 @@ UDQDefine UDQDefine::serializationTestObject()
     result.m_location = KeywordLocation{"KEYWOR", "file", 100};
     result.m_update_status = UDQUpdate::NEXT;
     result.m_report_step = 99;
+    result.compileProgram();
     return result;
 }
 
@@ -330,11 +334,23 @@ void UDQDefine::required_summary(std::unordered_set<std::string>& summary_keys)
     this->ast->required_summary(summary_keys);
 }
 
+void UDQDefine::required_udq(std::unordered_set<std::string>& udq_keys) const
+{
+    this->ast->required_udq(udq_keys);
+}
+
 UDQSet UDQDefine::eval(const UDQContext& context) const
 {
     auto res = std::optional<UDQSet>{};
     try {
-        res = this->ast->eval(this->m_var_type, context);
+        if (this->program_ != nullptr) {
+            res = this->program_->eval(context);
+        }
+
+        if (! res.has_value()) {
+            res = this->ast->eval(this->m_var_type, context);
+        }
+
         res->name(this->m_keyword);
 
         if (! dynamic_type_check(this->var_type(), res->var_type())) {
@@ -367,6 +383,13 @@ UDQSet UDQDefine::eval(const UDQContext& context) const
     return *std::move(res);
 }
 
+void UDQDefine::compileProgram()
+{
+    this->program_ = (this->ast != nullptr)
+        ? UDQProgram::compile(*this->ast, this->m_var_type)
+        : nullptr;
+}
+
 const KeywordLocation& UDQDefine::location() const
 {
     return this->m_location;
@@ -453,20 +476,20 @@ UDQSet UDQDefine::scatter_scalar_well_value(const UDQContext&            context
                                             const std::optional<double>& value) const
 {
     if (! value.has_value()) {
-        return UDQSet::wells(this->m_keyword, context.wells());
+        return UDQSet::indexed_wells(this->m_keyword, context.well_indices());
     }
 
-    return UDQSet::wells(this->m_keyword, context.wells(), *value);
+    return UDQSet::indexed_wells(this->m_keyword, context.well_indices(), *value);
 }
 
 UDQSet UDQDefine::scatter_scalar_group_value(const UDQContext&            context,
                                              const std::optional<double>& value) const
 {
     if (! value.has_value()) {
-        return UDQSet::groups(this->m_keyword, context.nonFieldGroups());
+        return UDQSet::indexed_groups(this->m_keyword, context.group_indices());
     }
 
-    return UDQSet::groups(this->m_keyword, context.nonFieldGroups(), *value);
+    return UDQSet::indexed_groups(this->m_keyword, context.group_indices(), *value);
 }
 
 UDQSet UDQDefine::scatter_scalar_segment_value(const UDQContext&            context,
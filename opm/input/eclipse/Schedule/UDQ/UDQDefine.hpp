@@ -40,6 +40,7 @@
 namespace Opm {
 
 class UDQASTNode;
+class UDQProgram;
 class ParseContext;
 class ErrorGuard;
 
@@ -91,6 +92,7 @@ public:
     UDQVarType var_type() const;
     std::set<UDQTokenType> func_tokens() const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
+    void required_udq(std::unordered_set<std::string>& udq_keys) const;
     void update_status(UDQUpdate update_status, std::size_t report_step);
     std::pair<UDQUpdate, std::size_t> status() const;
     const std::vector<Opm::UDQToken>& tokens() const;
@@ -114,6 +116,10 @@ public:
         serializer(m_location);
         serializer(m_update_status);
         serializer(m_report_step);
+
+        if (! serializer.isSerializing()) {
+            this->compileProgram();
+        }
     }
 
 private:
@@ -126,6 +132,12 @@ private:
     std::size_t m_report_step{};
     mutable UDQUpdate m_update_status{UDQUpdate::NEXT};
 
+    /// Compiled form of 'ast'.  Created whenever 'ast' is assigned and
+    /// shared between copies.  Null if the expression cannot be compiled.
+    std::shared_ptr<const UDQProgram> program_{};
+
+    void compileProgram();
+
     UDQSet scatter_scalar_value(UDQSet&& res, const UDQContext& context) const;
     UDQSet scatter_scalar_well_value(const UDQContext& context, const std::optional<double>& value) const;
     UDQSet scatter_scalar_group_value(const UDQContext& context, const std::optional<double>& value) const;
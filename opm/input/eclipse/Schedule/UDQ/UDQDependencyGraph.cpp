@@ -0,0 +1,299 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
+
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    std::vector<std::string>
+    sorted(const std::unordered_set<std::string>& keys)
+    {
+        auto result = std::vector<std::string>(keys.begin(), keys.end());
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    bool uses_random_numbers(const Opm::UDQDefine& def)
+    {
+        const auto tokens = def.func_tokens();
+
+        return std::any_of(tokens.begin(), tokens.end(),
+                           [](const Opm::UDQTokenType token)
+                           {
+                               return (token == Opm::UDQTokenType::elemental_func_randn)
+                                   || (token == Opm::UDQTokenType::elemental_func_randu)
+                                   || (token == Opm::UDQTokenType::elemental_func_rrandn)
+                                   || (token == Opm::UDQTokenType::elemental_func_rrandu);
+                           });
+    }
+
+    bool uses_dynamic_sets(const Opm::UDQDefine&           def,
+                           const std::vector<std::string>& summary_inputs)
+    {
+        // Segment and region sets are not part of the evaluation pass'
+        // change detection, and neither is well list membership.
+
+        if (def.var_type() == Opm::UDQVarType::SEGMENT_VAR) {
+            return true;
+        }
+
+        const auto is_set_vector = [](const std::string& vector)
+        {
+            const auto type = Opm::UDQ::targetType(vector);
+
+            return (type == Opm::UDQVarType::SEGMENT_VAR)
+                || (type == Opm::UDQVarType::REGION_VAR);
+        };
+
+        if (std::any_of(summary_inputs.begin(), summary_inputs.end(), is_set_vector)) {
+            return true;
+        }
+
+        const auto objects = def.requiredObjects();
+        if (! objects.msWells.empty() || ! objects.regions.empty()) {
+            return true;
+        }
+
+        return std::any_of(objects.wells.begin(), objects.wells.end(),
+                           [](const std::string& well)
+                           { return ! well.empty() && (well.front() == '*'); });
+    }
+
+    std::uint64_t next_graph_id()
+    {
+        static std::atomic<std::uint64_t> id{0};
+        return ++id;
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+UDQDependencyGraph::UDQDependencyGraph()
+    : id_(next_graph_id())
+{}
+
+UDQDependencyGraph::UDQDependencyGraph(const std::vector<const UDQDefine*>& definitions)
+    : id_(next_graph_id())
+{
+    this->nodes_.reserve(definitions.size());
+
+    for (const auto* def : definitions) {
+        this->index_.emplace(def->keyword(), this->nodes_.size());
+
+        auto& node = this->nodes_.emplace_back();
+        node.keyword = def->keyword();
+        node.var_type = def->var_type();
+
+        {
+            auto keys = std::unordered_set<std::string>{};
+            def->required_summary(keys);
+            node.summary_inputs = sorted(keys);
+        }
+
+        {
+            auto keys = std::unordered_set<std::string>{};
+            def->required_udq(keys);
+            node.udq_inputs = sorted(keys);
+        }
+
+        node.always_evaluate = uses_random_numbers(*def)
+            || uses_dynamic_sets(*def, node.summary_inputs);
+    }
+
+    for (auto j = 0*this->nodes_.size(); j < this->nodes_.size(); ++j) {
+        auto& node = this->nodes_[j];
+
+        for (const auto& udq : node.udq_inputs) {
+            const auto i = this->index(udq);
+            if (! i.has_value()) {
+                // ASSIGNed quantity.
+                continue;
+            }
+
+            if (*i < j) {
+                node.upstream.push_back(*i);
+                this->nodes_[*i].downstream.push_back(j);
+            }
+            else {
+                node.feedback = true;
+            }
+        }
+    }
+}
+
+std::optional<std::size_t>
+UDQDependencyGraph::index(const std::string& keyword) const
+{
+    auto pos = this->index_.find(keyword);
+    if (pos == this->index_.end()) {
+        return std::nullopt;
+    }
+
+    return pos->second;
+}
+
+std::vector<std::size_t>
+UDQDependencyGraph::most_expensive_chain(const History& history) const
+{
+    if (history.graph != this->id_) {
+        return {};
+    }
+
+    const auto n = this->nodes_.size();
+
+    // Nodes are topologically sorted, so a single forward sweep computes
+    // the most expensive chain ending in each node.
+    auto cost = std::vector<double>(n, 0.0);
+    auto prev = std::vector<std::optional<std::size_t>>(n);
+
+    auto last = std::optional<std::size_t>{};
+    for (auto j = 0*n; j < n; ++j) {
+        const auto& node = this->nodes_[j];
+
+        for (const auto i : node.upstream) {
+            if (! prev[j].has_value() || (cost[i] > cost[*prev[j]])) {
+                prev[j] = i;
+            }
+        }
+
+        cost[j] = history.nodes[j].evaluation_time
+            + (prev[j].has_value() ? cost[*prev[j]] : 0.0);
+
+        if ((cost[j] > 0.0) && (! last.has_value() || (cost[j] > cost[*last]))) {
+            last = j;
+        }
+    }
+
+    auto chain = std::vector<std::size_t>{};
+    for (auto node = last; node.has_value(); node = prev[*node]) {
+        chain.push_back(*node);
+    }
+
+    std::reverse(chain.begin(), chain.end());
+    return chain;
+}
+
+void UDQDependencyGraph::begin_pass(const std::vector<NameTable::Index>& wells,
+                                    const std::vector<NameTable::Index>& groups,
+                                    UDQState&                            udq_state) const
+{
+    auto& history = udq_state.define_history();
+
+    if (history.graph != this->id_) {
+        history = History{};
+        history.graph = this->id_;
+        history.nodes.resize(this->nodes_.size());
+    }
+
+    if ((wells != history.wells) ||
+        (groups != history.groups) ||
+        (history.udq_version != udq_state.version()))
+    {
+        for (auto& node : history.nodes) {
+            node.valid = false;
+        }
+
+        history.wells = wells;
+        history.groups = groups;
+    }
+}
+
+void UDQDependencyGraph::end_pass(UDQState& udq_state) const
+{
+    udq_state.define_history().udq_version = udq_state.version();
+}
+
+std::vector<std::uint64_t>
+UDQDependencyGraph::input_versions(const std::size_t node, const SummaryState& st) const
+{
+    const auto& n = this->nodes_[node];
+
+    auto versions = std::vector<std::uint64_t>{};
+    versions.reserve(n.summary_inputs.size() + n.udq_inputs.size() + 1);
+
+    for (const auto& vector : n.summary_inputs) {
+        versions.push_back(st.var_version(vector));
+    }
+
+    for (const auto& udq : n.udq_inputs) {
+        versions.push_back(st.var_version(udq));
+    }
+
+    versions.push_back(st.var_version(n.keyword));
+
+    return versions;
+}
+
+bool UDQDependencyGraph::up_to_date(const std::size_t                 node,
+                                    const std::vector<std::uint64_t>& versions,
+                                    const UDQState&                   udq_state) const
+{
+    const auto& history = udq_state.define_history();
+    if (history.graph != this->id_) {
+        return false;
+    }
+
+    const auto& prev = history.nodes[node];
+
+    return prev.valid
+        && ! this->nodes_[node].always_evaluate
+        && (prev.stamps == versions);
+}
+
+void UDQDependencyGraph::record_evaluation(const std::size_t          node,
+                                           std::vector<std::uint64_t> versions,
+                                           const SummaryState&        st,
+                                           const double               seconds,
+                                           UDQState&                  udq_state) const
+{
+    auto& n = udq_state.define_history().nodes[node];
+
+    n.num_evaluations += 1;
+    n.evaluation_time += seconds;
+
+    // Own stamp after the update, so that the node becomes dirty if
+    // something else assigns a new value to the quantity.
+    versions.back() = st.var_version(this->nodes_[node].keyword);
+
+    n.valid = true;
+    n.stamps = std::move(versions);
+}
+
+void UDQDependencyGraph::record_skip(const std::size_t node, UDQState& udq_state) const
+{
+    udq_state.define_history().nodes[node].num_skipped += 1;
+}
+
+} // namespace Opm
@@ -0,0 +1,251 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_DEPENDENCY_GRAPH_HPP
+#define UDQ_DEPENDENCY_GRAPH_HPP
+
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+
+class SummaryState;
+class UDQDefine;
+class UDQState;
+
+} // namespace Opm
+
+namespace Opm {
+
+/// Dependency graph of the DEFINEd quantities in a UDQConfig.
+///
+/// There is one node for each DEFINE statement, in evaluation order, and
+/// an edge from node i to node j whenever the defining expression of j
+/// reads the quantity defined by i.  The graph itself is immutable.  The
+/// modification stamps of each node's inputs--see
+/// SummaryState::var_version()--as of the node's most recent evaluation
+/// are kept in a History object owned by the UDQState whose values the
+/// evaluation passes compute.  UDQConfig::eval() uses this information to
+/// skip those DEFINE statements none of whose inputs changed since the
+/// previous evaluation.
+class UDQDependencyGraph
+{
+public:
+    /// Single DEFINE statement.
+    struct Node
+    {
+        /// Defined quantity, e.g., WUBHP or FUOPR.
+        std::string keyword{};
+
+        /// Category of defined quantity.
+        UDQVarType var_type{UDQVarType::NONE};
+
+        /// Summary vectors, e.g., WOPR or FGPT, read by the expression.
+        std::vector<std::string> summary_inputs{};
+
+        /// User defined quantities read by the expression.
+        std::vector<std::string> udq_inputs{};
+
+        /// Nodes, evaluated before this one, which define one of the
+        /// udq_inputs.
+        std::vector<std::size_t> upstream{};
+
+        /// Nodes, evaluated after this one, which read this quantity.
+        std::vector<std::size_t> downstream{};
+
+        /// Whether or not the expression reads its own value or that of a
+        /// quantity which is defined later in the evaluation order.  Such
+        /// expressions see the value from the previous evaluation.
+        bool feedback{false};
+
+        /// Whether or not this node is evaluated irrespective of changes
+        /// to its inputs.  Applies to expressions with random numbers,
+        /// segment or region level quantities, and well lists.
+        bool always_evaluate{false};
+    };
+
+    /// Evaluation record of a single node.
+    struct NodeHistory
+    {
+        /// Whether or not \c stamps describes the node's most recent
+        /// evaluation.
+        bool valid{false};
+
+        /// Input stamps as of the node's most recent evaluation.  The last
+        /// element is the stamp of the node's own quantity after
+        /// evaluation.
+        std::vector<std::uint64_t> stamps{};
+
+        /// Number of times the expression was evaluated.
+        std::size_t num_evaluations{0};
+
+        /// Number of times evaluation was skipped because no input changed.
+        std::size_t num_skipped{0};
+
+        /// Accumulated evaluation time in seconds.
+        double evaluation_time{0.0};
+    };
+
+    /// Evaluation record of all nodes of a single graph over a sequence of
+    /// evaluation passes.
+    struct History
+    {
+        /// Identity of the graph to which the record applies.  Zero if
+        /// none.
+        std::uint64_t graph{0};
+
+        /// Interned names of the wells of the most recent pass.
+        std::vector<NameTable::Index> wells{};
+
+        /// Interned names of the groups of the most recent pass.
+        std::vector<NameTable::Index> groups{};
+
+        /// UDQState::version() at the end of the most recent pass.
+        std::optional<std::uint64_t> udq_version{};
+
+        /// Evaluation record of each node, in evaluation order.
+        std::vector<NodeHistory> nodes{};
+    };
+
+    /// Default constructor.  Empty graph.
+    UDQDependencyGraph();
+
+    /// Constructor.
+    ///
+    /// \param[in] definitions DEFINE statements in evaluation order.
+    explicit UDQDependencyGraph(const std::vector<const UDQDefine*>& definitions);
+
+    /// Identity of this graph.  Unique among all graphs created in the
+    /// current process and shared by copies.
+    std::uint64_t id() const
+    {
+        return this->id_;
+    }
+
+    /// All nodes, in evaluation order.
+    const std::vector<Node>& nodes() const
+    {
+        return this->nodes_;
+    }
+
+    /// Node index of a DEFINEd quantity.
+    ///
+    /// \param[in] keyword Defined quantity, e.g., WUBHP.
+    ///
+    /// \return Index into nodes(), or nullopt if \p keyword is not
+    ///   DEFINEd.
+    std::optional<std::size_t> index(const std::string& keyword) const;
+
+    /// Chain of dependent nodes with the largest accumulated evaluation
+    /// time.
+    ///
+    /// \param[in] history Evaluation record, typically
+    ///   UDQState::define_history().
+    ///
+    /// \return Node indices, ordered from upstream to downstream.  Empty
+    ///   if no node has been evaluated or if \p history pertains to a
+    ///   different graph.
+    std::vector<std::size_t> most_expensive_chain(const History& history) const;
+
+    /// Start an evaluation pass.
+    ///
+    /// Forgets all previous evaluations if the evaluation record of \p
+    /// udq_state pertains to a different graph, if the set of wells or
+    /// groups has changed, or if the UDQ values were modified by anything
+    /// but the previous pass, e.g., by an ASSIGN statement.
+    ///
+    /// \param[in] wells Interned names of the wells of the UDQ
+    ///   evaluation context.
+    ///
+    /// \param[in] groups Interned names of the groups of the UDQ
+    ///   evaluation context.
+    ///
+    /// \param[in,out] udq_state Current UDQ values and evaluation record.
+    void begin_pass(const std::vector<NameTable::Index>& wells,
+                    const std::vector<NameTable::Index>& groups,
+                    UDQState&                            udq_state) const;
+
+    /// Complete an evaluation pass.
+    ///
+    /// \param[in,out] udq_state UDQ values resulting from this pass and
+    ///   evaluation record.
+    void end_pass(UDQState& udq_state) const;
+
+    /// Current modification stamps of a node's inputs.
+    ///
+    /// \param[in] node Node index.
+    ///
+    /// \param[in] st Summary vectors and UDQ values.
+    std::vector<std::uint64_t>
+    input_versions(std::size_t node, const SummaryState& st) const;
+
+    /// Whether or not a node's inputs are unchanged since its most recent
+    /// evaluation.
+    ///
+    /// \param[in] node Node index.
+    ///
+    /// \param[in] versions Result of input_versions() for \p node.
+    ///
+    /// \param[in] udq_state Evaluation record.
+    bool up_to_date(std::size_t                       node,
+                    const std::vector<std::uint64_t>& versions,
+                    const UDQState&                   udq_state) const;
+
+    /// Record that a node was evaluated.
+    ///
+    /// \param[in] node Node index.
+    ///
+    /// \param[in] versions Result of input_versions() for \p node prior
+    ///   to evaluation.
+    ///
+    /// \param[in] st Summary vectors and UDQ values, including the result
+    ///   of this evaluation.
+    ///
+    /// \param[in] seconds Evaluation time.
+    ///
+    /// \param[in,out] udq_state Evaluation record.
+    void record_evaluation(std::size_t                node,
+                           std::vector<std::uint64_t> versions,
+                           const SummaryState&        st,
+                           double                     seconds,
+                           UDQState&                  udq_state) const;
+
+    /// Record that a node's evaluation was skipped.
+    ///
+    /// \param[in] node Node index.
+    ///
+    /// \param[in,out] udq_state Evaluation record.
+    void record_skip(std::size_t node, UDQState& udq_state) const;
+
+private:
+    std::uint64_t id_{};
+    std::vector<Node> nodes_{};
+    std::unordered_map<std::string, std::size_t> index_{};
+};
+
+} // namespace Opm
+
+#endif // UDQ_DEPENDENCY_GRAPH_HPP
@@ -0,0 +1,758 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "UDQProgram.hpp"
+
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQParams.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+    /// Thrown when evaluation reaches a situation which only the expression
+    /// tree evaluator handles, typically one that is reported as an error.
+    /// Deliberately not derived from std::exception so that eval() never
+    /// mistakes a genuine error for one of these.
+    struct Unsupported {};
+
+    constexpr double undefined = std::numeric_limits<double>::quiet_NaN();
+
+    bool isDefined(const double x)
+    {
+        return ! std::isnan(x);
+    }
+
+    /// Mirrors UDQScalar::assign(), which leaves non-finite values
+    /// undefined.  Written as a comparison so that loops using it
+    /// vectorise.
+    double finiteOrUndefined(const double x)
+    {
+        return (std::abs(x) <= std::numeric_limits<double>::max())
+            ? x : undefined;
+    }
+
+    double fromOptional(const std::optional<double>& x)
+    {
+        return x.has_value() ? finiteOrUndefined(*x) : undefined;
+    }
+
+    /// Intermediate result.  Scalar and field level values have a single
+    /// element, well and group level values one element per well or
+    /// non-field group in the UDQ context.
+    struct Value
+    {
+        Opm::UDQVarType type{Opm::UDQVarType::SCALAR};
+        std::vector<double> values{};
+    };
+
+    bool isScalar(const Value& v)
+    {
+        return (v.type == Opm::UDQVarType::SCALAR)
+            || (v.type == Opm::UDQVarType::FIELD_VAR);
+    }
+
+    bool isSet(const Value& v)
+    {
+        return (v.type == Opm::UDQVarType::WELL_VAR)
+            || (v.type == Opm::UDQVarType::GROUP_VAR);
+    }
+
+    Value broadcast(const Value& scalar, const Value& set)
+    {
+        if (! isDefined(scalar.values.front())) {
+            throw Unsupported{};
+        }
+
+        return { set.type, std::vector<double>(set.values.size(), scalar.values.front()) };
+    }
+
+    /// Mirrors udq_cast() in UDQSet.cpp.
+    void promote(Value& lhs, Value& rhs)
+    {
+        if ((lhs.type == rhs.type) || (isScalar(lhs) && isScalar(rhs))) {
+            return;
+        }
+
+        if (isScalar(lhs) && isSet(rhs)) {
+            lhs = broadcast(lhs, rhs);
+        }
+        else if (isScalar(rhs) && isSet(lhs)) {
+            rhs = broadcast(rhs, lhs);
+        }
+        else {
+            throw Unsupported{};
+        }
+    }
+
+    template <typename Op>
+    void combine(Value& lhs, const Value& rhs, Op&& op)
+    {
+        const auto n = lhs.values.size();
+        if (rhs.values.size() != n) {
+            throw Unsupported{};
+        }
+
+        double* l = lhs.values.data();
+        const double* r = rhs.values.data();
+        for (std::size_t i = 0; i < n; ++i) {
+            l[i] = finiteOrUndefined(op(l[i], r[i]));
+        }
+    }
+
+    Value relativeCompare(Value lhs, Value rhs,
+                          const Opm::UDQTokenType func,
+                          const double eps)
+    {
+        promote(lhs, rhs);
+
+        auto result = lhs;
+        combine(result, rhs, std::minus<>{});
+
+        for (std::size_t i = 0; i < result.values.size(); ++i) {
+            const auto diff = result.values[i];
+            if (! isDefined(diff)) {
+                continue;
+            }
+
+            if (diff == 0.0) {
+                result.values[i] = (func == Opm::UDQTokenType::binary_cmp_ne) ? 0.0 : 1.0;
+                continue;
+            }
+
+            const auto rel_diff = finiteOrUndefined(diff / lhs.values[i]);
+            if (! isDefined(rel_diff)) {
+                throw Unsupported{};
+            }
+
+            switch (func) {
+            case Opm::UDQTokenType::binary_cmp_eq:
+                result.values[i] = ! (std::fabs(rel_diff) > eps);
+                break;
+
+            case Opm::UDQTokenType::binary_cmp_ne:
+                result.values[i] = 1.0 - ! (std::fabs(rel_diff) > eps);
+                break;
+
+            case Opm::UDQTokenType::binary_cmp_le:
+                result.values[i] = ! (rel_diff > eps);
+                break;
+
+            default: // binary_cmp_ge
+                result.values[i] = ! (rel_diff < -eps);
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    Value unionCombine(Value lhs, const Value& rhs,
+                       const std::function<double(double, double)>& op)
+    {
+        if (lhs.values.size() != rhs.values.size()) {
+            throw Unsupported{};
+        }
+
+        for (std::size_t i = 0; i < lhs.values.size(); ++i) {
+            const auto l = lhs.values[i];
+            const auto r = rhs.values[i];
+
+            if (isDefined(l) && isDefined(r)) {
+                lhs.values[i] = finiteOrUndefined(op(r, l));
+            }
+            else if (isDefined(r)) {
+                lhs.values[i] = r;
+            }
+        }
+
+        return lhs;
+    }
+
+    Value binary(Value lhs, Value rhs,
+                 const Opm::UDQTokenType func,
+                 const double eps)
+    {
+        using TT = Opm::UDQTokenType;
+
+        switch (func) {
+        case TT::binary_op_add:
+            promote(lhs, rhs);
+            combine(lhs, rhs, std::plus<>{});
+            return lhs;
+
+        case TT::binary_op_sub:
+            promote(lhs, rhs);
+            combine(lhs, rhs, std::minus<>{});
+            return lhs;
+
+        case TT::binary_op_mul:
+            promote(lhs, rhs);
+            combine(lhs, rhs, std::multiplies<>{});
+            return lhs;
+
+        case TT::binary_op_div:
+            promote(lhs, rhs);
+            combine(lhs, rhs, std::divides<>{});
+            return lhs;
+
+        case TT::binary_op_pow:
+            // No type promotion.  Elements of 'lhs' for which 'rhs' is
+            // undefined retain their value.
+            if (rhs.values.size() < lhs.values.size()) {
+                throw Unsupported{};
+            }
+
+            for (std::size_t i = 0; i < lhs.values.size(); ++i) {
+                if (isDefined(lhs.values[i]) && isDefined(rhs.values[i])) {
+                    lhs.values[i] = finiteOrUndefined(std::pow(lhs.values[i], rhs.values[i]));
+                }
+            }
+            return lhs;
+
+        case TT::binary_cmp_gt:
+        case TT::binary_cmp_lt:
+            promote(lhs, rhs);
+            combine(lhs, rhs, std::minus<>{});
+            for (auto& x : lhs.values) {
+                if (isDefined(x)) {
+                    x = (func == TT::binary_cmp_gt) ? (x > 0.0) : (x < 0.0);
+                }
+            }
+            return lhs;
+
+        case TT::binary_cmp_eq:
+        case TT::binary_cmp_ne:
+        case TT::binary_cmp_le:
+        case TT::binary_cmp_ge:
+            return relativeCompare(std::move(lhs), std::move(rhs), func, eps);
+
+        case TT::binary_op_uadd:
+            return unionCombine(std::move(lhs), rhs, std::plus<>{});
+
+        case TT::binary_op_umul:
+            return unionCombine(std::move(lhs), rhs, std::multiplies<>{});
+
+        case TT::binary_op_umin:
+            return unionCombine(std::move(lhs), rhs,
+                                [](const double r, const double l) { return std::min(r, l); });
+
+        case TT::binary_op_umax:
+            return unionCombine(std::move(lhs), rhs,
+                                [](const double r, const double l) { return std::max(r, l); });
+
+        default:
+            throw Unsupported{};
+        }
+    }
+
+    template <typename Compare>
+    void sortOrder(Value& arg, Compare&& cmp)
+    {
+        auto ix = std::vector<int>{};
+        for (std::size_t i = 0; i < arg.values.size(); ++i) {
+            if (isDefined(arg.values[i])) {
+                ix.push_back(static_cast<int>(i));
+            }
+        }
+
+        const auto& values = arg.values;
+        std::sort(ix.begin(), ix.end(), [&values, &cmp](const int i1, const int i2)
+        {
+            return cmp(values[i1], values[i2]);
+        });
+
+        auto sort_value = 1.0;
+        auto ranks = arg.values;
+        for (const auto& i : ix) {
+            ranks[i] = sort_value++;
+        }
+
+        arg.values.swap(ranks);
+    }
+
+    void elemental(Value& arg, const Opm::UDQTokenType func)
+    {
+        using TT = Opm::UDQTokenType;
+
+        auto& v = arg.values;
+        switch (func) {
+        case TT::elemental_func_abs:
+            for (auto& x : v) { x = std::fabs(x); }
+            break;
+
+        case TT::elemental_func_def:
+            for (auto& x : v) { x = isDefined(x) ? 1.0 : undefined; }
+            break;
+
+        case TT::elemental_func_idv:
+            for (auto& x : v) { x = isDefined(x) ? 1.0 : 0.0; }
+            break;
+
+        case TT::elemental_func_exp:
+            for (auto& x : v) { x = finiteOrUndefined(std::exp(x)); }
+            break;
+
+        case TT::elemental_func_nint:
+            for (auto& x : v) { x = std::nearbyint(x); }
+            break;
+
+        case TT::elemental_func_ln:
+        case TT::elemental_func_log:
+            if (std::any_of(v.begin(), v.end(), [](const double x) { return x <= 0.0; })) {
+                throw Unsupported{};
+            }
+
+            for (auto& x : v) {
+                x = finiteOrUndefined((func == TT::elemental_func_ln)
+                                      ? std::log(x) : std::log10(x));
+            }
+            break;
+
+        case TT::elemental_func_sorta:
+            sortOrder(arg, std::less<>{});
+            break;
+
+        case TT::elemental_func_sortd:
+            sortOrder(arg, std::greater<>{});
+            break;
+
+        default:
+            throw Unsupported{};
+        }
+    }
+
+    Value reduce(const Value& arg, const Opm::UDQTokenType func)
+    {
+        using TT = Opm::UDQTokenType;
+
+        auto defined = std::vector<double>{};
+        defined.reserve(arg.values.size());
+        std::copy_if(arg.values.begin(), arg.values.end(),
+                     std::back_inserter(defined), isDefined);
+
+        if (defined.empty()) {
+            // Expression tree evaluator produces an empty set.
+            throw Unsupported{};
+        }
+
+        // Accumulation order matches UDQScalarFunction.
+        auto result = 0.0;
+        switch (func) {
+        case TT::scalar_func_sum:
+            for (const auto& x : defined) { result = result + x; }
+            break;
+
+        case TT::scalar_func_avea:
+            for (const auto& x : defined) { result = result + x; }
+            result /= defined.size();
+            break;
+
+        case TT::scalar_func_aveg:
+            if (std::any_of(defined.begin(), defined.end(), [](const double x) { return x <= 0.0; })) {
+                throw Unsupported{};
+            }
+            for (const auto& x : defined) { result = result + std::log(x); }
+            result = std::exp(result / defined.size());
+            break;
+
+        case TT::scalar_func_aveh:
+            for (const auto& x : defined) { result = result + 1.0/x; }
+            result = defined.size() / result;
+            break;
+
+        case TT::scalar_func_max:
+            result = *std::max_element(defined.begin(), defined.end());
+            break;
+
+        case TT::scalar_func_min:
+            result = *std::min_element(defined.begin(), defined.end());
+            break;
+
+        case TT::scalar_func_norm1:
+            for (const auto& x : defined) { result = result + std::fabs(x); }
+            break;
+
+        case TT::scalar_func_norm2:
+            for (const auto& x : defined) { result = result + x*x; }
+            result = std::sqrt(result);
+            break;
+
+        case TT::scalar_func_normi:
+            for (const auto& x : defined) { result = std::max(result, std::fabs(x)); }
+            break;
+
+        case TT::scalar_func_prod:
+            result = 1.0;
+            for (const auto& x : defined) { result = result * x; }
+            break;
+
+        default:
+            throw Unsupported{};
+        }
+
+        return { Opm::UDQVarType::SCALAR, { finiteOrUndefined(result) } };
+    }
+
+    bool compiledFunction(const Opm::UDQTokenType func)
+    {
+        using TT = Opm::UDQTokenType;
+
+        // Random number generators must draw from the shared generators
+        // in the same order as the expression tree evaluator, and UNDEF
+        // produces an untyped set.  Leave those to the expression tree.
+        return (func != TT::elemental_func_randn)
+            && (func != TT::elemental_func_randu)
+            && (func != TT::elemental_func_rrandn)
+            && (func != TT::elemental_func_rrandu)
+            && (func != TT::elemental_func_undef);
+    }
+
+    std::optional<double> toOptional(const double x)
+    {
+        if (isDefined(x)) {
+            return x;
+        }
+
+        return std::nullopt;
+    }
+
+    Opm::UDQSet toSet(const Value& result, const Opm::UDQContext& context)
+    {
+        const auto name = std::string{};
+
+        switch (result.type) {
+        case Opm::UDQVarType::WELL_VAR: {
+            auto set = Opm::UDQSet::indexed_wells(name, context.well_indices());
+            for (std::size_t i = 0; i < result.values.size(); ++i) {
+                if (isDefined(result.values[i])) {
+                    set.assign(i, result.values[i]);
+                }
+            }
+            return set;
+        }
+
+        case Opm::UDQVarType::GROUP_VAR: {
+            auto set = Opm::UDQSet::indexed_groups(name, context.group_indices());
+            for (std::size_t i = 0; i < result.values.size(); ++i) {
+                if (isDefined(result.values[i])) {
+                    set.assign(i, result.values[i]);
+                }
+            }
+            return set;
+        }
+
+        case Opm::UDQVarType::FIELD_VAR: {
+            auto set = Opm::UDQSet { name, Opm::UDQVarType::FIELD_VAR };
+            set.assign(toOptional(result.values.front()));
+            return set;
+        }
+
+        default:
+            return Opm::UDQSet::scalar(name, toOptional(result.values.front()));
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+std::unique_ptr<UDQProgram>
+UDQProgram::compile(const UDQASTNode& ast, const UDQVarType target_type)
+{
+    if ((target_type != UDQVarType::WELL_VAR) &&
+        (target_type != UDQVarType::GROUP_VAR) &&
+        (target_type != UDQVarType::FIELD_VAR) &&
+        (target_type != UDQVarType::SCALAR))
+    {
+        return {};
+    }
+
+    auto program = std::make_unique<UDQProgram>();
+    program->target_type_ = target_type;
+    program->uses_groups_ = target_type == UDQVarType::GROUP_VAR;
+
+    if (! program->compileNode(ast)) {
+        return {};
+    }
+
+    return program;
+}
+
+bool UDQProgram::compileNode(const UDQASTNode& node)
+{
+    const auto type = node.token_type();
+
+    auto instr = Instruction{};
+    instr.func = type;
+
+    if (type == UDQTokenType::ecl_expr) {
+        const auto& vector = std::get<std::string>(node.token_value());
+        const auto& selector = node.token_selector();
+
+        instr.vector = vector;
+
+        switch (UDQ::targetType(vector)) {
+        case UDQVarType::WELL_VAR:
+            instr.var = NameTable::index(vector);
+
+            if (selector.empty()) {
+                instr.op = OpCode::WellVector;
+            }
+            else {
+                instr.selector = selector.front();
+                instr.op = (instr.selector.find('*') == std::string::npos)
+                    ? OpCode::WellScalar : OpCode::WellPattern;
+
+                if (instr.op == OpCode::WellScalar) {
+                    instr.entity = NameTable::index(instr.selector);
+                }
+
+                this->uses_patterns_ = this->uses_patterns_
+                    || (instr.op == OpCode::WellPattern);
+            }
+            break;
+
+        case UDQVarType::GROUP_VAR:
+            instr.var = NameTable::index(vector);
+
+            if (selector.empty()) {
+                instr.op = OpCode::GroupVector;
+                this->uses_groups_ = true;
+            }
+            else if (selector.front().find('*') == std::string::npos) {
+                instr.op = OpCode::GroupScalar;
+                instr.selector = selector.front();
+                instr.entity = NameTable::index(instr.selector);
+            }
+            else {
+                return false;
+            }
+            break;
+
+        case UDQVarType::SEGMENT_VAR:
+        case UDQVarType::REGION_VAR:
+        case UDQVarType::TABLE_LOOKUP:
+            return false;
+
+        case UDQVarType::FIELD_VAR:
+            instr.op = OpCode::FieldScalar;
+            break;
+
+        default:
+            instr.op = OpCode::Scalar;
+            break;
+        }
+    }
+    else if (UDQ::scalarFunc(type) || UDQ::elementalUnaryFunc(type)) {
+        if ((node.get_left() == nullptr) || !compiledFunction(type) ||
+            !this->compileNode(*node.get_left()))
+        {
+            return false;
+        }
+
+        instr.op = UDQ::scalarFunc(type) ? OpCode::Reduction : OpCode::Elemental;
+    }
+    else if (UDQ::binaryFunc(type)) {
+        if ((node.get_left() == nullptr) || (node.get_right() == nullptr) ||
+            !this->compileNode(*node.get_left()) ||
+            !this->compileNode(*node.get_right()))
+        {
+            return false;
+        }
+
+        instr.op = OpCode::Binary;
+    }
+    else if (type == UDQTokenType::number) {
+        instr.op = OpCode::Number;
+        instr.number = std::get<double>(node.token_value());
+    }
+    else {
+        return false;
+    }
+
+    this->instructions_.push_back(std::move(instr));
+
+    if (const auto sign = node.sign_factor(); sign != 1.0) {
+        auto scale = Instruction{};
+        scale.op = OpCode::Scale;
+        scale.number = sign;
+
+        this->instructions_.push_back(std::move(scale));
+    }
+
+    return true;
+}
+
+std::optional<UDQSet> UDQProgram::eval(const UDQContext& context) const
+{
+    try {
+        const auto& wells = context.wells();
+        const auto& well_ids = context.well_indices();
+        const auto groups = this->uses_groups_
+            ? context.nonFieldGroups()
+            : std::vector<std::string>{};
+
+        auto well_index = std::unordered_map<std::string_view, std::size_t>{};
+        if (this->uses_patterns_) {
+            for (std::size_t i = 0; i < wells.size(); ++i) {
+                well_index.emplace(wells[i], i);
+            }
+        }
+
+        const auto eps = context.function_table().getParams().cmpEpsilon();
+
+        auto stack = std::vector<Value>{};
+        auto pop = [&stack]()
+        {
+            auto v = std::move(stack.back());
+            stack.pop_back();
+            return v;
+        };
+
+        for (const auto& instr : this->instructions_) {
+            switch (instr.op) {
+            case OpCode::Number:
+                if ((this->target_type_ == UDQVarType::WELL_VAR) ||
+                    (this->target_type_ == UDQVarType::GROUP_VAR))
+                {
+                    const auto n = (this->target_type_ == UDQVarType::WELL_VAR)
+                        ? wells.size() : groups.size();
+
+                    stack.push_back({ this->target_type_,
+                            std::vector<double>(n, finiteOrUndefined(instr.number)) });
+                }
+                else {
+                    stack.push_back({ this->target_type_, { finiteOrUndefined(instr.number) } });
+                }
+                break;
+
+            case OpCode::WellVector: {
+                auto v = Value { UDQVarType::WELL_VAR, std::vector<double>(wells.size()) };
+                const auto values = context.well_var_values(instr.var);
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    v.values[i] = fromOptional(values[i]);
+                }
+                stack.push_back(std::move(v));
+                break;
+            }
+
+            case OpCode::WellScalar:
+                stack.push_back({ UDQVarType::SCALAR,
+                        { fromOptional(context.get_well_var(instr.entity, instr.var)) } });
+                break;
+
+            case OpCode::WellPattern: {
+                auto v = Value { UDQVarType::WELL_VAR, std::vector<double>(wells.size(), undefined) };
+                for (const auto& well : context.wells(instr.selector)) {
+                    const auto pos = well_index.find(well);
+                    if (pos == well_index.end()) {
+                        throw Unsupported{};
+                    }
+
+                    v.values[pos->second] = fromOptional(context.get_well_var(well_ids[pos->second], instr.var));
+                }
+                stack.push_back(std::move(v));
+                break;
+            }
+
+            case OpCode::GroupVector: {
+                auto v = Value { UDQVarType::GROUP_VAR, std::vector<double>(groups.size()) };
+                const auto values = context.group_var_values(instr.var);
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    v.values[i] = fromOptional(values[i]);
+                }
+                stack.push_back(std::move(v));
+                break;
+            }
+
+            case OpCode::GroupScalar:
+                stack.push_back({ UDQVarType::SCALAR,
+                        { fromOptional(context.get_group_var(instr.entity, instr.var)) } });
+                break;
+
+            case OpCode::FieldScalar:
+                stack.push_back({ UDQVarType::SCALAR, { fromOptional(context.get(instr.vector)) } });
+                break;
+
+            case OpCode::Scalar: {
+                const auto value = context.get(instr.vector);
+                if (! value.has_value()) {
+                    throw Unsupported{};
+                }
+                stack.push_back({ UDQVarType::SCALAR, { finiteOrUndefined(*value) } });
+                break;
+            }
+
+            case OpCode::Elemental:
+                elemental(stack.back(), instr.func);
+                break;
+
+            case OpCode::Reduction:
+                stack.push_back(reduce(pop(), instr.func));
+                break;
+
+            case OpCode::Binary: {
+                auto rhs = pop();
+                auto lhs = pop();
+                stack.push_back(binary(std::move(lhs), std::move(rhs), instr.func, eps));
+                break;
+            }
+
+            case OpCode::Scale:
+                for (auto& x : stack.back().values) {
+                    x = finiteOrUndefined(x * instr.number);
+                }
+                break;
+            }
+        }
+
+        if (stack.size() != 1) {
+            return std::nullopt;
+        }
+
+        return toSet(stack.back(), context);
+    }
+    catch (const Unsupported&) {
+        // Situation which only the expression tree evaluator handles.
+        // Other errors, e.g., unknown summary vectors, propagate to the
+        // caller exactly as they do from the expression tree.
+        return std::nullopt;
+    }
+}
+
+} // namespace Opm
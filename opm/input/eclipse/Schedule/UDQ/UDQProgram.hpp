@@ -0,0 +1,137 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_PROGRAM_HPP
+#define UDQ_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+
+} // namespace Opm
+
+namespace Opm {
+
+/// Compiled form of a UDQ DEFINE expression.
+///
+/// The expression tree is lowered to a flat, postfix instruction list which
+/// operates on dense arrays of values indexed by well or group position in
+/// the UDQ context.  Undefined elements are represented as NaN, which lets
+/// the elemental operations run as plain loops over contiguous storage
+/// instead of creating a named UDQScalar for every element of every
+/// intermediate result.
+///
+/// The program covers well, group, field and scalar level expressions.
+/// Expressions involving segments, regions, table lookups or random number
+/// generators are not compiled.  Evaluation returns an empty optional
+/// when it encounters one of a known set of situations--e.g., undefined
+/// scalars in set operations, logarithms of non-positive values or empty
+/// reductions--which the expression tree evaluator turns into an error or
+/// an empty result set, and the caller is then expected to use the
+/// expression tree instead.  That way the compiled program never has to
+/// replicate that error reporting.  Any other error, such as a reference
+/// to an unknown summary vector, propagates from eval() in the same way
+/// as it does from the expression tree.
+///
+/// Well and group level summary vectors, and explicitly named wells and
+/// groups, are interned in the NameTable at compile time so evaluation
+/// does not need to hash or format summary keys.
+class UDQProgram
+{
+public:
+    /// Compile DEFINE expression.
+    ///
+    /// \param[in] ast Expression tree of DEFINE statement.
+    ///
+    /// \param[in] target_type Variable type of DEFINE statement.
+    ///
+    /// \return Compiled program, or nullptr if the expression uses
+    ///   features which the program does not support.
+    static std::unique_ptr<UDQProgram>
+    compile(const UDQASTNode& ast, UDQVarType target_type);
+
+    /// Evaluate compiled expression.
+    ///
+    /// \param[in] context Summary vectors, UDQ values and well/group names.
+    ///
+    /// \return Result set identical to the result of evaluating the
+    ///   expression tree, or nullopt if the expression tree must be used.
+    std::optional<UDQSet> eval(const UDQContext& context) const;
+
+private:
+    enum class OpCode
+    {
+        Number,
+        WellVector,
+        WellScalar,
+        WellPattern,
+        GroupVector,
+        GroupScalar,
+        FieldScalar,
+        Scalar,
+        Elemental,
+        Reduction,
+        Binary,
+        Scale,
+    };
+
+    struct Instruction
+    {
+        OpCode op{OpCode::Number};
+
+        /// Function for Elemental, Reduction and Binary instructions.
+        UDQTokenType func{UDQTokenType::error};
+
+        /// Literal for Number, factor for Scale.
+        double number{};
+
+        /// Summary vector or UDQ name.
+        std::string vector{};
+
+        /// Well or group name, or well name pattern.
+        std::string selector{};
+
+        /// Interned 'vector' for well and group level instructions.
+        NameTable::Index var{};
+
+        /// Interned 'selector' for WellScalar and GroupScalar.
+        NameTable::Index entity{};
+    };
+
+    UDQVarType target_type_{UDQVarType::NONE};
+    std::vector<Instruction> instructions_{};
+    bool uses_groups_{false};
+    bool uses_patterns_{false};
+
+    bool compileNode(const UDQASTNode& node);
+};
+
+} // namespace Opm
+
+#endif // UDQ_PROGRAM_HPP
@@ -21,6 +21,7 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/RegionSetMatcher.hpp>
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
 
 #include <opm/common/utility/shmatch.hpp>
 
@@ -35,6 +36,42 @@
 
 #include <fmt/format.h>
 
+namespace {
+
+    /// Matches UDQ set elements against a well/group name or name pattern.
+    ///
+    /// Plain names are compared by their interned indices, so only true
+    /// patterns pay for shell style matching.
+    class NameMatcher
+    {
+    public:
+        explicit NameMatcher(const std::string& wgname)
+            : wgname_     (wgname)
+            , is_pattern_ (wgname.find_first_of("*?[\\") != std::string::npos)
+        {
+            if (! this->is_pattern_) {
+                this->wgindex_ = Opm::NameTable::find(wgname);
+            }
+        }
+
+        bool operator()(const Opm::UDQScalar& value) const
+        {
+            if (this->is_pattern_) {
+                return Opm::shmatch(this->wgname_, value.wgname());
+            }
+
+            return this->wgindex_.has_value()
+                && (value.wgindex() == *this->wgindex_);
+        }
+
+    private:
+        const std::string& wgname_;
+        bool is_pattern_{false};
+        std::optional<Opm::NameTable::Index> wgindex_{};
+    };
+
+} // Anonymous namespace
+
 namespace Opm {
 
 UDQScalar::UDQScalar(const double value, const std::size_t num)
@@ -44,8 +81,8 @@ UDQScalar::UDQScalar(const double value, const std::size_t num)
 }
 
 UDQScalar::UDQScalar(const std::string& wgname, const std::size_t num)
-    : m_wgname(wgname)
-    , m_num   (num)
+    : m_wgindex(NameTable::index(wgname))
+    , m_num    (num)
 {}
 
 bool UDQScalar::defined() const
@@ -58,7 +95,7 @@ double UDQScalar::get() const
     if (!this->defined()) {
         throw std::invalid_argument {
             fmt::format("UDQSCalar: Value not defined wgname = {}, num = {}",
-                        this->m_wgname, this->m_num)
+                        this->wgname(), this->m_num)
         };
     }
 
@@ -141,7 +178,7 @@ UDQScalar::operator bool() const
 bool UDQScalar::operator==(const UDQScalar& other) const
 {
     return (this->m_value == other.m_value)
-        && (this->m_wgname == other.m_wgname)
+        && (this->m_wgindex == other.m_wgindex)
         && (this->m_num == other.m_num);
 }
 
@@ -184,10 +221,27 @@ UDQSet::UDQSet(const std::string&              name,
     : m_name    (name)
     , m_var_type(var_type)
 {
+    this->values.reserve(wgnames.size());
     for (const auto& wgname : wgnames)
         this->values.emplace_back(wgname);
 }
 
+UDQSet UDQSet::indexed(const std::string&                   name,
+                       const UDQVarType                     var_type,
+                       const std::vector<NameTable::Index>& wgindices)
+{
+    UDQSet us;
+    us.m_name = name;
+    us.m_var_type = var_type;
+
+    us.values.resize(wgindices.size());
+    for (auto i = 0*wgindices.size(); i < wgindices.size(); ++i) {
+        us.values[i].m_wgindex = wgindices[i];
+    }
+
+    return us;
+}
+
 UDQSet::UDQSet(const std::string&                  name,
                const UDQVarType                    var_type,
                const std::vector<EnumeratedItems>& items)
@@ -195,8 +249,12 @@ UDQSet::UDQSet(const std::string&                  name,
     , m_var_type(var_type)
 {
     for (const auto& item : items) {
+        const auto wgindex = NameTable::index(item.name);
+
         for (const auto& number : item.numbers) {
-            this->values.emplace_back(item.name, number);
+            auto& value = this->values.emplace_back();
+            value.m_wgindex = wgindex;
+            value.m_num = number;
         }
     }
 }
@@ -258,6 +316,21 @@ UDQSet UDQSet::wells(const std::string&              name,
     return us;
 }
 
+UDQSet UDQSet::indexed_wells(const std::string&                   name,
+                             const std::vector<NameTable::Index>& wells)
+{
+    return UDQSet::indexed(name, UDQVarType::WELL_VAR, wells);
+}
+
+UDQSet UDQSet::indexed_wells(const std::string&                   name,
+                             const std::vector<NameTable::Index>& wells,
+                             const double                         scalar_value)
+{
+    UDQSet us = UDQSet::indexed_wells(name, wells);
+    us.assign(scalar_value);
+    return us;
+}
+
 UDQSet UDQSet::groups(const std::string&              name,
                       const std::vector<std::string>& groups)
 {
@@ -273,6 +346,21 @@ UDQSet UDQSet::groups(const std::string&              name,
     return us;
 }
 
+UDQSet UDQSet::indexed_groups(const std::string&                   name,
+                              const std::vector<NameTable::Index>& groups)
+{
+    return UDQSet::indexed(name, UDQVarType::GROUP_VAR, groups);
+}
+
+UDQSet UDQSet::indexed_groups(const std::string&                   name,
+                              const std::vector<NameTable::Index>& groups,
+                              const double                         scalar_value)
+{
+    UDQSet us = UDQSet::indexed_groups(name, groups);
+    us.assign(scalar_value);
+    return us;
+}
+
 UDQSet UDQSet::segments(const std::string&                  name,
                         const std::vector<EnumeratedItems>& segments)
 {
@@ -305,10 +393,15 @@ UDQSet UDQSet::regions(const std::string&                  name,
 
 bool UDQSet::has(const std::string& name) const
 {
+    const auto wgindex = NameTable::find(name);
+    if (! wgindex.has_value()) {
+        return false;
+    }
+
     return std::any_of(this->values.begin(), this->values.end(),
-                       [&name](const UDQScalar& value)
+                       [wgindex = *wgindex](const UDQScalar& value)
                        {
-                           return value.wgname() == name;
+                           return value.wgindex() == wgindex;
                        });
 }
 
@@ -319,9 +412,11 @@ std::size_t UDQSet::size() const
 
 void UDQSet::assign(const std::string& wgname, const double value)
 {
+    const auto matches = NameMatcher { wgname };
+
     bool assigned = false;
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (matches(udq_value)) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -342,9 +437,11 @@ void UDQSet::assign(const std::size_t index, const std::optional<double>& value)
 void UDQSet::assign(const std::string&           wgname,
                     const std::optional<double>& value)
 {
+    const auto matches = NameMatcher { wgname };
+
     bool assigned = false;
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (matches(udq_value)) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -361,10 +458,12 @@ void UDQSet::assign(const std::string&           wgname,
                     const std::size_t            number,
                     const std::optional<double>& value)
 {
+    const auto matches = NameMatcher { wgname };
+
     auto assigned = false;
 
     for (auto& udq : this->values) {
-        if ((udq.number() == number) && shmatch(wgname, udq.wgname())) {
+        if ((udq.number() == number) && matches(udq)) {
             udq.assign(value);
             assigned = true;
         }
@@ -410,6 +509,17 @@ std::vector<std::string> UDQSet::wgnames() const
     return names;
 }
 
+std::vector<NameTable::Index> UDQSet::wgindices() const
+{
+    auto indices = std::vector<NameTable::Index> {};
+    indices.reserve(this->values.size());
+
+    std::transform(this->values.begin(), this->values.end(), std::back_inserter(indices),
+                   [](const UDQScalar& value) { return value.wgindex(); });
+
+    return indices;
+}
+
 // ------------------------------------------------------------------------
 
 void UDQSet::operator+=(const UDQSet& rhs)
@@ -503,10 +613,12 @@ const UDQScalar& UDQSet::operator[](std::size_t index) const
 
 const UDQScalar& UDQSet::operator[](const std::string& wgname) const
 {
+    const auto wgindex = NameTable::find(wgname);
     auto value_iter = std::find_if(this->values.begin(), this->values.end(),
-                                   [&wgname](const UDQScalar& value)
+                                   [&wgindex](const UDQScalar& value)
                                    {
-                                       return value.wgname() == wgname;
+                                       return wgindex.has_value()
+                                           && (value.wgindex() == *wgindex);
                                    });
 
     if (value_iter == this->values.end()) {
@@ -520,11 +632,13 @@ const UDQScalar&
 UDQSet::operator()(const std::string& well,
                    const std::size_t  item) const
 {
+    const auto wgindex = NameTable::find(well);
     auto value_iter = std::find_if(this->values.begin(), this->values.end(),
-                                   [&well, item](const UDQScalar& value)
+                                   [&wgindex, item](const UDQScalar& value)
                                    {
-                                       return (value.number() == item)
-                                           && (value.wgname() == well);
+                                       return wgindex.has_value()
+                                           && (value.number() == item)
+                                           && (value.wgindex() == *wgindex);
                                    });
 
     if (value_iter == this->values.end()) {
@@ -661,21 +775,21 @@ std::pair<UDQSet, UDQSet> udq_cast(const UDQSet& lhs, const UDQSet& rhs)
 
     if (is_scalar(lhs)) {
         if (rhs.var_type() == UDQVarType::WELL_VAR) {
-            return { UDQSet::wells(lhs.name(), rhs.wgnames(), lhs[0].get()), rhs };
+            return { UDQSet::indexed_wells(lhs.name(), rhs.wgindices(), lhs[0].get()), rhs };
         }
 
         if (rhs.var_type() == UDQVarType::GROUP_VAR) {
-            return { UDQSet::groups(lhs.name(), rhs.wgnames(), lhs[0].get()), rhs };
+            return { UDQSet::indexed_groups(lhs.name(), rhs.wgindices(), lhs[0].get()), rhs };
         }
     }
 
     if (is_scalar(rhs)) {
         if (lhs.var_type() == UDQVarType::WELL_VAR) {
-            return { lhs, UDQSet::wells(rhs.name(), lhs.wgnames(), rhs[0].get()) };
+            return { lhs, UDQSet::indexed_wells(rhs.name(), lhs.wgindices(), rhs[0].get()) };
         }
 
         if (lhs.var_type() == UDQVarType::GROUP_VAR) {
-            return { lhs, UDQSet::groups(rhs.name(), lhs.wgnames(), rhs[0].get()) };
+            return { lhs, UDQSet::indexed_groups(rhs.name(), lhs.wgindices(), rhs[0].get()) };
         }
     }
 
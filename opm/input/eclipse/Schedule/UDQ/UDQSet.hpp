@@ -20,6 +20,7 @@
 #ifndef UDQSET_HPP
 #define UDQSET_HPP
 
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 
 #include <cstddef>
@@ -156,7 +157,11 @@ public:
     const std::optional<double>& value() const { return this->m_value; }
 
     /// Retrive named well/group to which this scalar is associated.
-    const std::string& wgname() const { return this->m_wgname; }
+    const std::string& wgname() const { return NameTable::name(this->m_wgindex); }
+
+    /// Retrive interned index of named well/group to which this scalar is
+    /// associated.
+    NameTable::Index wgindex() const { return this->m_wgindex; }
 
     /// Retrive numbered item, typically segment or connection, to which
     /// this scalar is associated.
@@ -174,8 +179,8 @@ public:
     /// Scalar value.
     std::optional<double> m_value{};
 
-    /// Associated well/group name
-    std::string m_wgname{};
+    /// Associated well/group name.  Interned index into NameTable.
+    NameTable::Index m_wgindex{NameTable::empty_index};
 
     /// Numbered item.  Typically segment or connection.  Zero for
     /// non-numbered items.
@@ -297,6 +302,27 @@ public:
                         const std::vector<std::string>& wells,
                         double scalar_value);
 
+    /// Form a UDQ set pertaining to a set of interned well names
+    ///
+    /// \param[in] name UDQ set name
+    ///
+    /// \param[in] wells Collection of well names interned in NameTable.
+    static UDQSet indexed_wells(const std::string& name,
+                                const std::vector<NameTable::Index>& wells);
+
+    /// Form a UDQ set pertaining to a set of interned well names
+    ///
+    /// \param[in] name UDQ set name
+    ///
+    /// \param[in] wells Collection of well names interned in NameTable.
+    ///
+    /// \param[in] scalar_value Initial numeric value of every element of
+    ///    this UDQ set.  Non-finite value leaves the UDQ set elements
+    ///    undefined.
+    static UDQSet indexed_wells(const std::string& name,
+                                const std::vector<NameTable::Index>& wells,
+                                double scalar_value);
+
     /// Form a UDQ set pertaining to a set of named groups
     ///
     /// \param[in] name UDQ set name
@@ -318,6 +344,27 @@ public:
                          const std::vector<std::string>& groups,
                          double scalar_value);
 
+    /// Form a UDQ set pertaining to a set of interned group names
+    ///
+    /// \param[in] name UDQ set name
+    ///
+    /// \param[in] groups Collection of group names interned in NameTable.
+    static UDQSet indexed_groups(const std::string& name,
+                                 const std::vector<NameTable::Index>& groups);
+
+    /// Form a UDQ set pertaining to a set of interned group names
+    ///
+    /// \param[in] name UDQ set name
+    ///
+    /// \param[in] groups Collection of group names interned in NameTable.
+    ///
+    /// \param[in] scalar_value Initial numeric value of every element of
+    ///    this UDQ set.  Non-finite value leaves the UDQ set elements
+    ///    undefined.
+    static UDQSet indexed_groups(const std::string& name,
+                                 const std::vector<NameTable::Index>& groups,
+                                 double scalar_value);
+
     /// Form a UDQ set at the field level
     ///
     /// \param[in] name UDQ set name
@@ -490,6 +537,9 @@ public:
     /// Retrive names of entities associate to this UDQ set.
     std::vector<std::string> wgnames() const;
 
+    /// Retrive interned names of entities associated to this UDQ set.
+    std::vector<NameTable::Index> wgindices() const;
+
     /// Retrive the UDQ set's defined values only
     std::vector<double> defined_values() const;
 
@@ -523,6 +573,12 @@ private:
 
     /// Default constructor.  For implementing the named constructors only.
     UDQSet() = default;
+
+    /// Form a UDQ set of specific variable type for a particular set of
+    /// interned well/group names.
+    static UDQSet indexed(const std::string&                   name,
+                          UDQVarType                           var_type,
+                          const std::vector<NameTable::Index>& wgindices);
 };
 
 
@@ -19,18 +19,26 @@
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 
 #include <opm/output/eclipse/WindowedArray.hpp>
 
 #include <opm/io/eclipse/rst/state.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -51,25 +59,35 @@ using SKMap = SMap<UMap<K, V>>;
 template <typename K, typename V>
 using S2KMap = S2Map<UMap<K, V>>;
 
+// Placeholder for well/group elements without a value.  Never a valid UDQ
+// value since those are always finite.
+constexpr double missing_value = std::numeric_limits<double>::quiet_NaN();
+
+std::uint64_t next_version()
+{
+    static std::atomic<std::uint64_t> version{0};
+    return ++version;
+}
+
 bool is_udq(const std::string& key)
 {
     return (key.size() >= std::string::size_type{2})
         && (key[1] == 'U');
 }
 
-bool has_var(const S2Map<double>& values,
-             const std::string&   wgname,
-             const std::string&   udq_key)
+void assign_element(std::vector<double>& values,
+                    const std::size_t    ordinal,
+                    const double         value)
 {
-    auto res_iter = values.find(udq_key);
-    return (res_iter != values.end())
-        && (res_iter->second.count(wgname) > 0);
-}
+    if (ordinal >= values.size()) {
+        if (std::isnan(value)) {
+            return;
+        }
 
-void undefine_results(const Opm::UDQScalar& result,
-                      SMap<double>&         values)
-{
-    values.erase(result.wgname());
+        values.resize(ordinal + 1, missing_value);
+    }
+
+    values[ordinal] = value;
 }
 
 void undefine_results(const Opm::UDQScalar&       result,
@@ -84,12 +102,6 @@ void undefine_results(const Opm::UDQScalar&       result,
     wellPos->second.erase(result.number());
 }
 
-void add_defined_results(const Opm::UDQScalar& result,
-                         SMap<double>&         values)
-{
-    values.insert_or_assign(result.wgname(), result.get());
-}
-
 void add_defined_results(const Opm::UDQScalar&       result,
                          SKMap<std::size_t, double>& values)
 {
@@ -104,18 +116,16 @@ void add_defined_results(const Opm::UDQScalar&       result,
     wellPos->second.insert_or_assign(result.number(), result.get());
 }
 
-void add_results(const std::string& udq_key,
-                 const Opm::UDQSet& result,
-                 S2Map<double>&     values)
+// EntityValues is UDQState's private store of well and group level values.
+template <typename EntityValues>
+void add_results(const std::string&  udq_key,
+                 const Opm::UDQSet&  result,
+                 EntityValues&       values)
 {
-    auto& udq_values = values[udq_key];
+    values.add_var(udq_key);
     for (const auto& res1 : result) {
-        if (! res1.defined()) {
-            undefine_results(res1, udq_values);
-        }
-        else {
-            add_defined_results(res1, udq_values);
-        }
+        values.assign(udq_key, res1.wgindex(),
+                      res1.value().value_or(missing_value));
     }
 }
 
@@ -135,17 +145,21 @@ void add_results(const std::string&           udq_key,
 }
 
 // Load restart values for UDQs defined at the group or well levels.
+template <typename EntityValues>
 void load_restart_values(const Opm::RestartIO::RstUDQ& udq,
-                         SMap<double>&                 values)
+                         EntityValues&                 values)
 {
     const auto& wgnames = udq.entityNames();
     const auto& nameIdx = udq.nameIndex();
     const auto n = udq.numEntities();
 
+    values.add_var(udq.name);
+
     for (auto i = 0*n; i < n; ++i) {
+        const auto wgindex = Opm::NameTable::index(wgnames[nameIdx[i]]);
+
         for (const auto& subValuePair : udq[i]) {
-            values.insert_or_assign(wgnames[nameIdx[i]],
-                                    subValuePair.second);
+            values.assign(udq.name, wgindex, subValuePair.second);
         }
     }
 }
@@ -168,25 +182,13 @@ void load_segment_restart_values(const Opm::RestartIO::RstUDQ& udq,
     }
 }
 
-double get_scalar(const SMap<double>& values,
-                  const std::string&  udq_key,
-                  const double        undef_value)
-{
-    auto iter = values.find(udq_key);
-    if (iter == values.end()) {
-        return undef_value;
-    }
-
-    return iter->second;
-}
-
-double get_wg(const S2Map<double>& values,
-              const std::string&   wgname,
-              const std::string&   udq_key,
-              const double         undef_value)
+template <typename EntityValues>
+double get_wg(const EntityValues& values,
+              const std::string&  wgname,
+              const std::string&  udq_key,
+              const double        undef_value)
 {
-    auto res_iter = values.find(udq_key);
-    if (res_iter == values.end()) {
+    if (! values.has_var(udq_key)) {
         if (is_udq(udq_key)) {
             throw std::out_of_range("No such UDQ variable: " + udq_key);
         }
@@ -195,7 +197,7 @@ double get_wg(const S2Map<double>& values,
         }
     }
 
-    return get_scalar(res_iter->second, wgname, undef_value);
+    return values.get(wgname, udq_key).value_or(undef_value);
 }
 
 } // Anonymous namespace
@@ -222,11 +224,11 @@ void UDQState::load_rst(const RestartIO::RstState& rst_state)
             break;
 
         case UDQVarType::WELL_VAR:
-            load_restart_values(udq, this->well_values[udq.name]);
+            load_restart_values(udq, this->well_values);
             break;
 
         case UDQVarType::GROUP_VAR:
-            load_restart_values(udq, this->group_values[udq.name]);
+            load_restart_values(udq, this->group_values);
             break;
 
         default:
@@ -234,6 +236,8 @@ void UDQState::load_rst(const RestartIO::RstState& rst_state)
             break;
         }
     }
+
+    this->bump_version();
 }
 
 double UDQState::undefined_value() const
@@ -241,8 +245,13 @@ double UDQState::undefined_value() const
     return this->undef_value;
 }
 
+UDQState::UDQState()
+    : UDQState(0.0)
+{}
+
 UDQState::UDQState(double undefined)
     : undef_value(undefined)
+    , version_(next_version())
 {}
 
 bool UDQState::has(const std::string& key) const
@@ -252,12 +261,12 @@ bool UDQState::has(const std::string& key) const
 
 bool UDQState::has_well_var(const std::string& well, const std::string& key) const
 {
-    return has_var(this->well_values, well, key);
+    return this->well_values.get(well, key).has_value();
 }
 
 bool UDQState::has_group_var(const std::string& group, const std::string& key) const
 {
-    return has_var(this->group_values, group, key);
+    return this->group_values.get(group, key).has_value();
 }
 
 bool UDQState::has_segment_var(const std::string& well,
@@ -308,6 +317,8 @@ void UDQState::add(const std::string& udq_key, const UDQSet& result)
         }
         break;
     }
+
+    this->bump_version();
 }
 
 void UDQState::add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result)
@@ -321,6 +332,16 @@ void UDQState::add_assign(const std::string& udq_key, const UDQSet& result)
     this->add(udq_key, result);
 }
 
+void UDQState::keep_define(std::size_t report_step, const std::string& udq_key)
+{
+    this->defines[udq_key] = report_step;
+}
+
+void UDQState::bump_version()
+{
+    this->version_ = next_version();
+}
+
 double UDQState::get(const std::string& key) const
 {
     if (!is_udq(key)) {
@@ -429,11 +450,19 @@ UDQState UDQState::serializationTestObject()
     st.scalar_values = {{"FU1", 100}, {"FU2", 200}};
     st.defines = {{"DU1", 299}, {"DU2", 399}};
 
-    st.well_values.emplace("W1", std::unordered_map<std::string, double>{{"U1", 100}, {"U2", 200}});
-    st.well_values.emplace("W2", std::unordered_map<std::string, double>{{"U1", 700}, {"32", 600}});
+    {
+        auto well_values = NamedValues{};
+        well_values.emplace("W1", std::unordered_map<std::string, double>{{"U1", 100}, {"U2", 200}});
+        well_values.emplace("W2", std::unordered_map<std::string, double>{{"U1", 700}, {"32", 600}});
+        st.well_values = EntityValues{well_values};
+    }
 
-    st.group_values.emplace("G1", std::unordered_map<std::string, double>{{"U1", 100}, {"U2", 200}});
-    st.group_values.emplace("G2", std::unordered_map<std::string, double>{{"U1", 700}, {"32", 600}});
+    {
+        auto group_values = NamedValues{};
+        group_values.emplace("G1", std::unordered_map<std::string, double>{{"U1", 100}, {"U2", 200}});
+        group_values.emplace("G2", std::unordered_map<std::string, double>{{"U1", 700}, {"32", 600}});
+        st.group_values = EntityValues{group_values};
+    }
 
     {
         auto& sval = st.segment_values["SU1"];
@@ -463,6 +492,106 @@ UDQState UDQState::serializationTestObject()
     return st;
 }
 
+// ---------------------------------------------------------------------------
+
+UDQState::EntityValues::EntityValues(const NamedValues& values)
+{
+    for (const auto& [var, named_elements] : values) {
+        this->add_var(var);
+
+        for (const auto& [wgname, value] : named_elements) {
+            this->assign(var, NameTable::index(wgname), value);
+        }
+    }
+}
+
+bool UDQState::EntityValues::has_var(const std::string& var) const
+{
+    return this->values_.find(var) != this->values_.end();
+}
+
+std::optional<double>
+UDQState::EntityValues::get(const std::string& wgname,
+                            const std::string& var) const
+{
+    auto varPos = this->values_.find(var);
+    if (varPos == this->values_.end()) {
+        return std::nullopt;
+    }
+
+    const auto wgindex = NameTable::find(wgname);
+    const auto ordinal = wgindex.has_value()
+        ? this->ordinal(*wgindex) : std::nullopt;
+
+    if (! ordinal.has_value() || (*ordinal >= varPos->second.size()) ||
+        std::isnan(varPos->second[*ordinal]))
+    {
+        return std::nullopt;
+    }
+
+    return varPos->second[*ordinal];
+}
+
+void UDQState::EntityValues::add_var(const std::string& var)
+{
+    this->values_[var];
+}
+
+void UDQState::EntityValues::assign(const std::string&     var,
+                                    const NameTable::Index wgname,
+                                    const double           value)
+{
+    auto ordinal = this->ordinal(wgname);
+    if (! ordinal.has_value()) {
+        if (std::isnan(value)) {
+            // Undefining an unknown element.  Nothing to do.
+            return;
+        }
+
+        ordinal = this->names_.size();
+        this->ordinal_.emplace(wgname, *ordinal);
+        this->names_.push_back(wgname);
+    }
+
+    assign_element(this->values_[var], *ordinal, value);
+}
+
+UDQState::NamedValues UDQState::EntityValues::named() const
+{
+    auto named = NamedValues{};
+
+    for (const auto& [var, elements] : this->values_) {
+        auto& named_elements = named[var];
+
+        for (auto ordinal = 0*elements.size(); ordinal < elements.size(); ++ordinal) {
+            if (! std::isnan(elements[ordinal])) {
+                named_elements.emplace(NameTable::name(this->names_[ordinal]),
+                                       elements[ordinal]);
+            }
+        }
+    }
+
+    return named;
+}
+
+bool UDQState::EntityValues::operator==(const EntityValues& that) const
+{
+    // Ordinals depend on the order in which the wells or groups were first
+    // seen, so compare by name.
+    return this->named() == that.named();
+}
+
+std::optional<std::size_t>
+UDQState::EntityValues::ordinal(const NameTable::Index wgname) const
+{
+    auto pos = this->ordinal_.find(wgname);
+    if (pos == this->ordinal_.end()) {
+        return std::nullopt;
+    }
+
+    return pos->second;
+}
+
 bool UDQState::define(const std::pair<UDQUpdate, std::size_t>& update_status) const
 {
     if (update_status.first == UDQUpdate::ON || update_status.first == UDQUpdate::NEXT) {
@@ -20,14 +20,19 @@
 #ifndef UDQSTATE_HPP_
 #define UDQSTATE_HPP_
 
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 
 #include <opm/output/eclipse/WindowedArray.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace Opm::RestartIO {
     struct RstState;
@@ -41,7 +46,7 @@ class UDQState
 public:
     using ExportRange = RestartIO::Helpers::WindowedArray<double>::WriteWindow;
 
-    UDQState() = default;
+    UDQState();
     explicit UDQState(double undefined);
 
     bool has(const std::string& key) const;
@@ -62,6 +67,22 @@ public:
 
     void add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result);
     void add_assign(const std::string& udq_key, const UDQSet& result);
+
+    /// Record that a DEFINEd quantity was found to be up to date at
+    /// report_step, without re-evaluating it.  Keeps the object identical
+    /// to one in which the quantity was evaluated again.
+    void keep_define(std::size_t report_step, const std::string& udq_key);
+
+    /// Modification stamp.  Changes whenever a UDQ value is added or
+    /// loaded, and is never reused across objects.  Not serialised.
+    std::uint64_t version() const { return this->version_; }
+
+    /// Evaluation record of the DEFINE statements which computed the
+    /// current values.  Maintained by UDQDependencyGraph on behalf of
+    /// UDQConfig::eval().  Not serialised and not part of operator==().
+    const UDQDependencyGraph::History& define_history() const { return this->define_history_; }
+    UDQDependencyGraph::History& define_history() { return this->define_history_; }
+
     bool define(const std::pair<UDQUpdate, std::size_t>& update_status) const;
     double undefined_value() const;
 
@@ -74,27 +95,91 @@ public:
     {
         serializer(this->undef_value);
         serializer(this->scalar_values);
-        serializer(this->well_values);
-        serializer(this->group_values);
+
+        // Well and group level values are serialised by name, since the
+        // interned name indices are specific to the current process.
+        auto wells = serializer.isSerializing()
+            ? this->well_values.named() : NamedValues{};
+        auto groups = serializer.isSerializing()
+            ? this->group_values.named() : NamedValues{};
+
+        serializer(wells);
+        serializer(groups);
         serializer(this->segment_values);
         serializer(this->defines);
+
+        if (! serializer.isSerializing()) {
+            this->well_values = EntityValues{wells};
+            this->group_values = EntityValues{groups};
+            this->bump_version();
+        }
     }
 
 private:
+    // [var][wgname] -> double
+    using NamedValues = std::unordered_map<std::string, std::unordered_map<std::string, double>>;
+
+    /// Well or group level values of all UDQs of one category.
+    ///
+    /// Each variable's values are stored in a dense array, at positions
+    /// assigned to the wells or groups in order of first appearance in this
+    /// object.  The arrays therefore grow with the number of wells or
+    /// groups of the run, not with the size of the process wide NameTable.
+    class EntityValues
+    {
+    public:
+        EntityValues() = default;
+        explicit EntityValues(const NamedValues& values);
+
+        /// Whether or not any value of \p var has been assigned.
+        bool has_var(const std::string& var) const;
+
+        /// Value of \p var for a single well or group.  Nullopt if
+        /// undefined.
+        std::optional<double> get(const std::string& wgname,
+                                  const std::string& var) const;
+
+        /// Make \p var known, even without any values.
+        void add_var(const std::string& var);
+
+        /// Assign value of \p var for a single well or group.  NaN
+        /// undefines the value.
+        void assign(const std::string& var,
+                    NameTable::Index   wgname,
+                    double             value);
+
+        /// All defined values, keyed by name.
+        NamedValues named() const;
+
+        bool operator==(const EntityValues& that) const;
+
+    private:
+        std::unordered_map<NameTable::Index, std::size_t> ordinal_{};
+        std::vector<NameTable::Index> names_{};
+
+        // [var][ordinal] -> double.  NaN for elements without a value.
+        std::unordered_map<std::string, std::vector<double>> values_{};
+
+        std::optional<std::size_t> ordinal(NameTable::Index wgname) const;
+    };
+
     double undef_value{};
     std::unordered_map<std::string, double> scalar_values{};
 
-    // [var][well] -> double
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values{};
-
-    // [var][group] -> double
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values{};
+    EntityValues well_values{};
+    EntityValues group_values{};
 
     // [var][well][segment] -> double
     std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> segment_values{};
 
     std::unordered_map<std::string, std::size_t> defines{};
 
+    std::uint64_t version_{};
+
+    UDQDependencyGraph::History define_history_{};
+
+    void bump_version();
+
     void add(const std::string& udq_key, const UDQSet& result);
     double get_wg_var(const std::string& well, const std::string& key, UDQVarType var_type) const;
 };
@@ -19,9 +19,10 @@
 
 #include <cassert>
 #include <cmath>
-#include <iostream>
 #include <fmt/format.h>
 
+#include <opm/common/OpmLog/OpmLog.hpp>
+
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
@@ -166,9 +167,13 @@ VFPInjTable::VFPInjTable( const DeckKeyword& table, const UnitSystem& deck_unit_
         for (unsigned int f=0; f<bhp_tht.size(); ++f) {
             const double& value = bhp_tht[f];
             if (value > 1.0e10) {
-                //TODO: Replace with proper log message
-                std::cerr << "Too large value encountered in VFPINJ in ["
-                        << t << "," << f << "]=" << value << std::endl;
+                OpmLog::warning(fmt::format("Problem with VFPINJ table {}\n"
+                                            "In {} line {}\n"
+                                            "Element(thp={}, flo={}) = {} is too large",
+                                            this->m_table_num,
+                                            this->m_location.filename,
+                                            this->m_location.lineno,
+                                            t, f, value));
             }
             (*this)(t,f) = table_scaling_factor*value;
         }
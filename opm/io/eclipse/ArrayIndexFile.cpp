@@ -0,0 +1,380 @@
+/*
+   Copyright 2025 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ArrayIndexFile.hpp>
+
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// Index file layout, all values in host byte order
+//
+//   magic       8 characters, "OPMARIDX"
+//   byte order  uint32, 0x01020304
+//   version     uint32
+//   file size   uint64, size of indexed file in bytes
+//   mtime       int64, modification time of indexed file
+//   #entries    uint64
+//
+// followed by #entries fixed size entries
+//
+//   name        8 characters, blank padded
+//   type        int32, eclArrType
+//   elem. size  int32
+//   size        int64, number of elements
+//   data pos.   uint64
+//   seqnum      int32
+
+namespace {
+
+constexpr auto indexMagic = std::array<char, 8> { 'O','P','M','A','R','I','D','X' };
+constexpr std::uint32_t indexByteOrder = 0x01020304;
+constexpr std::uint32_t indexVersion = 1;
+
+// Byte offsets of the recorded file size and of the first entry, and size
+// of each entry.
+constexpr std::streamoff fileSizePos = 8 + 2*sizeof(std::uint32_t);
+constexpr std::streamoff headerSize = fileSizePos + 3*sizeof(std::uint64_t);
+constexpr std::streamoff entrySize = 8 + 3*sizeof(std::int32_t)
+    + sizeof(std::int64_t) + sizeof(std::uint64_t);
+
+struct FileState
+{
+    std::uint64_t size{0};
+    std::int64_t mtime{0};
+};
+
+std::optional<FileState> fileState(const std::string& filename)
+{
+    std::error_code ec{};
+
+    const auto size = std::filesystem::file_size(filename, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const auto mtime = std::filesystem::last_write_time(filename, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    return FileState {
+        static_cast<std::uint64_t>(size),
+        static_cast<std::int64_t>(mtime.time_since_epoch().count())
+    };
+}
+
+class IndexBuffer
+{
+public:
+    explicit IndexBuffer(std::vector<char> data)
+        : data_(std::move(data))
+    {}
+
+    template <typename T>
+    bool get(T& value)
+    {
+        if (this->data_.size() - this->pos_ < sizeof(T)) {
+            return false;
+        }
+
+        std::memcpy(&value, this->data_.data() + this->pos_, sizeof(T));
+        this->pos_ += sizeof(T);
+
+        return true;
+    }
+
+    bool get(char* dest, const std::size_t n)
+    {
+        if (this->data_.size() - this->pos_ < n) {
+            return false;
+        }
+
+        std::memcpy(dest, this->data_.data() + this->pos_, n);
+        this->pos_ += n;
+
+        return true;
+    }
+
+    bool atEnd() const { return this->pos_ == this->data_.size(); }
+
+private:
+    std::vector<char> data_;
+    std::size_t pos_{0};
+};
+
+template <typename T>
+void put(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool get(std::istream& is, T& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+void putEntry(std::ostream& os, const Opm::EclIO::ArrayIndexEntry& entry)
+{
+    auto name = entry.name;
+    name.resize(8, ' ');
+
+    os.write(name.data(), 8);
+    put(os, static_cast<std::int32_t>(entry.type));
+    put(os, static_cast<std::int32_t>(entry.elementSize));
+    put(os, static_cast<std::int64_t>(entry.size));
+    put(os, static_cast<std::uint64_t>(entry.dataPos));
+    put(os, static_cast<std::int32_t>(entry.seqnum));
+}
+
+// Header of existing index file, or nullopt if the file does not exist or
+// is not an index file of this version.
+struct IndexHeader
+{
+    FileState state{};
+    std::uint64_t numEntries{0};
+};
+
+std::optional<IndexHeader> readIndexHeader(const std::string& indexName)
+{
+    std::ifstream is(indexName, std::ios::in | std::ios::binary);
+
+    auto magic = std::array<char, 8>{};
+    std::uint32_t byteOrder{0}, version{0};
+    auto header = IndexHeader{};
+
+    if (! is.read(magic.data(), magic.size()) || (magic != indexMagic) ||
+        ! get(is, byteOrder) || (byteOrder != indexByteOrder) ||
+        ! get(is, version) || (version != indexVersion) ||
+        ! get(is, header.state.size) || ! get(is, header.state.mtime) ||
+        ! get(is, header.numEntries))
+    {
+        return std::nullopt;
+    }
+
+    return header;
+}
+
+bool validEntry(const Opm::EclIO::ArrayIndexEntry& entry)
+{
+    return (entry.type >= Opm::EclIO::INTE)
+        && (entry.type <= Opm::EclIO::C0NN)
+        && (entry.size >= 0)
+        && (entry.elementSize > 0)
+        && ((entry.type != Opm::EclIO::MESS) || (entry.size == 0));
+}
+
+} // Anonymous namespace
+
+std::string Opm::EclIO::arrayIndexFileName(const std::string& filename)
+{
+    return filename + ".idx";
+}
+
+std::optional<std::vector<Opm::EclIO::ArrayIndexEntry>>
+Opm::EclIO::readArrayIndexFile(const std::string& filename)
+{
+    const auto state = fileState(filename);
+    if (! state.has_value()) {
+        return std::nullopt;
+    }
+
+    std::ifstream is(arrayIndexFileName(filename), std::ios::in | std::ios::binary);
+    if (! is) {
+        return std::nullopt;
+    }
+
+    // Single read of entire index
+    is.seekg(0, std::ios_base::end);
+    const auto indexSize = static_cast<std::streamoff>(is.tellg());
+    is.seekg(0, std::ios_base::beg);
+
+    if (indexSize <= 0) {
+        return std::nullopt;
+    }
+
+    auto data = std::vector<char>(static_cast<std::size_t>(indexSize));
+    if (! is.read(data.data(), indexSize)) {
+        return std::nullopt;
+    }
+
+    auto buffer = IndexBuffer { std::move(data) };
+
+    auto magic = std::array<char, 8>{};
+    std::uint32_t byteOrder{0}, version{0};
+    std::uint64_t fileSize{0}, numEntries{0};
+    std::int64_t mtime{0};
+
+    if (! buffer.get(magic.data(), magic.size()) || (magic != indexMagic) ||
+        ! buffer.get(byteOrder) || (byteOrder != indexByteOrder) ||
+        ! buffer.get(version) || (version != indexVersion) ||
+        ! buffer.get(fileSize) || (fileSize != state->size) ||
+        ! buffer.get(mtime) || (mtime != state->mtime) ||
+        ! buffer.get(numEntries))
+    {
+        return std::nullopt;
+    }
+
+    auto entries = std::vector<ArrayIndexEntry>{};
+    std::uint64_t dataEnd = 0;
+
+    for (std::uint64_t i = 0; i < numEntries; ++i) {
+        char name[8];
+        std::int32_t type{0}, elementSize{0}, seqnum{0};
+        std::int64_t size{0};
+        std::uint64_t dataPos{0};
+
+        if (! buffer.get(name, sizeof name) || ! buffer.get(type) ||
+            ! buffer.get(elementSize) || ! buffer.get(size) ||
+            ! buffer.get(dataPos) || ! buffer.get(seqnum))
+        {
+            return std::nullopt;
+        }
+
+        auto& entry = entries.emplace_back();
+        entry.name = trimr(std::string(name, sizeof name));
+        entry.type = static_cast<eclArrType>(type);
+        entry.size = size;
+        entry.elementSize = elementSize;
+        entry.dataPos = dataPos;
+        entry.seqnum = seqnum;
+
+        if (! validEntry(entry) || (dataPos < dataEnd)) {
+            return std::nullopt;
+        }
+
+        dataEnd = dataPos + sizeOnDiskBinary(size, entry.type, elementSize);
+
+        if (dataEnd > fileSize) {
+            return std::nullopt;
+        }
+    }
+
+    // The index must describe the whole file, and nothing more.
+    if (! buffer.atEnd() || (dataEnd != fileSize)) {
+        return std::nullopt;
+    }
+
+    return entries;
+}
+
+bool Opm::EclIO::arrayIndexFileCurrent(const std::string& filename)
+{
+    const auto state = fileState(filename);
+    const auto header = readIndexHeader(arrayIndexFileName(filename));
+
+    return state.has_value() && header.has_value()
+        && (header->state.size == state->size)
+        && (header->state.mtime == state->mtime);
+}
+
+void Opm::EclIO::writeArrayIndexFile(const std::string&                  filename,
+                                     const std::vector<ArrayIndexEntry>& entries)
+{
+    const auto state = fileState(filename);
+    if (! state.has_value()) {
+        throw std::runtime_error("Unable to determine size and modification time of " + filename);
+    }
+
+    const auto indexName = arrayIndexFileName(filename);
+    const auto tmpName = indexName + ".tmp";
+
+    {
+        std::ofstream os(tmpName, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (! os) {
+            throw std::runtime_error("Unable to create index file " + tmpName);
+        }
+
+        os.write(indexMagic.data(), indexMagic.size());
+        put(os, indexByteOrder);
+        put(os, indexVersion);
+        put(os, state->size);
+        put(os, state->mtime);
+        put(os, static_cast<std::uint64_t>(entries.size()));
+
+        for (const auto& entry : entries) {
+            putEntry(os, entry);
+        }
+
+        if (! os.flush()) {
+            throw std::runtime_error("Unable to write index file " + tmpName);
+        }
+    }
+
+    std::filesystem::rename(tmpName, indexName);
+}
+
+void Opm::EclIO::appendArrayIndexFile(const std::string&                  filename,
+                                      const std::uint64_t                 numKept,
+                                      const std::vector<ArrayIndexEntry>& entries)
+{
+    const auto state = fileState(filename);
+    if (! state.has_value()) {
+        throw std::runtime_error("Unable to determine size and modification time of " + filename);
+    }
+
+    const auto indexName = arrayIndexFileName(filename);
+
+    const auto header = readIndexHeader(indexName);
+    if (! header.has_value() || (header->numEntries < numKept)) {
+        throw std::runtime_error("Index file " + indexName + " does not exist or is too short");
+    }
+
+    const auto numEntries = numKept + entries.size();
+
+    {
+        std::fstream os(indexName, std::ios::in | std::ios::out | std::ios::binary);
+        os.seekp(headerSize + static_cast<std::streamoff>(numKept)*entrySize);
+
+        for (const auto& entry : entries) {
+            putEntry(os, entry);
+        }
+
+        if (! os.flush()) {
+            throw std::runtime_error("Unable to write index file " + indexName);
+        }
+    }
+
+    // Discard entries of arrays which have been overwritten.
+    if (header->numEntries > numEntries) {
+        std::filesystem::resize_file(indexName, headerSize + static_cast<std::streamoff>(numEntries)*entrySize);
+    }
+
+    std::fstream os(indexName, std::ios::in | std::ios::out | std::ios::binary);
+    os.seekp(fileSizePos);
+
+    put(os, state->size);
+    put(os, state->mtime);
+    put(os, static_cast<std::uint64_t>(numEntries));
+
+    if (! os.flush()) {
+        throw std::runtime_error("Unable to write index file " + indexName);
+    }
+}
@@ -0,0 +1,102 @@
+/*
+   Copyright 2025 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ARRAYINDEXFILE_HPP
+#define OPM_IO_ARRAYINDEXFILE_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Array header information of a binary result file.
+///
+/// Sidecar index files (<filename>.idx) hold one such entry for each array
+/// in the result file, in file order, so that readers do not need to scan
+/// every array header of large files, e.g., unified restart files.
+struct ArrayIndexEntry
+{
+    /// Array name, without trailing blanks.
+    std::string name{};
+
+    /// Array element type.
+    eclArrType type{MESS};
+
+    /// Number of array elements.
+    std::int64_t size{0};
+
+    /// Size in bytes of each array element.
+    int elementSize{4};
+
+    /// File position of the array's data, i.e., immediately following the
+    /// array header.
+    std::uint64_t dataPos{0};
+
+    /// Report step number of SEQNUM arrays.  Zero for all other arrays.
+    int seqnum{0};
+};
+
+/// Name of sidecar index file of result file \p filename.
+std::string arrayIndexFileName(const std::string& filename);
+
+/// Read sidecar index file of binary result file \p filename.
+///
+/// Returns nullopt if the index does not exist, cannot be read, or does
+/// not describe the current contents of \p filename.  The index records
+/// the size and modification time of \p filename when it was written and
+/// is rejected if either has changed since.
+std::optional<std::vector<ArrayIndexEntry>>
+readArrayIndexFile(const std::string& filename);
+
+/// Whether or not the sidecar index file of binary result file \p filename
+/// exists and describes the current contents of \p filename.
+///
+/// Only checks the recorded size and modification time, not the entries.
+bool arrayIndexFileCurrent(const std::string& filename);
+
+/// Create or replace sidecar index file of binary result file \p filename.
+///
+/// Must be called once \p filename has been closed, since the index
+/// records the file's current size and modification time.  The index is
+/// written to a temporary file that replaces any existing index only once
+/// complete.
+void writeArrayIndexFile(const std::string&                  filename,
+                         const std::vector<ArrayIndexEntry>& entries);
+
+/// Update sidecar index file of binary result file \p filename after
+/// arrays have been appended to \p filename.
+///
+/// Keeps the first \p numKept entries of the existing index, replaces any
+/// remaining entries by \p entries and records the file's current size and
+/// modification time.  Cost is proportional to the number of new entries.
+/// The existing index must have described \p filename before the new
+/// arrays were written, see arrayIndexFileCurrent().  Like
+/// writeArrayIndexFile(), must be called once \p filename has been
+/// closed.  The index header is updated last, so an interrupted update
+/// leaves an index which readArrayIndexFile() rejects.
+void appendArrayIndexFile(const std::string&                  filename,
+                          const std::uint64_t                 numKept,
+                          const std::vector<ArrayIndexEntry>& entries);
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ARRAYINDEXFILE_HPP
@@ -27,10 +27,12 @@
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iterator>
 #include <numeric>
 #include <string>
 #include <stdexcept>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -38,9 +40,69 @@ namespace Opm::EclIO {
 
 using NNCentry = std::tuple<int, int, int, int, int, int, float>;
 
+namespace {
+
+// Corners of the four pillars of a cell.  Pillar n of the cell starts at
+// pillar[n], and Z holds the depths of the cell's eight corners.
+void pillarCorners(const std::array<const float*, 4>& pillar, const bool radial,
+                   std::array<double, 8>& X, std::array<double, 8>& Y,
+                   const std::array<double, 8>& Z)
+{
+    for (int  n = 0; n < 4; n++) {
+        const float* p = pillar[n];
+
+        double xt;
+        double yt;
+        double xb;
+        double yb;
+
+        double zt = p[2];
+        double zb = p[5];
+
+        if (radial) {
+            xt = p[0] * cos(p[1] / 180.0 * M_PI);
+            yt = p[0] * sin(p[1] / 180.0 * M_PI);
+            xb = p[3] * cos(p[4] / 180.0 * M_PI);
+            yb = p[3] * sin(p[4] / 180.0 * M_PI);
+        } else {
+            xt = p[0];
+            yt = p[1];
+            xb = p[3];
+            yb = p[4];
+        }
+
+        if (zt == zb) {
+            X[n] = xt;
+            X[n+4] = xt;
+            Y[n] = yt;
+            Y[n+4] = yt;
+        } else {
+            X[n] = xt + (xb-xt) / (zt-zb) * (zt - Z[n]);
+            X[n+4] = xt + (xb-xt) / (zt-zb) * (zt-Z[n+4]);
+            Y[n] = yt+(yb-yt)/(zt-zb)*(zt-Z[n]);
+            Y[n+4] = yt+(yb-yt)/(zt-zb)*(zt-Z[n+4]);
+        }
+    }
+}
+
+} // Anonymous namespace
+
 EGrid::EGrid(const std::string& filename, const std::string& grid_name)
     : EclFile(filename), inputFileName { filename }, m_grid_name {grid_name}
 {
+    this->init_grid();
+}
+
+EGrid::EGrid(const std::string& filename, MemoryMapped mmap, const std::string& grid_name)
+    : EclFile(filename, mmap), inputFileName { filename }, m_grid_name {grid_name}
+{
+    this->init_grid();
+}
+
+void EGrid::init_grid()
+{
+    const auto& grid_name = m_grid_name;
+
     initFileName = inputFileName.parent_path() / inputFileName.stem();
 
     if (this->formattedInput())
@@ -392,39 +454,10 @@ void EGrid::getCellCorners(const std::array<int, 3>& ijk,
     for (int n = 0; n < 8; n++)
         Z[n] = zcorn_array[zind[n]];
 
-    for (int  n = 0; n < 4; n++) {
-        double xt;
-        double yt;
-        double xb;
-        double yb;
+    const float* coord = coord_array.data();
 
-        double zt = coord_array[pind[n] + 2];
-        double zb = coord_array[pind[n] + 5];
-
-        if (m_radial) {
-            xt = coord_array[pind[n]] * cos(coord_array[pind[n] + 1] / 180.0 * M_PI);
-            yt = coord_array[pind[n]] * sin(coord_array[pind[n] + 1] / 180.0 * M_PI);
-            xb = coord_array[pind[n] + 3] * cos(coord_array[pind[n] + 4] / 180.0 * M_PI);
-            yb = coord_array[pind[n] + 3] * sin(coord_array[pind[n] + 4] / 180.0 * M_PI);
-        } else {
-            xt = coord_array[pind[n]];
-            yt = coord_array[pind[n] + 1];
-            xb = coord_array[pind[n] + 3];
-            yb = coord_array[pind[n] + 4];
-        }
-
-        if (zt == zb) {
-            X[n] = xt;
-            X[n+4] = xt;
-            Y[n] = yt;
-            Y[n+4] = yt;
-        } else {
-            X[n] = xt + (xb-xt) / (zt-zb) * (zt - Z[n]);
-            X[n+4] = xt + (xb-xt) / (zt-zb) * (zt-Z[n+4]);
-            Y[n] = yt+(yb-yt)/(zt-zb)*(zt-Z[n]);
-            Y[n+4] = yt+(yb-yt)/(zt-zb)*(zt-Z[n+4]);
-        }
-    }
+    pillarCorners({coord + pind[0], coord + pind[1], coord + pind[2], coord + pind[3]},
+                  m_radial, X, Y, Z);
 }
 
 
@@ -510,91 +543,104 @@ std::vector<std::array<float, 3>> EGrid::getXYZ_layer(int layer, bool bottom)
 }
 
 
-std::vector<float> EGrid::  get_zcorn_from_disk(int layer, bool bottom)
+std::vector<float> EGrid::get_zcorn_from_disk(int layer, bool bottom)
 {
     if (formatted)
         throw std::invalid_argument("partial loading of zcorn arrays not possible when using formatted input");
 
-    std::vector<float> zcorn_layer;
-    std::fstream fileH;
-
-    int nodes_pr_surf = nijk[0]*nijk[1]*4;
-    int zcorn_offset = nodes_pr_surf * layer * 2;
+    const std::size_t nodes_pr_surf = static_cast<std::size_t>(nijk[0])*nijk[1]*4;
+    std::size_t zcorn_offset = nodes_pr_surf * layer * 2;
 
     if (bottom)
-        zcorn_offset+=nodes_pr_surf;
-
-    fileH.open(inputFileName, std::ios::in |  std::ios::binary);
-
-    if (!fileH)
-        throw std::runtime_error("Can not open EGrid file" + this->inputFilename);
+        zcorn_offset += nodes_pr_surf;
 
-    std::string arrName(8,' ');
-    eclArrType arrType;
-    int64_t num;
-    int sizeOfElement;
+    return this->getRange<float>(zcorn_array_index, zcorn_offset, nodes_pr_surf);
+}
 
-    uint64_t zcorn_pos = 0;
 
-    while (!isEOF(&fileH)) {
+void EGrid::streamCellCorners(const std::function<void(const LayerCorners&)>& fn)
+{
+    this->streamCellCorners({0, nijk[0] - 1, 0, nijk[1] - 1, 0, nijk[2] - 1}, fn);
+}
 
-        readBinaryHeader(fileH,arrName,num, arrType, sizeOfElement);
 
-        if (arrName == "ZCORN   "){
-            zcorn_pos = fileH.tellg();
-            break;
+void EGrid::streamCellCorners(const std::array<int, 6>& box,
+                              const std::function<void(const LayerCorners&)>& fn)
+{
+    for (int d = 0; d < 3; d++) {
+        if ((box[2*d] < 0) || (box[2*d] > box[2*d + 1]) || (box[2*d + 1] > nijk[d] - 1)) {
+            throw std::invalid_argument(fmt::format("invalid box input, {} range [{},{}] not within [0,{}]",
+                                                    "IJK"[d], box[2*d], box[2*d + 1], nijk[d] - 1));
         }
-
-        uint64_t sizeOfNextArray = sizeOnDiskBinary(num, arrType, sizeOfElement);
-        fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
     }
 
-    int elements_pr_block = Opm::EclIO::MaxBlockSizeReal / Opm::EclIO::sizeOfReal;
-    int num_blocks_start = zcorn_offset / elements_pr_block;
-
-    // adding size of zcorn real data before to ignored
-    uint64_t start_pos = zcorn_pos + Opm::EclIO::sizeOfReal * zcorn_offset;
-
-    // adding size of blocks (head and tail flags)
-    start_pos = start_pos + (1 + num_blocks_start * 2) * Opm::EclIO::sizeOfInte;
-
-    fileH.seekg(start_pos, std::ios_base::beg);
-
-    uint64_t zcorn_to = zcorn_offset + nodes_pr_surf;
-
-    int i1 = zcorn_offset / 1000 + 1;
-    uint64_t elemets = static_cast<uint64_t>(i1 * elements_pr_block - zcorn_offset);
-
-    uint64_t next_block = elemets < zcorn_to ? elemets : zcorn_to - zcorn_offset + 1 ;
-
-    uint64_t p1 = zcorn_offset;
+    const int ni = box[1] - box[0] + 1;
+    const int nj = box[3] - box[2] + 1;
+
+    // ZCORN holds two rows of 2*nx depths for each j in each of the top and
+    // bottom surfaces of a layer, and COORD one row of nx + 1 pillars for
+    // each j + 1 in each reservoir.  Only rows j1 to j2 (j2 + 1 for COORD)
+    // of the current layer are read.
+
+    const std::size_t nx = nijk[0];
+    const std::size_t ny = nijk[1];
+
+    const std::size_t surf_size = nx*ny*4;
+    const std::size_t zrow_size = nx*4;
+    const std::size_t prow_size = (nx + 1)*6;
+
+    // Offsets of a cell's four corner depths in a surface.
+    const std::array<std::size_t, 4> zoffset = {0, 1, 2*nx, 2*nx + 1};
+
+    std::vector<float> zcorn_top;
+    std::vector<float> zcorn_bottom;
+    std::vector<float> coord_rows;
+    int coord_res = -1;
+
+    LayerCorners corners;
+    corners.box = {box[0], box[1], box[2], box[3]};
+    corners.X.resize(static_cast<std::size_t>(ni)*nj);
+    corners.Y.resize(corners.X.size());
+    corners.Z.resize(corners.X.size());
+
+    for (int k = box[4]; k < (box[5] + 1); k++) {
+        if (res.at(k) != coord_res) {
+            coord_res = res.at(k);
+            coord_rows = this->getRange<float>(coord_array_index,
+                                               coord_res*(nx + 1)*(ny + 1)*6 + box[2]*prow_size,
+                                               (nj + 1)*prow_size);
+        }
 
-    while (p1 < zcorn_to){
+        const std::size_t zcorn_offset = 2*surf_size*k + box[2]*zrow_size;
 
-        std::vector<float> buf(next_block);
-        fileH.read(reinterpret_cast<char*>(buf.data()), buf.size()*sizeof(float));
+        zcorn_top = this->getRange<float>(zcorn_array_index, zcorn_offset, nj*zrow_size);
+        zcorn_bottom = this->getRange<float>(zcorn_array_index, zcorn_offset + surf_size, nj*zrow_size);
 
-        for (size_t n = 0; n < next_block; n++)
-            zcorn_layer.push_back(Opm::EclIO::flipEndianFloat(buf[n]));
+        corners.layer = k;
 
-        p1 = p1 + next_block;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int j = 0; j < nj; j++) {
+            for (int i = 0; i < ni; i++) {
+                const std::size_t cell = static_cast<std::size_t>(j)*ni + i;
+                const std::size_t zind = j*zrow_size + (box[0] + i)*2;
+                const float* pind = coord_rows.data() + j*prow_size + (box[0] + i)*6;
 
-        if (p1 < zcorn_to) {
-            int dtail;
-            fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
-            fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
-            dtail = Opm::EclIO::flipEndianInt(dtail);
+                auto& Z = corners.Z[cell];
 
-            next_block = static_cast<uint64_t>(dtail) / static_cast<uint64_t>(Opm::EclIO::sizeOfReal);
+                for (int n = 0; n < 4; n++) {
+                    Z[n] = zcorn_top[zind + zoffset[n]];
+                    Z[n + 4] = zcorn_bottom[zind + zoffset[n]];
+                }
 
-            if ((p1 + next_block) > zcorn_to)
-                next_block = zcorn_to - p1;
+                pillarCorners({pind, pind + 6, pind + prow_size, pind + prow_size + 6},
+                              m_radial, corners.X[cell], corners.Y[cell], Z);
+            }
         }
-    }
 
-    fileH.close();
-
-    return zcorn_layer;
+        fn(corners);
+    }
 }
 
 
@@ -23,6 +23,7 @@
 
 #include <array>
 #include <filesystem>
+#include <functional>
 #include <string>
 #include <vector>
 #include <map>
@@ -34,6 +35,23 @@ class EGrid : public EclFile
 public:
     explicit EGrid(const std::string& filename, const std::string& grid_name = "global");
 
+    /// Open grid file through a read-only memory mapping, see EclFile.
+    /// Partial reads of COORD and ZCORN then go directly to the mapping.
+    EGrid(const std::string& filename, MemoryMapped mmap, const std::string& grid_name = "global");
+
+    /// Corner point coordinates of the cells of a single layer in a box.
+    /// Corners of each cell are ordered as in getCellCorners(), and cell
+    /// (i, j) of the box is element (j - box[2])*(box[1] - box[0] + 1) +
+    /// (i - box[0]).
+    struct LayerCorners
+    {
+        int layer{0};
+        std::array<int, 4> box{};
+        std::vector<std::array<double, 8>> X{};
+        std::vector<std::array<double, 8>> Y{};
+        std::vector<std::array<double, 8>> Z{};
+    };
+
     int global_index(int i, int j, int k) const;
     int active_index(int i, int j, int k) const;
 
@@ -48,6 +66,17 @@ public:
     std::vector<std::array<float, 3>> getXYZ_layer(int layer, bool bottom=false);
     std::vector<std::array<float, 3>> getXYZ_layer(int layer, const std::array<int, 4>& box, bool bottom=false);
 
+    /// Compute cell corners of box (i1, i2, j1, j2, k1, k2), zero based
+    /// and inclusive, one layer at a time and pass each layer to \p fn.
+    ///
+    /// Only the COORD and ZCORN values of the current layer of the box are
+    /// read from binary files, so memory use does not depend on the number
+    /// of layers.  Formatted files are loaded in full.  The LayerCorners object is reused
+    /// for all layers.
+    void streamCellCorners(const std::array<int, 6>& box,
+                           const std::function<void(const LayerCorners&)>& fn);
+    void streamCellCorners(const std::function<void(const LayerCorners&)>& fn);
+
     int activeCells() const { return nactive; }
     int totalNumberOfCells() const { return nijk[0] * nijk[1] * nijk[2]; }
 
@@ -120,6 +149,7 @@ private:
     void getCellCorners(const std::array<int, 3>& ijk, const std::vector<float>& zcorn_layer,
                         std::array<double, 4>& X, std::array<double, 4>& Y, std::array<double, 4>& Z);
 
+    void init_grid();
     void mapaxes_init();
     
 };
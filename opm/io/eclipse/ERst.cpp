@@ -63,6 +63,17 @@ ERst::ERst(const std::string& filename)
     }
 }
 
+ERst::ERst(const std::string& filename, MemoryMapped mmap)
+    : EclFile(filename, mmap)
+{
+    if (this->hasKey("SEQNUM")) {
+        this->initUnified();
+    }
+    else {
+        this->initSeparate(seqnumFromSeparateFilename(filename));
+    }
+}
+
 
 bool ERst::hasReportStepNumber(int number) const
 {
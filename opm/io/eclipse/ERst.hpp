@@ -21,6 +21,7 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 
+#include <cstddef>
 #include <ios>
 #include <map>
 #include <string>
@@ -39,6 +40,9 @@ class ERst : public EclFile
 public:
     explicit ERst(const std::string& filename);
 
+    /// Open restart file through a read-only memory mapping, see EclFile.
+    ERst(const std::string& filename, MemoryMapped mmap);
+
     bool hasReportStepNumber(int number) const;
     bool hasArray(const std::string& name, int number) const;
     //overload to check if array exists for specific lgr
@@ -67,6 +71,15 @@ public:
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber, const std::string& lgr_name);
 
+    /// Elements [offset, offset + count) of numeric restart array, read
+    /// without loading the entire array.  See EclFile::getRange().
+    template <typename T>
+    std::vector<T> getRestartRange(const std::string& name, int reportStepNumber,
+                                   std::size_t offset, std::size_t count, int occurrence = 0)
+    {
+        return this->getRange<T>(getArrayIndex(name, reportStepNumber, occurrence), offset, count);
+    }
+
     template <typename T>
     const std::vector<T>& getRestartData(int index, int reportStepNumber, const std::string& lgr_name);
 
@@ -27,6 +27,7 @@
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ESmryColumns.hpp>
 
 #include <algorithm>
 #include <chrono>
@@ -42,6 +43,8 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <utility>
 #include <unordered_set>
 #include <vector>
 
@@ -113,6 +116,54 @@ bool is_well_completion(const std::string& keyword)
     return std::regex_match(keyword, well_compl_kw);
 }
 
+// Largest number of bytes read from a summary file in a single operation
+// when loading selected vectors.
+constexpr std::uint64_t maxLoadWindowSize = 32 * 1024 * 1024;
+
+// Consecutive PARAMS spans are read together unless the unused bytes
+// between them exceed this limit, in which case reading each span on its
+// own is cheaper.
+constexpr std::uint64_t maxLoadWindowGap = 64 * 1024;
+
+// Smallest number of time steps worth handing to a separate loader thread.
+constexpr std::size_t minStepsPerLoadThread = 64;
+
+constexpr unsigned int maxLoadThreads = 8;
+
+// Offset, relative to the start of the PARAMS data, of element 'paramPos'
+// in binary files.  Accounts for the record markers surrounding each
+// block of MaxBlockSizeReal bytes.
+std::uint64_t paramOffsetBinary(const int paramPos)
+{
+    const auto nFullBlocks = static_cast<std::uint64_t>(paramPos / (Opm::EclIO::MaxBlockSizeReal / Opm::EclIO::sizeOfReal));
+
+    return ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(Opm::EclIO::sizeOfInte)
+        + static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(Opm::EclIO::sizeOfReal);
+}
+
+// Offset, relative to the start of the PARAMS data, of element 'paramPos'
+// in formatted files.  Each line holds numColumnsReal values followed by
+// a line shift.
+std::uint64_t paramOffsetFormatted(const int paramPos)
+{
+    using namespace Opm::EclIO;
+
+    const auto nLines = static_cast<std::uint64_t>(paramPos / numColumnsReal);
+    const auto column = static_cast<std::uint64_t>(paramPos % numColumnsReal);
+
+    return nLines * static_cast<std::uint64_t>(numColumnsReal * columnWidthReal + 1)
+        + column * static_cast<std::uint64_t>(columnWidthReal);
+}
+
+unsigned int numLoadThreads(const std::size_t nSteps, const unsigned int limit)
+{
+    const auto hw = (limit > 0) ? limit : std::max(std::thread::hardware_concurrency(), 1u);
+    const auto bySize = static_cast<unsigned int>
+        (std::min(nSteps / minStepsPerLoadThread, static_cast<std::size_t>(maxLoadThreads)));
+
+    return std::max(std::min({ hw, bySize, maxLoadThreads }), 1u);
+}
+
 }
 
 
@@ -481,11 +532,6 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         specInd--;
     }
 
-    int fromReportStepNumber = 0;
-    int toReportStepNumber;
-    int step = 0;
-    specInd = nSpecFiles - 1;
-
     int index = 0;
     for (const auto& keyw : keywList) {
         if (!keyw.empty()) {
@@ -504,6 +550,68 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         vectorLoaded.push_back(false);
     }
 
+    this->scanResultFiles(smryArray);
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_opening += elapsed_seconds.count();
+}
+
+ESmry::ESmry(const std::string& filename, const ESmry& sameSpec) :
+    inputFileName { filename },
+    restart_info { "", 0 },
+    nI { sameSpec.nI },
+    nJ { sameSpec.nJ },
+    nK { sameSpec.nK },
+    nSpecFiles { 1 },
+    fromSingleRun { true },
+    nVect { sameSpec.nVect },
+    nTstep { 0 },
+    formattedFiles { sameSpec.formattedFiles },
+    vectorData ( sameSpec.nVect ),
+    vectorLoaded ( sameSpec.nVect, false ),
+    arrayPos { sameSpec.arrayPos },
+    keyword { sameSpec.keyword },
+    keyword_index { sameSpec.keyword_index },
+    nParamsSpecFile { sameSpec.nParamsSpecFile },
+    keywordListSpecFile { sameSpec.keywordListSpecFile },
+    summaryNodes { sameSpec.summaryNodes },
+    kwunits { sameSpec.kwunits },
+    tp_startdat { sameSpec.tp_startdat },
+    start_vect { sameSpec.start_vect },
+    m_io_opening { 0.0 },
+    m_io_loading { 0.0 }
+{
+    auto start = std::chrono::system_clock::now();
+
+    if (sameSpec.nSpecFiles != 1)
+        throw std::invalid_argument("Sharing summary specification requires loadBaseRunData=false");
+
+    if (inputFileName.extension()=="")
+        inputFileName += formattedFiles[0] ? ".FSMSPEC" : ".SMSPEC";
+
+    if (inputFileName.extension() != (formattedFiles[0] ? ".FSMSPEC" : ".SMSPEC"))
+        throw std::invalid_argument("Input file should have same extension as " + sameSpec.inputFileName.string());
+
+    std::filesystem::path rootName = inputFileName.parent_path() / inputFileName.stem();
+    std::filesystem::path path = std::filesystem::current_path();
+
+    updatePathAndRootName(path, rootName);
+
+    std::filesystem::path smspec_file = path / rootName;
+    smspec_file += inputFileName.extension();
+
+    this->scanResultFiles({ { smspec_file.string(), 0 } });
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_opening += elapsed_seconds.count();
+}
+
+void ESmry::scanResultFiles(const std::vector<std::pair<std::string, int>>& smryArray)
+{
+    int fromReportStepNumber = 0;
+    int toReportStepNumber;
+    int step = 0;
+    int specInd = nSpecFiles - 1;
 
     int dataFileIndex = -1;
 
@@ -519,7 +627,7 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         }
 
         std::filesystem::path smspecFile(std::get<0>(smryArray[specInd]));
-        rootName = smspecFile.parent_path() / smspecFile.stem();
+        const std::filesystem::path rootName = smspecFile.parent_path() / smspecFile.stem();
 
         // check if multiple or unified result files should be used
         // to import data, no information in smspec file regarding this
@@ -627,9 +735,6 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
 
         nTstep = timeStepList.size();
     }
-
-    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
-    m_io_opening += elapsed_seconds.count();
 }
 
 void ESmry::read_ministeps_from_disk()
@@ -669,8 +774,7 @@ void ESmry::read_ministeps_from_disk()
         if (formattedFiles[specInd]) {
             ministep_value = read_ministep_formatted(fileH);
         } else {
-            std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-            auto ministep_vect = readBinaryArray<int,int>(fileH, 1, Opm::EclIO::INTE, f, sizeOfInte);
+            auto ministep_vect = readBinaryInteArray(fileH, 1);
             ministep_value = ministep_vect[0];
         }
 
@@ -729,95 +833,193 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
 
         auto it = keyword_index.find(key);
 
-        if (!vectorLoaded[it->second])
+        if (!vectorLoaded[it->second] &&
+            (std::find(keywIndVect.begin(), keywIndVect.end(), it->second) == keywIndVect.end()))
+        {
             keywIndVect.push_back(it->second);
+        }
     }
 
-    for (auto ind : keywIndVect)
-        vectorData[ind].reserve(nTstep);
-
-    std::fstream fileH;
+    if (keywIndVect.empty() || timeStepList.empty())
+        return;
 
-    auto specInd = std::get<0>(timeStepList[0]);
-    auto dataFileIndex = std::get<1>(timeStepList[0]);
-    std::uint64_t blockSize_f;
+    // Undefined vectors in a summary file, typically when loading base
+    // restart run and including base run data, keep the NaN value.
+    for (auto ind : keywIndVect)
+        vectorData[ind].assign(nTstep, std::nanf(""));
 
-    {
-        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal;
+    // Each thread loads a contiguous range of time steps, writing to its
+    // own, disjoint, part of the presized vectors.
+    const auto numThreads = numLoadThreads(nTstep, this->loadThreadLimit);
 
-        blockSize_f= static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
+    if (numThreads == 1) {
+        this->loadDataRange(keywIndVect, 0, nTstep);
     }
+    else {
+        std::vector<std::thread> loaders;
+        std::vector<std::exception_ptr> errors(numThreads);
 
-    if (formattedFiles[specInd])
-        fileH.open(dataFileList[dataFileIndex], std::ios::in);
-    else
-        fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+        const auto stepsPerThread = (nTstep + numThreads - 1) / numThreads;
 
-    for (const auto& ministep : timeStepList) {
-        if (dataFileIndex != std::get<1>(ministep)) {
-            fileH.close();
-            specInd = std::get<0>(ministep);
-            dataFileIndex = std::get<1>(ministep);
+        for (unsigned int t = 0; t < numThreads; ++t) {
+            const auto first = std::min(t * stepsPerThread, nTstep);
+            const auto last = std::min(first + stepsPerThread, nTstep);
 
-            if (formattedFiles[specInd])
-                fileH.open(dataFileList[dataFileIndex], std::ios::in );
-            else
-                fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+            loaders.emplace_back([this, &keywIndVect, &errors, t, first, last]()
+            {
+                try {
+                    this->loadDataRange(keywIndVect, first, last);
+                }
+                catch (...) {
+                    errors[t] = std::current_exception();
+                }
+            });
         }
 
-        const auto stepFilePos = std::get<2>(ministep);;
+        for (auto& loader : loaders)
+            loader.join();
 
-        for (auto ind : keywIndVect) {
-            auto it = arrayPos[specInd].find(ind);
-            if (it == arrayPos[specInd].end()) {
-                // undefined vector in current summary file. Typically when loading
-                // base restart run and including base run data. Vectors can be added to restart runs
-                vectorData[ind].push_back(std::nanf(""));
+        for (const auto& error : errors) {
+            if (error) {
+                for (auto ind : keywIndVect)
+                    vectorData[ind].clear();
+
+                std::rethrow_exception(error);
             }
-            else {
-                int paramPos = it->second;
+        }
+    }
+
+    for (const auto& ind : keywIndVect)
+        vectorLoaded[ind] = true;
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+}
 
-                if (formattedFiles[specInd]) {
-                    std::uint64_t elementPos = 0;
-                    int nBlocks = paramPos / MaxBlockSizeReal;
-                    int sizeOfLastBlock = paramPos %  MaxBlockSizeReal;
+void ESmry::loadDataRange(const std::vector<int>& keywIndVect,
+                          const std::size_t       first,
+                          const std::size_t       last) const
+{
+    std::ifstream fileH;
+    int openFileIndex = -1;
+    int columnsSpecInd = -1;
 
-                    if (nBlocks > 0)
-                        elementPos = static_cast<uint64_t>(nBlocks * blockSize_f);
+    // (vector index, offset relative to start of PARAMS data) of requested
+    // vectors which are defined in the current summary file.
+    std::vector<std::pair<int, std::uint64_t>> columns;
+    std::uint64_t minOffset = 0, maxEnd = 0;
 
-                    int nLines = sizeOfLastBlock / numColumnsReal;
-                    elementPos = stepFilePos + elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
+    std::vector<char> buffer;
 
-                    fileH.seekg (elementPos, fileH.beg);
+    std::size_t n = first;
 
-                    const std::size_t size = columnWidthReal;
-                    std::vector<char> buffer(size);
-                    fileH.read (buffer.data(), size);
-                    vectorData[ind].push_back(std::strtof(buffer.data(), nullptr));
-                }
-                else {
-                    const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
-                    std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
-                    elementPos += static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal) + stepFilePos;
+    while (n < last) {
+        const auto specInd = std::get<0>(timeStepList[n]);
+        const auto dataFileIndex = std::get<1>(timeStepList[n]);
+        const bool formatted = formattedFiles[specInd];
 
-                    fileH.seekg (elementPos, fileH.beg);
+        if (specInd != columnsSpecInd) {
+            columnsSpecInd = specInd;
+            columns.clear();
 
-                    float value;
-                    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
+            for (auto ind : keywIndVect) {
+                auto it = arrayPos[specInd].find(ind);
+                if (it != arrayPos[specInd].end()) {
+                    const auto offset = formatted
+                        ? paramOffsetFormatted(it->second)
+                        : paramOffsetBinary(it->second);
 
-                    vectorData[ind].push_back(Opm::EclIO::flipEndianFloat(value));
+                    columns.emplace_back(ind, offset);
                 }
             }
+
+            if (!columns.empty()) {
+                const auto width = static_cast<std::uint64_t>(formatted ? columnWidthReal : sizeOfReal);
+                const auto [minIt, maxIt] = std::minmax_element(columns.begin(), columns.end(),
+                                                                [](const auto& a, const auto& b)
+                                                                { return a.second < b.second; });
+                minOffset = minIt->second;
+                maxEnd = maxIt->second + width;
+            }
         }
-    }
 
-    fileH.close();
+        // Time steps covered by a single read, [n, m).
+        std::size_t m = n + 1;
 
-    for (const auto& ind : keywIndVect)
-        vectorLoaded[ind] = true;
+        if (columns.empty()) {
+            while ((m < last) && (std::get<0>(timeStepList[m]) == specInd))
+                ++m;
 
-    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
-    m_io_loading += elapsed_seconds.count();
+            n = m;
+            continue;
+        }
+
+        const auto windowStart = std::get<2>(timeStepList[n]) + minOffset;
+
+        while ((m < last) &&
+               (std::get<0>(timeStepList[m]) == specInd) &&
+               (std::get<1>(timeStepList[m]) == dataFileIndex))
+        {
+            const auto prevEnd = std::get<2>(timeStepList[m - 1]) + maxEnd;
+            const auto stepStart = std::get<2>(timeStepList[m]) + minOffset;
+            const auto stepEnd = std::get<2>(timeStepList[m]) + maxEnd;
+
+            if ((stepStart < prevEnd) ||
+                (stepStart - prevEnd > maxLoadWindowGap) ||
+                (stepEnd - windowStart > maxLoadWindowSize))
+            {
+                break;
+            }
+
+            ++m;
+        }
+
+        if (dataFileIndex != openFileIndex) {
+            fileH.close();
+            fileH.clear();
+
+            auto openMode = formatted
+                ? std::ios::in
+                : std::ios::in | std::ios::binary;
+
+            fileH.open(dataFileList[dataFileIndex], openMode);
+            if (!fileH)
+                OPM_THROW(std::runtime_error, "Unable to open summary file " + dataFileList[dataFileIndex]);
+
+            openFileIndex = dataFileIndex;
+        }
+
+        const auto windowSize = std::get<2>(timeStepList[m - 1]) + maxEnd - windowStart;
+
+        // Trailing nul character terminates the last formatted value
+        buffer.resize(windowSize + 1);
+        buffer[windowSize] = '\0';
+
+        fileH.seekg(windowStart, fileH.beg);
+        if (!fileH.read(buffer.data(), windowSize))
+            OPM_THROW(std::runtime_error, "Error reading summary data from file " + dataFileList[dataFileIndex]);
+
+        for (const auto& [ind, offset] : columns) {
+            auto& vect = vectorData[ind];
+
+            for (std::size_t step = n; step < m; ++step) {
+                const char* elm = buffer.data()
+                    + (std::get<2>(timeStepList[step]) - std::get<2>(timeStepList[n]))
+                    + (offset - minOffset);
+
+                if (formatted) {
+                    vect[step] = std::strtof(elm, nullptr);
+                }
+                else {
+                    float value;
+                    std::memcpy(&value, elm, sizeOfReal);
+                    vect[step] = Opm::EclIO::flipEndianFloat(value);
+                }
+            }
+        }
+
+        n = m;
+    }
 }
 
 std::vector<int> ESmry::makeKeywPosVector(int specInd) const
@@ -847,6 +1049,8 @@ void ESmry::loadData() const
     if (timeStepList.empty())
         return;
 
+    auto start = std::chrono::system_clock::now();
+
     std::fstream fileH;
 
     auto specInd = std::get<0>(timeStepList[0]);
@@ -952,6 +1156,9 @@ void ESmry::loadData() const
     }
 
     std::fill_n(vectorLoaded.begin(), nVect, true);
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
 }
 
 
@@ -1062,7 +1269,7 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
     return resultVect;
 }
 
-bool ESmry::make_esmry_file()
+bool ESmry::make_esmry_file(bool compressed)
 {
     // check that loadBaseRunData is not set, this function only works for single smspec files
     // function will not replace existing lodsmry files (since this is already loaded by this class)
@@ -1116,6 +1323,14 @@ bool ESmry::make_esmry_file()
             std::transform(keyword.begin(), keyword.end(), std::back_inserter(units),
                            [this](const auto& key) { return kwunits.at(key); });
 
+            if (compressed) {
+                writeESmryColumnsFile(smryDataFile.generic_string(), start_date_vect,
+                                      std::get<0>(restart_info), std::get<1>(restart_info),
+                                      keyword, units, is_rstep, mini_steps, vectorData);
+
+                return true;
+            }
+
             Opm::EclIO::EclOutput outFile(smryDataFile.generic_string(), false, std::ios::out);
 
             outFile.write<int>("START", start_date_vect);
@@ -45,6 +45,12 @@ public:
     // input is smspec (or fsmspec file)
     explicit ESmry(const std::string& filename, bool loadBaseRunData=false);
 
+    // Open case whose smspec file is identical to the one of sameSpec,
+    // reusing its parsed keywords instead of reading the smspec file.
+    // sameSpec must be opened without base run data, and restart
+    // information is not available for the new case.
+    ESmry(const std::string& filename, const ESmry& sameSpec);
+
     int numberOfVectors() const { return nVect; }
 
     bool hasKey(const std::string& key) const;
@@ -60,7 +66,15 @@ public:
     void loadData(const std::vector<std::string>& vectList) const;
     void loadData() const;
 
-    bool make_esmry_file();
+    // Upper limit on the number of threads used by loadData(), e.g., when
+    // several cases are loaded concurrently.  Zero, the default, selects
+    // the number of threads from the hardware and the number of time steps.
+    void setMaxLoadThreads(unsigned int numThreads) { loadThreadLimit = numThreads; }
+
+    // Creates <rootname>.ESMRY unless it already exists.  The compressed
+    // column layout (see ESmryColumns.hpp) is smaller and faster to read
+    // for single vectors, but not understood by older readers.
+    bool make_esmry_file(bool compressed = false);
 
     time_point startdate() const { return tp_startdat; }
     const std::vector<int>& start_v() const { return start_vect; }
@@ -120,6 +134,8 @@ private:
     mutable double m_io_opening;
     mutable double m_io_loading;
 
+    unsigned int loadThreadLimit{0};
+
     std::vector<std::string> checkForMultipleResultFiles(const std::filesystem::path& rootN, bool formatted) const;
 
     void getRstString(const std::vector<std::string>& restartArray,
@@ -156,7 +172,11 @@ private:
     std::vector<std::tuple <std::string, uint64_t>>
     getListOfArrays(const std::string& filename, bool formatted);
 
+    void scanResultFiles(const std::vector<std::pair<std::string, int>>& smryArray);
+
     std::vector<int> makeKeywPosVector(int speInd) const;
+    void loadDataRange(const std::vector<int>& keywIndVect,
+                       std::size_t first, std::size_t last) const;
     std::string read_string_from_disk(std::fstream& fileH, uint64_t size) const;
 
     void read_ministeps_from_disk();
@@ -0,0 +1,388 @@
+/*
+   Copyright 2025 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ESmryColumns.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Codec 1, one control byte c followed by zero or more data bytes
+//
+//   c & 0x80       run of (c & 0x7F) + 1 values equal to the previous
+//                  value, no data bytes.
+//
+//   otherwise      c = (lead << 3) | trail.  The XOR difference between
+//                  the value and its predecessor has 'lead' leading and
+//                  'trail' trailing zero bytes, and the 4 - lead - trail
+//                  bytes in between follow, most significant first.
+//
+// The predecessor of the first value has the bit pattern zero.
+
+namespace {
+
+constexpr unsigned char runFlag = 0x80;
+constexpr int maxRunLength = 128;
+
+// Size in bytes of binary array header.
+constexpr std::uint64_t headerSize = 24;
+
+std::uint32_t floatBits(const float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+float bitsFloat(const std::uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+// Compressed bytes are stored in INTE arrays.  Binary files are
+// big-endian, so the bytes appear in their original order on disk.
+std::vector<int> packBytes(const std::vector<unsigned char>& bytes)
+{
+    std::vector<int> words((bytes.size() + 3) / 4, 0);
+
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+        auto& word = reinterpret_cast<std::uint32_t&>(words[i / 4]);
+        word |= static_cast<std::uint32_t>(bytes[i]) << (8 * (3 - i % 4));
+    }
+
+    return words;
+}
+
+std::vector<int> fileOffset(const std::uint64_t offset)
+{
+    return { static_cast<int>(static_cast<std::uint32_t>(offset >> 32)),
+             static_cast<int>(static_cast<std::uint32_t>(offset & 0xFFFFFFFFu)) };
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+std::vector<unsigned char> compressSummaryVector(const std::vector<float>& values)
+{
+    std::vector<unsigned char> bytes;
+    bytes.reserve(values.size());
+
+    std::uint32_t prev = 0;
+    std::size_t i = 0;
+
+    while (i < values.size()) {
+        const auto bits = floatBits(values[i]);
+        const auto diff = bits ^ prev;
+
+        if (diff == 0) {
+            int run = 1;
+
+            while ((run < maxRunLength) && (i + run < values.size()) &&
+                   (floatBits(values[i + run]) == prev))
+            {
+                ++run;
+            }
+
+            bytes.push_back(runFlag | static_cast<unsigned char>(run - 1));
+            i += run;
+
+            continue;
+        }
+
+        int lead = 0;
+        while (((diff >> (24 - 8 * lead)) & 0xFF) == 0)
+            ++lead;
+
+        int trail = 0;
+        while (((diff >> (8 * trail)) & 0xFF) == 0)
+            ++trail;
+
+        bytes.push_back(static_cast<unsigned char>((lead << 3) | trail));
+
+        for (int k = 3 - lead; k >= trail; --k)
+            bytes.push_back(static_cast<unsigned char>((diff >> (8 * k)) & 0xFF));
+
+        prev = bits;
+        ++i;
+    }
+
+    return bytes;
+}
+
+std::vector<float> decompressSummaryVector(const unsigned char* data,
+                                           const std::size_t    size,
+                                           const std::size_t    num_values)
+{
+    std::vector<float> values;
+    values.reserve(num_values);
+
+    std::uint32_t prev = 0;
+    std::size_t p = 0;
+
+    while (values.size() < num_values) {
+        if (p >= size)
+            OPM_THROW(std::runtime_error, "Compressed summary vector holds too few values");
+
+        const auto c = data[p++];
+
+        if (c & runFlag) {
+            const std::size_t run = (c & ~runFlag) + 1;
+
+            if (values.size() + run > num_values)
+                OPM_THROW(std::runtime_error, "Compressed summary vector holds too many values");
+
+            values.insert(values.end(), run, bitsFloat(prev));
+            continue;
+        }
+
+        const int lead = c >> 3;
+        const int trail = c & 0x7;
+
+        if (lead + trail > 3)
+            OPM_THROW(std::runtime_error, "Invalid control byte in compressed summary vector");
+
+        const std::size_t nbytes = 4 - lead - trail;
+
+        if (p + nbytes > size)
+            OPM_THROW(std::runtime_error, "Compressed summary vector truncated");
+
+        std::uint32_t diff = 0;
+        for (std::size_t k = 0; k < nbytes; ++k)
+            diff = (diff << 8) | data[p++];
+
+        prev ^= diff << (8 * trail);
+        values.push_back(bitsFloat(prev));
+    }
+
+    if (p != size)
+        OPM_THROW(std::runtime_error, "Compressed summary vector holds too many values");
+
+    return values;
+}
+
+ESmryColumnsWriter::ESmryColumnsWriter(const std::string&              filename,
+                                       const std::vector<int>&         start,
+                                       const std::string&              restart_root,
+                                       const int                       restart_step,
+                                       const std::vector<std::string>& keys,
+                                       const std::vector<std::string>& units,
+                                       const std::vector<int>&         rstep,
+                                       const std::vector<int>&         tstep)
+    : filename_  { filename }
+    , num_vect_  { keys.size() }
+    , num_tstep_ { tstep.size() }
+{
+    if ((units.size() != num_vect_) || (rstep.size() != num_tstep_))
+        throw std::invalid_argument("Inconsistent summary data for compressed ESMRY file " + filename);
+
+    {
+        EclOutput outFile(filename, false, std::ios::out);
+
+        outFile.write<int>("START", start);
+
+        if (! restart_root.empty()) {
+            outFile.write<std::string>("RESTART", {restart_root});
+            outFile.write<int>("RSTNUM", {restart_step});
+        }
+
+        outFile.write("KEYCHECK", keys);
+        outFile.write("UNITS", units);
+        outFile.write<int>("COLUMNS", { ESmryColumns::version, ESmryColumns::codec,
+                                        static_cast<int>(num_vect_), static_cast<int>(num_tstep_) });
+        outFile.write<int>("RSTEP", rstep);
+        outFile.write<int>("TSTEP", tstep);
+    }
+
+    // Compressed sizes are not known until the vectors are appended, so
+    // the directory, which precedes the compressed vectors, is written as
+    // a placeholder of the same size and filled in by finish().
+
+    const auto dir_size = static_cast<std::int64_t>(ESmryColumns::dir_entry_size * num_vect_);
+
+    dir_offset_ = static_cast<std::uint64_t>(std::filesystem::file_size(filename));
+    offset_ = dir_offset_ + headerSize + sizeOnDiskBinary(dir_size, INTE, sizeOfInte);
+
+    directory_.reserve(dir_size);
+
+    output_ = std::make_unique<EclOutput>(filename, false, std::ios::app);
+    output_->write<int>("VECTDIR", std::vector<int>(dir_size, 0));
+}
+
+ESmryColumnsWriter::~ESmryColumnsWriter() = default;
+
+void ESmryColumnsWriter::append(const std::vector<float>& values)
+{
+    const auto n = directory_.size() / ESmryColumns::dir_entry_size;
+
+    if (! output_ || (n >= num_vect_))
+        throw std::logic_error("Too many vectors for compressed ESMRY file " + filename_);
+
+    if (values.size() != num_tstep_)
+        throw std::invalid_argument("Inconsistent number of time steps for compressed ESMRY file " + filename_);
+
+    const auto bytes = compressSummaryVector(values);
+    const auto words = packBytes(bytes);
+    const auto pos = fileOffset(offset_);
+
+    directory_.insert(directory_.end(), pos.begin(), pos.end());
+    directory_.push_back(static_cast<int>(bytes.size()));
+
+    output_->write<int>("C" + std::to_string(n), words);
+
+    offset_ += headerSize + sizeOnDiskBinary(static_cast<std::int64_t>(words.size()), INTE, sizeOfInte);
+}
+
+void ESmryColumnsWriter::finish()
+{
+    if (! output_ || (directory_.size() != ESmryColumns::dir_entry_size * num_vect_))
+        throw std::logic_error("Incomplete compressed ESMRY file " + filename_);
+
+    output_.reset();
+
+    // Overwrite the placeholder's data records.  The record markers are
+    // unchanged, since the directory has the same size.
+
+    std::vector<char> buffer;
+    buffer.reserve(sizeOnDiskBinary(static_cast<std::int64_t>(directory_.size()), INTE, sizeOfInte));
+
+    const auto append_int = [&buffer](const int value)
+    {
+        const auto flipped = flipEndianInt(value);
+        const auto* first = reinterpret_cast<const char*>(&flipped);
+        buffer.insert(buffer.end(), first, first + sizeOfInte);
+    };
+
+    constexpr auto max_block = static_cast<std::size_t>(MaxBlockSizeInte / sizeOfInte);
+
+    for (std::size_t i = 0; i < directory_.size(); i += max_block) {
+        const auto num = std::min(max_block, directory_.size() - i);
+        const auto marker = static_cast<int>(num * sizeOfInte);
+
+        append_int(marker);
+
+        for (std::size_t k = 0; k < num; ++k)
+            append_int(directory_[i + k]);
+
+        append_int(marker);
+    }
+
+    std::fstream fileH(filename_, std::ios::in | std::ios::out | std::ios::binary);
+
+    fileH.seekp(static_cast<std::streamoff>(dir_offset_ + headerSize), std::ios_base::beg);
+
+    if (! fileH.write(buffer.data(), buffer.size()))
+        OPM_THROW(std::runtime_error, "Writing vector directory of compressed ESMRY file " + filename_);
+}
+
+void writeESmryColumnsFile(const std::string&                     filename,
+                           const std::vector<int>&                start,
+                           const std::string&                     restart_root,
+                           const int                              restart_step,
+                           const std::vector<std::string>&        keys,
+                           const std::vector<std::string>&        units,
+                           const std::vector<int>&                rstep,
+                           const std::vector<int>&                tstep,
+                           const std::vector<std::vector<float>>& vectors)
+{
+    if (vectors.size() != keys.size())
+        throw std::invalid_argument("Inconsistent summary data for compressed ESMRY file " + filename);
+
+    ESmryColumnsWriter writer(filename, start, restart_root, restart_step,
+                              keys, units, rstep, tstep);
+
+    for (const auto& vect : vectors)
+        writer.append(vect);
+
+    writer.finish();
+}
+
+std::vector<float> readESmryColumn(std::fstream&       fileH,
+                                   const std::uint64_t offset,
+                                   const int           vector_index,
+                                   const std::size_t   num_bytes,
+                                   const std::size_t   num_values)
+{
+    std::string arrName;
+    std::int64_t arr_size;
+    eclArrType arrType;
+    int sizeOfElement;
+
+    fileH.seekg(static_cast<std::streamoff>(offset), std::ios_base::beg);
+    readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+    if ((trimr(arrName) != "C" + std::to_string(vector_index)) || (arrType != INTE) ||
+        (arr_size != static_cast<std::int64_t>((num_bytes + 3) / 4)))
+    {
+        OPM_THROW(std::runtime_error, "Unexpected array " + arrName + " in compressed ESMRY file");
+    }
+
+    // Single read of all blocks, then strip the record markers.
+
+    std::vector<char> buffer(sizeOnDiskBinary(arr_size, INTE, sizeOfInte));
+
+    if (! fileH.read(buffer.data(), buffer.size()))
+        OPM_THROW(std::runtime_error, "Reading compressed summary vector");
+
+    std::vector<unsigned char> bytes;
+    bytes.reserve(4 * static_cast<std::size_t>(arr_size));
+
+    std::size_t p = 0;
+
+    while (p < buffer.size()) {
+        int dhead, dtail;
+
+        std::memcpy(&dhead, buffer.data() + p, sizeof dhead);
+        dhead = flipEndianInt(dhead);
+
+        if ((dhead <= 0) || (dhead > MaxBlockSizeInte) ||
+            (p + 2 * sizeOfInte + dhead > buffer.size()))
+        {
+            OPM_THROW(std::runtime_error, "Invalid record in compressed ESMRY file");
+        }
+
+        const auto* first = reinterpret_cast<const unsigned char*>(buffer.data() + p + sizeOfInte);
+        bytes.insert(bytes.end(), first, first + dhead);
+
+        p += sizeOfInte + dhead;
+
+        std::memcpy(&dtail, buffer.data() + p, sizeof dtail);
+
+        if (flipEndianInt(dtail) != dhead)
+            OPM_THROW(std::runtime_error, "Record tail not matching header in compressed ESMRY file");
+
+        p += sizeOfInte;
+    }
+
+    return decompressSummaryVector(bytes.data(), num_bytes, num_values);
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,154 @@
+/*
+   Copyright 2025 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ESMRYCOLUMNS_HPP
+#define OPM_IO_ESMRYCOLUMNS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+class EclOutput;
+
+/// Compressed column layout of "transposed" summary files (.ESMRY).
+///
+/// Intended for post-processing caches which are written once and read
+/// many times.  The file consists of
+///
+///   START, [RESTART, RSTNUM], KEYCHECK, UNITS, COLUMNS, RSTEP, TSTEP, VECTDIR
+///
+/// followed by one INTE array, C<n>, of compressed values for each summary
+/// vector n.  COLUMNS holds the layout version, the codec, and the number
+/// of vectors and time steps.  VECTDIR holds three integers for each
+/// vector: the file offset of its C<n> array as a (high, low) pair of 32
+/// bit integers, and the number of compressed bytes.  Reading a single
+/// vector therefore only touches its directory entry and its own
+/// compressed block.
+struct ESmryColumns
+{
+    /// Layout version in COLUMNS array.
+    static constexpr int version = 1;
+
+    /// Codec of compressSummaryVector() in COLUMNS array.
+    static constexpr int codec = 1;
+
+    /// Number of integers in each VECTDIR entry.
+    static constexpr int dir_entry_size = 3;
+};
+
+/// Compress values of a single summary vector.
+///
+/// Each value is XORed with the bit pattern of its predecessor.  Runs of
+/// unchanged values are run-length coded, and other values store only the
+/// bytes between the leading and trailing zero bytes of the difference.
+/// Constant and slowly varying vectors, which dominate typical summary
+/// files, thus need between a fraction of a byte and three bytes per value.
+std::vector<unsigned char> compressSummaryVector(const std::vector<float>& values);
+
+/// Decompress \p num_values summary vector values from \p size bytes of
+/// compressSummaryVector() output at \p data.  Throws std::runtime_error
+/// if the data does not hold exactly \p num_values values.
+std::vector<float> decompressSummaryVector(const unsigned char* data,
+                                           std::size_t          size,
+                                           std::size_t          num_values);
+
+/// Incremental writer of files in compressed column layout.
+///
+/// Writes the file header and a placeholder VECTDIR on construction, and
+/// appends one C<n> array for each call to append(), in key order.  Only
+/// the vector being appended needs to be held in memory.  VECTDIR is
+/// filled in by finish(), which must be called once all vectors have been
+/// appended.
+class ESmryColumnsWriter
+{
+public:
+    /// Create \p filename, replacing any existing file.  Arguments are
+    /// the same as for writeESmryColumnsFile().
+    ESmryColumnsWriter(const std::string&              filename,
+                       const std::vector<int>&         start,
+                       const std::string&              restart_root,
+                       int                             restart_step,
+                       const std::vector<std::string>& keys,
+                       const std::vector<std::string>& units,
+                       const std::vector<int>&         rstep,
+                       const std::vector<int>&         tstep);
+
+    ~ESmryColumnsWriter();
+
+    ESmryColumnsWriter(const ESmryColumnsWriter&) = delete;
+    ESmryColumnsWriter& operator=(const ESmryColumnsWriter&) = delete;
+
+    /// Append values of next summary vector, one value per time step.
+    void append(const std::vector<float>& values);
+
+    /// Fill in VECTDIR.  Throws std::logic_error unless all vectors have
+    /// been appended.
+    void finish();
+
+private:
+    std::string filename_;
+    std::size_t num_vect_;
+    std::size_t num_tstep_;
+
+    // File offset of VECTDIR array.
+    std::uint64_t dir_offset_{0};
+
+    // File offset of next C<n> array.
+    std::uint64_t offset_{0};
+
+    std::vector<int> directory_;
+    std::unique_ptr<EclOutput> output_;
+};
+
+/// Write summary vectors in compressed column layout to \p filename,
+/// replacing any existing file.
+///
+/// \p start is the START array of ESMRY files, and \p restart_root is
+/// empty unless the run is restarted from step \p restart_step of another
+/// run.  \p rstep is the report step number of the last time step of each
+/// report step and zero otherwise, and \p tstep the time step number.
+/// Each element of \p vectors holds the values of the summary vector of
+/// the same index in \p keys for each time step.
+void writeESmryColumnsFile(const std::string&                     filename,
+                           const std::vector<int>&                start,
+                           const std::string&                     restart_root,
+                           int                                    restart_step,
+                           const std::vector<std::string>&        keys,
+                           const std::vector<std::string>&        units,
+                           const std::vector<int>&                rstep,
+                           const std::vector<int>&                tstep,
+                           const std::vector<std::vector<float>>& vectors);
+
+/// Read values of summary vector \p vector_index from a file in compressed
+/// column layout.  \p offset and \p num_bytes are the vector's VECTDIR
+/// entry, and \p num_values the number of time steps in COLUMNS.  Throws
+/// std::runtime_error if the file does not hold the expected data.
+std::vector<float> readESmryColumn(std::fstream& fileH,
+                                   std::uint64_t offset,
+                                   int           vector_index,
+                                   std::size_t   num_bytes,
+                                   std::size_t   num_values);
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ESMRYCOLUMNS_HPP
@@ -17,22 +17,271 @@
    */
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/ArrayIndexFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <cstring>
 #include <cstddef>
+#include <filesystem>
 #include <fstream>
 #include <string>
 #include <numeric>
 #include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 #include <fmt/format.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Number of elements per record in binary INTE, REAL, and DOUB arrays.
+// Must match block_size_data_binary().
+constexpr std::size_t numericRecordLength = 1000;
+
+template <typename T>
+constexpr Opm::EclIO::eclArrType numericArrayType()
+{
+    if constexpr (std::is_same_v<T, int>) {
+        return Opm::EclIO::INTE;
+    }
+    else if constexpr (std::is_same_v<T, float>) {
+        return Opm::EclIO::REAL;
+    }
+    else {
+        static_assert(std::is_same_v<T, double>,
+                      "Array views only support int, float, and double");
+        return Opm::EclIO::DOUB;
+    }
+}
+
+template <typename T>
+constexpr const char* numericTypeName()
+{
+    switch (numericArrayType<T>()) {
+    case Opm::EclIO::INTE: return "int";
+    case Opm::EclIO::REAL: return "float";
+    default:               return "double";
+    }
+}
+
+template <typename T>
+constexpr std::size_t recordStride()
+{
+    return numericRecordLength*sizeof(T) + 2*sizeof(int);
+}
+
+int recordMarker(const char* data)
+{
+    int marker;
+    std::memcpy(&marker, data, sizeof(marker));
+    return Opm::EclIO::flipEndianInt(marker);
+}
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
+/// Read-only memory mapping of an entire file.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return this->data_; }
+    std::size_t size() const { return this->size_; }
+
+private:
+    const char* data_{nullptr};
+    std::size_t size_{0};
+};
+
+#ifndef _WIN32
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error(fmt::format("Can not determine size of EclFile: {}", filename));
+    }
+
+    this->size_ = static_cast<std::size_t>(st.st_size);
+
+    if (this->size_ > 0) {
+        void* addr = ::mmap(nullptr, this->size_, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error(fmt::format("Can not memory map EclFile: {}", filename));
+        }
+
+        this->data_ = static_cast<const char*>(addr);
+    }
+
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (this->data_ != nullptr) {
+        ::munmap(const_cast<char*>(this->data_), this->size_);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    throw std::runtime_error(fmt::format("Memory mapped input not supported "
+                                         "on this platform: {}", filename));
+}
+
+MappedFile::~MappedFile() = default;
+
+#endif
+
+template <typename T>
+EclFile::ArrayView<T>::ArrayView(std::shared_ptr<const MappedFile> file,
+                                 const char* records, std::size_t size)
+    : file_(std::move(file))
+    , records_(records)
+    , size_(size)
+{}
+
+template <typename T>
+T EclFile::ArrayView<T>::operator[](std::size_t i) const
+{
+    const auto rec = i / numericRecordLength;
+    const auto pos = i % numericRecordLength;
+
+    T value;
+    std::memcpy(&value,
+                this->records_ + rec*recordStride<T>() + sizeof(int) + pos*sizeof(T),
+                sizeof(T));
+
+    flipEndianArray(&value, 1);
+
+    return value;
+}
+
+template <typename T>
+std::size_t EclFile::ArrayView<T>::numRecords() const
+{
+    return (this->size_ + numericRecordLength - 1) / numericRecordLength;
+}
+
+template <typename T>
+std::size_t EclFile::ArrayView<T>::recordSize(std::size_t rec) const
+{
+    return std::min(numericRecordLength, this->size_ - rec*numericRecordLength);
+}
+
+template <typename T>
+const char* EclFile::ArrayView<T>::recordData(std::size_t rec) const
+{
+    return this->records_ + rec*recordStride<T>() + sizeof(int);
+}
+
+template <typename T>
+void EclFile::ArrayView<T>::copyTo(T* dest) const
+{
+    for (std::size_t rec = 0; rec < this->numRecords(); ++rec) {
+        const auto num = this->recordSize(rec);
+        const auto numBytes = static_cast<int>(num * sizeof(T));
+        const char* head = this->records_ + rec*recordStride<T>();
+
+        if ((recordMarker(head) != numBytes) ||
+            (recordMarker(head + sizeof(int) + numBytes) != numBytes))
+        {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or EOF");
+        }
+
+        std::memcpy(dest, head + sizeof(int), numBytes);
+        flipEndianArray(dest, num);
+
+        dest += num;
+    }
+}
+
+template <typename T>
+std::vector<T> EclFile::ArrayView<T>::toVector() const
+{
+    std::vector<T> values(this->size_);
+    this->copyTo(values.data());
+
+    return values;
+}
+
+template class EclFile::ArrayView<int>;
+template class EclFile::ArrayView<float>;
+template class EclFile::ArrayView<double>;
+
+bool EclFile::loadIndex()
+{
+    auto index = readArrayIndexFile(this->inputFilename);
+    if (! index.has_value()) {
+        return false;
+    }
+
+    int n = 0;
+    for (const auto& entry : *index) {
+        array_size.push_back(entry.size);
+        array_type.push_back(entry.type);
+        array_name.push_back(entry.name);
+        array_element_size.push_back(entry.elementSize);
+
+        array_index[array_name[n]] = n;
+
+        ifStreamPos.push_back(entry.dataPos);
+
+        // SEQNUM values are part of the index, so they need not be read
+        // from the file itself.
+        const auto haveValue = (entry.name == "SEQNUM") &&
+            (entry.type == INTE) && (entry.size == 1);
+
+        if (haveValue) {
+            inte_array[n] = { entry.seqnum };
+        }
+
+        arrayLoaded.push_back(haveValue);
+
+        n++;
+    }
+
+    this->ifStreamPos.push_back(std::filesystem::file_size(this->inputFilename));
+
+    return true;
+}
+
+
 void EclFile::load(bool preload) {
+    if (!formatted && this->loadIndex()) {
+        if (preload)
+            this->loadData();
+
+        return;
+    }
+
     std::fstream fileH;
 
     if (formatted) {
@@ -96,6 +345,68 @@ void EclFile::load(bool preload) {
 }
 
 
+void EclFile::loadMapped(bool preload)
+{
+    this->mapped_file = std::make_shared<const MappedFile>(this->inputFilename);
+
+    if (this->loadIndex()) {
+        if (preload)
+            this->loadData();
+
+        return;
+    }
+
+    const char* data = this->mapped_file->data();
+    const std::size_t fileSize = this->mapped_file->size();
+
+    std::size_t pos = 0;
+    int n = 0;
+    while (pos < fileSize) {
+        std::string arrName(8,' ');
+        eclArrType arrType;
+        std::int64_t num;
+        int sizeOfElement;
+
+        try {
+            pos += readBinaryHeader(data + pos, fileSize - pos, arrName, num, arrType, sizeOfElement);
+        } catch (const std::exception& e){
+            OPM_THROW(std::runtime_error,
+                fmt::format("Unable to read array header from {}: {} \nPlease check if the file is corrupt!", this->inputFilename, e.what()));
+        }
+
+        array_size.push_back(num);
+        array_type.push_back(arrType);
+        array_name.push_back(trimr(arrName));
+        array_element_size.push_back(sizeOfElement);
+
+        array_index[array_name[n]] = n;
+
+        ifStreamPos.push_back(pos);
+
+        arrayLoaded.push_back(false);
+
+        if (num > 0) {
+            const auto sizeOfNextArray = sizeOnDiskBinary(num, arrType, sizeOfElement);
+            if (sizeOfNextArray > fileSize - pos) {
+                OPM_THROW(std::runtime_error,
+                          fmt::format("Array {} extends beyond end of file {}. "
+                                      "Please check if the file is corrupt!",
+                                      array_name[n], this->inputFilename));
+            }
+
+            pos += sizeOfNextArray;
+        }
+
+        n++;
+    }
+
+    this->ifStreamPos.push_back(fileSize);
+
+    if (preload)
+        this->loadData();
+}
+
+
 EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool preload) :
     formatted(fmt.value),
     inputFilename(filename)
@@ -104,6 +415,22 @@ EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool prelo
 }
 
 
+EclFile::EclFile(const std::string& filename, EclFile::MemoryMapped mmap, bool preload) :
+    inputFilename(filename)
+{
+    if (!fileExists(filename))
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+    formatted = isFormatted(filename);
+
+    if (mmap.value && !formatted) {
+        this->loadMapped(preload);
+    } else {
+        this->load(preload);
+    }
+}
+
+
 EclFile::EclFile(const std::string& filename, bool preload) :
     inputFilename(filename)
 {
@@ -117,6 +444,26 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
+    if (this->mapped_file) {
+        // Numeric arrays are converted directly from the mapping.
+        switch (array_type[arrIndex]) {
+        case INTE:
+            inte_array[arrIndex] = this->view<int>(arrIndex).toVector();
+            arrayLoaded[arrIndex] = true;
+            return;
+        case REAL:
+            real_array[arrIndex] = this->view<float>(arrIndex).toVector();
+            arrayLoaded[arrIndex] = true;
+            return;
+        case DOUB:
+            doub_array[arrIndex] = this->view<double>(arrIndex).toVector();
+            arrayLoaded[arrIndex] = true;
+            return;
+        default:
+            break;
+        }
+    }
+
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
     switch (array_type[arrIndex]) {
@@ -236,6 +583,19 @@ void EclFile::loadData(const std::string& name)
 
     } else {
 
+        // Arrays already loaded, e.g., SEQNUM values from an index file,
+        // need not be read again.
+        std::vector<std::size_t> arrIndices;
+        for (size_t i = 0; i < array_name.size(); i++) {
+            if ((array_name[i] == name) && !arrayLoaded[i]) {
+                arrIndices.push_back(i);
+            }
+        }
+
+        if (arrIndices.empty()) {
+            return;
+        }
+
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
 
@@ -243,10 +603,8 @@ void EclFile::loadData(const std::string& name)
             OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
         }
 
-        for (size_t i = 0; i < array_name.size(); i++) {
-            if (array_name[i] == name) {
-                loadBinaryArray(fileH, i);
-            }
+        for (const auto i : arrIndices) {
+            loadBinaryArray(fileH, i);
         }
 
         fileH.close();
@@ -633,6 +991,130 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
 }
 
 
+template <typename T>
+EclFile::ArrayView<T> EclFile::view(int arrIndex) const
+{
+    if (!this->mapped_file) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array views require memory mapped input, "
+                              "but {} is not memory mapped", this->inputFilename));
+    }
+
+    if ((arrIndex < 0) || (static_cast<std::size_t>(arrIndex) >= array_name.size())) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Array index {} out of range", arrIndex));
+    }
+
+    if (array_type[arrIndex] != numericArrayType<T>()) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array with index {} is not of type {}",
+                              arrIndex, numericTypeName<T>()));
+    }
+
+    return { this->mapped_file,
+             this->mapped_file->data() + ifStreamPos[arrIndex],
+             static_cast<std::size_t>(array_size[arrIndex]) };
+}
+
+template <typename T>
+EclFile::ArrayView<T> EclFile::view(const std::string& name) const
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        OPM_THROW(std::invalid_argument, "key '" + name + "' not found");
+    }
+
+    return this->view<T>(search->second);
+}
+
+template <typename T>
+std::vector<T> EclFile::getRange(int arrIndex, std::size_t offset, std::size_t count)
+{
+    if ((arrIndex < 0) || (static_cast<std::size_t>(arrIndex) >= array_name.size())) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Array index {} out of range", arrIndex));
+    }
+
+    if (array_type[arrIndex] != numericArrayType<T>()) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array with index {} is not of type {}",
+                              arrIndex, numericTypeName<T>()));
+    }
+
+    const auto size = static_cast<std::size_t>(array_size[arrIndex]);
+
+    if ((offset > size) || (count > size - offset)) {
+        OPM_THROW(std::out_of_range,
+                  fmt::format("Elements [{}, {}) out of range for array {} of size {}",
+                              offset, offset + count, array_name[arrIndex], size));
+    }
+
+    // Formatted files have no fixed record layout.
+    if (arrayLoaded[arrIndex] || formatted) {
+        const auto& values = this->get<T>(arrIndex);
+        return { values.begin() + offset, values.begin() + offset + count };
+    }
+
+    std::vector<T> values(count);
+
+    if (this->mapped_file) {
+        const auto arr = this->view<T>(arrIndex);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            values[i] = arr[offset + i];
+        }
+
+        return values;
+    }
+
+    std::fstream fileH(inputFilename, std::ios::in | std::ios::binary);
+
+    if (!fileH) {
+        OPM_THROW(std::runtime_error, "Can not open EclFile: " + inputFilename);
+    }
+
+    for (std::size_t i = 0; i < count; ) {
+        const auto rec = (offset + i) / numericRecordLength;
+        const auto pos = (offset + i) % numericRecordLength;
+        const auto num = std::min(numericRecordLength - pos, count - i);
+        const auto recSize = std::min(numericRecordLength, size - rec*numericRecordLength);
+
+        char head[sizeof(int)];
+
+        fileH.seekg(ifStreamPos[arrIndex] + rec*recordStride<T>(), std::ios_base::beg);
+        fileH.read(head, sizeof head);
+
+        if (!fileH || (recordMarker(head) != static_cast<int>(recSize*sizeof(T)))) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or EOF");
+        }
+
+        fileH.seekg(pos*sizeof(T), std::ios_base::cur);
+
+        if (!fileH.read(reinterpret_cast<char*>(values.data() + i), num*sizeof(T))) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or EOF");
+        }
+
+        i += num;
+    }
+
+    flipEndianArray(values.data(), count);
+
+    return values;
+}
+
+template std::vector<int> EclFile::getRange(int, std::size_t, std::size_t);
+template std::vector<float> EclFile::getRange(int, std::size_t, std::size_t);
+template std::vector<double> EclFile::getRange(int, std::size_t, std::size_t);
+
+template EclFile::ArrayView<int> EclFile::view(int) const;
+template EclFile::ArrayView<float> EclFile::view(int) const;
+template EclFile::ArrayView<double> EclFile::view(int) const;
+template EclFile::ArrayView<int> EclFile::view(const std::string&) const;
+template EclFile::ArrayView<float> EclFile::view(const std::string&) const;
+template EclFile::ArrayView<double> EclFile::view(const std::string&) const;
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
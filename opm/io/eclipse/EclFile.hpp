@@ -21,8 +21,11 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <ios>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <tuple>
@@ -32,6 +35,8 @@
 
 namespace Opm { namespace EclIO {
 
+class MappedFile;
+
 class EclFile
 {
 public:
@@ -39,9 +44,105 @@ public:
         bool value;
     };
 
+    struct MemoryMapped {
+        bool value;
+    };
+
+    /// Read-only view of a numeric (INTE, REAL, or DOUB) array in a
+    /// memory mapped binary file.
+    ///
+    /// The view refers directly to the file's contents and does not copy
+    /// or convert the array up front.  Elements are stored big-endian and
+    /// split into records of at most 1000 elements, so individual values
+    /// are converted to host byte order on access.  The view keeps the
+    /// mapping alive and remains valid after the EclFile object is gone.
+    template <typename T>
+    class ArrayView
+    {
+    public:
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = T;
+
+            const_iterator() = default;
+
+            T operator*() const { return (*this->view_)[this->index_]; }
+            const_iterator& operator++() { ++this->index_; return *this; }
+            const_iterator operator++(int) { auto it = *this; ++this->index_; return it; }
+
+            bool operator==(const const_iterator& that) const
+            { return this->index_ == that.index_; }
+
+            bool operator!=(const const_iterator& that) const
+            { return ! (*this == that); }
+
+        private:
+            friend class ArrayView;
+
+            const_iterator(const ArrayView* view, std::size_t index)
+                : view_(view), index_(index)
+            {}
+
+            const ArrayView* view_{nullptr};
+            std::size_t index_{0};
+        };
+
+        ArrayView() = default;
+
+        std::size_t size() const { return this->size_; }
+        bool empty() const { return this->size_ == 0; }
+
+        /// Element at position \p i, converted to host byte order.
+        T operator[](std::size_t i) const;
+
+        const_iterator begin() const { return { this, 0 }; }
+        const_iterator end() const { return { this, this->size_ }; }
+
+        /// Number of on-disk records holding the array's elements.
+        std::size_t numRecords() const;
+
+        /// Number of elements in record \p rec.
+        std::size_t recordSize(std::size_t rec) const;
+
+        /// Raw big-endian element data of record \p rec.  Points into the
+        /// mapped file and holds recordSize(rec) elements.
+        const char* recordData(std::size_t rec) const;
+
+        /// Convert all elements to host byte order into \p dest, which
+        /// must hold at least size() elements.  Validates record markers.
+        void copyTo(T* dest) const;
+
+        std::vector<T> toVector() const;
+
+    private:
+        friend class EclFile;
+
+        ArrayView(std::shared_ptr<const MappedFile> file,
+                  const char* records, std::size_t size);
+
+        std::shared_ptr<const MappedFile> file_{};
+        const char* records_{nullptr};
+        std::size_t size_{0};
+    };
+
     explicit EclFile(const std::string& filename, bool preload = false);
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
+
+    /// Open binary file through a read-only memory mapping.
+    ///
+    /// Array headers are scanned directly from the mapping and numeric
+    /// arrays are available through view<T>() without copying.  get<T>()
+    /// still works and converts arrays into the regular cache on first
+    /// use.  Formatted files are read as if mmap.value were false.
+    EclFile(const std::string& filename, MemoryMapped mmap, bool preload = false);
+
     bool formattedInput() const { return formatted; }
+    bool memoryMapped() const { return static_cast<bool>(this->mapped_file); }
 
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
@@ -70,6 +171,21 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    /// Zero-copy view of numeric array.  T must be int, float, or double
+    /// and match the array's type.  Requires memory mapped input.
+    template <typename T>
+    ArrayView<T> view(int arrIndex) const;
+
+    template <typename T>
+    ArrayView<T> view(const std::string& name) const;
+
+    /// Elements [offset, offset + count) of numeric array.  T must be
+    /// int, float, or double and match the array's type.  Unless the array
+    /// is already loaded, binary input reads only the records holding the
+    /// requested elements and does not add the array to the cache.
+    template <typename T>
+    std::vector<T> getRange(int arrIndex, std::size_t offset, std::size_t count);
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -96,6 +212,8 @@ protected:
 
     std::map<std::string, int> array_index;
 
+    std::shared_ptr<const MappedFile> mapped_file{};
+
     template<class T>
     const std::vector<T>& getImpl(int arrIndex, eclArrType type,
                                   const std::unordered_map<int, std::vector<T>>& array,
@@ -110,6 +228,8 @@ private:
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
     void load(bool preload);
+    bool loadIndex();
+    void loadMapped(bool preload);
 
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
@@ -23,14 +23,17 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
 #include <ios>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 #include <typeinfo>
 
 namespace Opm { namespace EclIO {
@@ -160,6 +163,7 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
 {
     int bhead = flipEndianInt(16);
     std::string name = arrName + std::string(8 - arrName.size(),' ');
+    const auto arrSize = size;
 
     // write X231 header if size larger that limits for 4 byte integers
     if (size > std::numeric_limits<int>::max()) {
@@ -217,15 +221,21 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
     }
 
     ofileH.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
+
+    if (this->arrayIndex.has_value()) {
+        auto& entry = this->arrayIndex->emplace_back();
+        entry.name = trimr(name);
+        entry.type = arrType;
+        entry.size = arrSize;
+        entry.elementSize = element_size;
+        entry.dataPos = static_cast<std::uint64_t>(ofileH.tellp());
+    }
 }
 
 template <typename T>
 void EclOutput::writeBinaryArray(const std::vector<T>& data)
 {
-    int num;
-    int64_t rest, offset;
-    int dhead;
-    int64_t size = data.size();
+    const int64_t size = data.size();
 
     eclArrType arrType = MESS;
 
@@ -249,76 +259,40 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
-    int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
-
-    rest = size * static_cast<int64_t>(sizeOfElement);
-
-    offset = 0;
-
-    while (rest > 0) {
-        if (rest > maxBlockSize) {
-            rest -= maxBlockSize;
-            num = maxNumberOfElements;
-        } else {
-            num = static_cast<int>(rest) / sizeOfElement;
-            rest = 0;
-        }
-
-        dhead = flipEndianInt(num * sizeOfElement);
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
-        if (arrType == INTE) {
-
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianInt(data[m + offset]);
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
-
-        } else if (arrType == REAL) {
-
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
+    const unsigned int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
 
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
+    // Record data is converted in a buffer that is reused for all records
+    // and arrays written to this file.
+    this->recordBuffer.resize(maxBlockSize);
+    char* record = this->recordBuffer.data();
 
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
+    for (int64_t offset = 0; offset < size; ) {
+        const int num = static_cast<int>
+            (std::min(size - offset, static_cast<int64_t>(maxNumberOfElements)));
 
-        } else if (arrType == DOUB) {
-
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
-
-            std::vector<int> logi_data;
-            logi_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                if (data[m + offset])
-                    logi_data[m] = logi_true_val;
-                else
-                    logi_data[m] = false_value;
-
-            ofileH.write(reinterpret_cast<char*>(logi_data.data()), logi_data.size() * sizeof(int)) ;
+        const int dhead = flipEndianInt(num * sizeOfElement);
 
+        if constexpr (std::is_same_v<T, bool>) {
+            for (int m = 0; m < num; m++) {
+                const unsigned int value = data[m + offset] ? logi_true_val : false_value;
+                std::memcpy(record + m*sizeof(value), &value, sizeof(value));
+            }
+        } else if constexpr (std::is_same_v<T, int> ||
+                             std::is_same_v<T, float> ||
+                             std::is_same_v<T, double>)
+        {
+            std::memcpy(record, data.data() + offset, num * sizeof(T));
+            flipEndianArray(reinterpret_cast<T*>(record), num);
         } else {
-
             std::cerr << "type not supported in write binaryarray\n";
             std::exit(EXIT_FAILURE);
         }
 
+        ofileH.write(reinterpret_cast<const char*>(&dhead), sizeof(dhead));
+        ofileH.write(record, num * sizeOfElement);
+        ofileH.write(reinterpret_cast<const char*>(&dhead), sizeof(dhead));
+
         offset += num;
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
@@ -354,6 +328,9 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int e
         OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
     }
 
+    this->recordBuffer.resize(maxBlockSize);
+    char* record = this->recordBuffer.data();
+
     while (rest > 0) {
         if (rest > maxBlockSize) {
             rest -= maxBlockSize;
@@ -365,15 +342,15 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int e
 
         dhead = flipEndianInt(num * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
-        for (int i = 0; i < num; i++) {
-            std::string tmpStr = data[n] + std::string(sizeOfElement - data[n].size(),' ');
-            ofileH.write(tmpStr.c_str(), sizeOfElement);
-            n++;
+        // Blank-padded, fixed-width elements.
+        std::fill(record, record + num*sizeOfElement, ' ');
+        for (int i = 0; i < num; i++, n++) {
+            data[n].copy(record + i*sizeOfElement, sizeOfElement);
         }
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        ofileH.write(record, num * sizeOfElement);
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
@@ -393,6 +370,9 @@ void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& d
         OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
     }
 
+    this->recordBuffer.resize(maxBlockSize);
+    char* record = this->recordBuffer.data();
+
     auto elm = data.begin();
     while (rest > 0) {
         const auto numElm = (rest > maxBlockSize)
@@ -403,13 +383,13 @@ void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& d
 
         auto dhead = flipEndianInt(numElm * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
         for (auto i = 0*numElm; i < numElm; ++i, ++elm) {
-            ofileH.write(elm->c_str(), sizeOfElement);
+            std::memcpy(record + i*sizeOfElement, elm->c_str(), sizeOfElement);
         }
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        ofileH.write(record, numElm * sizeOfElement);
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
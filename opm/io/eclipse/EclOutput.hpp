@@ -20,10 +20,12 @@
 
 #include <fstream>
 #include <ios>
+#include <optional>
 #include <string>
 #include <typeinfo>
 #include <vector>
 
+#include <opm/io/eclipse/ArrayIndexFile.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 
@@ -112,6 +114,13 @@ private:
 
     bool isFormatted, ix_standard;
     std::ofstream ofileH;
+
+    // Scratch space for one binary record, reused across writes.
+    std::vector<char> recordBuffer;
+
+    // Header information of each binary array written, if requested
+    // through OutputStream::Restart.  Used to create index files.
+    std::optional<std::vector<ArrayIndexEntry>> arrayIndex;
 };
 
 
@@ -24,11 +24,15 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include <fmt/format.h>
@@ -37,47 +41,96 @@
 #include <intrin.h>
 #endif
 
-int Opm::EclIO::flipEndianInt(int num)
-{
+namespace {
+
+    std::uint32_t byteSwap(const std::uint32_t x)
+    {
 #ifdef _MSC_VER
-    unsigned int tmp = _byteswap_ulong(num);
-    return static_cast<int>(tmp);
+        return _byteswap_ulong(x);
 #else
-    unsigned int tmp = __builtin_bswap32(num);
-    return static_cast<int>(tmp);
+        return __builtin_bswap32(x);
 #endif
-}
+    }
 
-std::int64_t Opm::EclIO::flipEndianLongInt(int64_t num)
-{
+    std::uint64_t byteSwap(const std::uint64_t x)
+    {
 #ifdef _MSC_VER
-    std::uint64_t tmp = _byteswap_uint64(num);
-    return static_cast<int64_t>(tmp);
+        return _byteswap_uint64(x);
 #else
-    std::uint64_t tmp = __builtin_bswap64(num);
-    return static_cast<int64_t>(tmp);
+        return __builtin_bswap64(x);
 #endif
-}
+    }
 
-float Opm::EclIO::flipEndianFloat(float num)
-{
-    float value = num;
+    template <typename T>
+    T flipEndian(const T num)
+    {
+        using UInt = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        static_assert(sizeof(T) == sizeof(UInt));
+
+        UInt tmp;
+        std::memcpy(&tmp, &num, sizeof tmp);
+        tmp = byteSwap(tmp);
 
-    char* floatToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(floatToConvert, floatToConvert+4);
+        T value;
+        std::memcpy(&value, &tmp, sizeof value);
 
-    return value;
+        return value;
+    }
+
+    // Simple loop over fixed-size elements.  Compilers turn this into
+    // vector shuffles (e.g., PSHUFB/VPSHUFB or REV) when the target
+    // instruction set supports them, and into BSWAP otherwise.
+    template <typename T>
+    void flipEndianInPlace(T* data, const std::size_t num)
+    {
+        using UInt = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        static_assert(sizeof(T) == sizeof(UInt));
+
+        auto* bytes = reinterpret_cast<unsigned char*>(data);
+
+        for (std::size_t i = 0; i < num; ++i) {
+            UInt tmp;
+            std::memcpy(&tmp, bytes + i*sizeof(UInt), sizeof tmp);
+            tmp = byteSwap(tmp);
+            std::memcpy(bytes + i*sizeof(UInt), &tmp, sizeof tmp);
+        }
+    }
+
+} // Anonymous namespace
+
+int Opm::EclIO::flipEndianInt(int num)
+{
+    return flipEndian(num);
 }
 
+std::int64_t Opm::EclIO::flipEndianLongInt(int64_t num)
+{
+    return flipEndian(num);
+}
+
+float Opm::EclIO::flipEndianFloat(float num)
+{
+    return flipEndian(num);
+}
 
 double Opm::EclIO::flipEndianDouble(double num)
 {
-    double value = num;
+    return flipEndian(num);
+}
+
+void Opm::EclIO::flipEndianArray(int* data, std::size_t num)
+{
+    flipEndianInPlace(data, num);
+}
 
-    char* doubleToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(doubleToConvert, doubleToConvert+8);
+void Opm::EclIO::flipEndianArray(float* data, std::size_t num)
+{
+    flipEndianInPlace(data, num);
+}
 
-    return value;
+void Opm::EclIO::flipEndianArray(double* data, std::size_t num)
+{
+    flipEndianInPlace(data, num);
 }
 
 bool Opm::EclIO::fileExists(const std::string& filename){
@@ -336,35 +389,14 @@ void Opm::EclIO::readBinaryHeader(std::fstream& fileH, std::string& tmpStrName,
     }
 }
 
-void Opm::EclIO::readBinaryHeader(std::fstream& fileH, std::string& arrName,
-                      std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize)
-{
-    std::string tmpStrName(8,' ');
-    std::string tmpStrType(4,' ');
-    int tmpSize;
-
-    readBinaryHeader(fileH, tmpStrName, tmpSize, tmpStrType);
-
-    if (tmpStrType == "X231"){
-        std::string x231ArrayName = tmpStrName;
-        int x231exp = tmpSize * (-1);
-
-        readBinaryHeader(fileH, tmpStrName, tmpSize, tmpStrType);
-
-        if (x231ArrayName != tmpStrName)
-            OPM_THROW(std::runtime_error, "Invalid X231 header, name should be same in both headers'");
-
-        if (x231exp < 0)
-            OPM_THROW(std::runtime_error, "Invalid X231 header, size of array should be negative'");
-
-        size = static_cast<std::int64_t>(tmpSize) + static_cast<std::int64_t>(x231exp) * pow(2,31);
-    } else {
-        size = static_cast<std::int64_t>(tmpSize);
-    }
+namespace {
 
+void binaryArrayType(const std::string& tmpStrType,
+                     Opm::EclIO::eclArrType& arrType,
+                     int& elementSize)
+{
     elementSize = 4;
 
-    arrName = tmpStrName;
     if (tmpStrType == "INTE")
         arrType = Opm::EclIO::INTE;
     else if (tmpStrType == "REAL")
@@ -389,6 +421,112 @@ void Opm::EclIO::readBinaryHeader(std::fstream& fileH, std::string& arrName,
         OPM_THROW(std::runtime_error, "Error, unknown array type '" + tmpStrType +"'");
 }
 
+std::int64_t x231ArraySize(const std::string& x231ArrayName, const int x231Size,
+                           const std::string& tmpStrName, const int tmpSize)
+{
+    int x231exp = x231Size * (-1);
+
+    if (x231ArrayName != tmpStrName)
+        OPM_THROW(std::runtime_error, "Invalid X231 header, name should be same in both headers'");
+
+    if (x231exp < 0)
+        OPM_THROW(std::runtime_error, "Invalid X231 header, size of array should be negative'");
+
+    return static_cast<std::int64_t>(tmpSize) + static_cast<std::int64_t>(x231exp) * pow(2,31);
+}
+
+// Decode a single 16 byte header record, including its record markers,
+// from memory.
+void readHeaderRecord(const char* data, const std::size_t avail, std::string& tmpStrName,
+                      int& tmpSize, std::string& tmpStrType)
+{
+    constexpr auto headerSize = std::size_t{16 + 2*sizeof(int)};
+
+    if (avail < headerSize) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Error reading binary header. Expected {} bytes, "
+                              "found {}", headerSize, avail));
+    }
+
+    int bhead, btail;
+    std::memcpy(&bhead, data, sizeof(bhead));
+    std::memcpy(&btail, data + headerSize - sizeof(btail), sizeof(btail));
+
+    bhead = Opm::EclIO::flipEndianInt(bhead);
+    btail = Opm::EclIO::flipEndianInt(btail);
+
+    if ((bhead != 16) || (btail != 16)) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Error reading binary header. Expected 16 bytes of header data,"
+                              " found {}", (bhead != 16) ? bhead : btail));
+    }
+
+    tmpStrName.assign(data + 4, 8);
+
+    std::memcpy(&tmpSize, data + 12, sizeof(tmpSize));
+    tmpSize = Opm::EclIO::flipEndianInt(tmpSize);
+
+    tmpStrType.assign(data + 16, 4);
+}
+
+} // Anonymous namespace
+
+void Opm::EclIO::readBinaryHeader(std::fstream& fileH, std::string& arrName,
+                      std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize)
+{
+    std::string tmpStrName(8,' ');
+    std::string tmpStrType(4,' ');
+    int tmpSize;
+
+    readBinaryHeader(fileH, tmpStrName, tmpSize, tmpStrType);
+
+    if (tmpStrType == "X231"){
+        std::string x231ArrayName = tmpStrName;
+        int x231Size = tmpSize;
+
+        readBinaryHeader(fileH, tmpStrName, tmpSize, tmpStrType);
+
+        size = x231ArraySize(x231ArrayName, x231Size, tmpStrName, tmpSize);
+    } else {
+        size = static_cast<std::int64_t>(tmpSize);
+    }
+
+    arrName = tmpStrName;
+    binaryArrayType(tmpStrType, arrType, elementSize);
+}
+
+std::size_t Opm::EclIO::readBinaryHeader(const char* data, const std::size_t avail,
+                                         std::string& arrName, std::int64_t& size,
+                                         Opm::EclIO::eclArrType& arrType, int& elementSize)
+{
+    constexpr auto headerSize = std::size_t{16 + 2*sizeof(int)};
+
+    std::string tmpStrName(8,' ');
+    std::string tmpStrType(4,' ');
+    int tmpSize;
+
+    readHeaderRecord(data, avail, tmpStrName, tmpSize, tmpStrType);
+
+    auto consumed = headerSize;
+
+    if (tmpStrType == "X231"){
+        std::string x231ArrayName = tmpStrName;
+        int x231Size = tmpSize;
+
+        readHeaderRecord(data + consumed, avail - consumed, tmpStrName, tmpSize, tmpStrType);
+        consumed += headerSize;
+
+        size = x231ArraySize(x231ArrayName, x231Size, tmpStrName, tmpSize);
+    } else {
+        size = static_cast<std::int64_t>(tmpSize);
+    }
+
+    arrName = tmpStrName;
+    binaryArrayType(tmpStrType, arrType, elementSize);
+
+    return consumed;
+}
+
 
 void Opm::EclIO::readFormattedHeader(std::fstream& fileH, std::string& arrName,
                          std::int64_t &num, Opm::EclIO::eclArrType &arrType, int& elementSize)
@@ -441,142 +579,193 @@ void Opm::EclIO::readFormattedHeader(std::fstream& fileH, std::string& arrName,
     }
 }
 
-template<typename T, typename T2>
-std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64_t size, Opm::EclIO::eclArrType type,
-                               std::function<T(T2)>& flip, int elementSize)
-{
-    std::vector<T> arr;
+namespace {
 
-    auto sizeData = block_size_data_binary(type);
+    // Size of single array element and maximum number of elements in a
+    // single binary record.
+    std::tuple<int, int>
+    binaryRecordLimits(const Opm::EclIO::eclArrType type, const int elementSize)
+    {
+        const auto [sizeOfElement, maxBlockSize] =
+            Opm::EclIO::block_size_data_binary(type);
 
-    if (type == Opm::EclIO::C0NN){
-        std::get<1>(sizeData)= std::get<1>(sizeData) / std::get<0>(sizeData) * elementSize;
-        std::get<0>(sizeData) = elementSize;
+        if (type == Opm::EclIO::C0NN) {
+            return { elementSize, maxBlockSize / sizeOfElement };
+        }
+
+        return { sizeOfElement, maxBlockSize / sizeOfElement };
     }
 
-    const int sizeOfElement = std::get<0>(sizeData);
-    const int maxBlockSize = std::get<1>(sizeData);
-    const int maxNumberOfElements = maxBlockSize / sizeOfElement;
+    // Validate the records of a binary array of 'size' elements and call
+    // readRecord(offset, num) for each record.  The stream is positioned
+    // at the start of the record's data when readRecord() is called, and
+    // 'offset' is the array index of the record's first element.
+    template <typename ReadRecord>
+    void readBinaryRecords(std::fstream&      fileH,
+                           const std::int64_t size,
+                           const int          sizeOfElement,
+                           const int          maxNumberOfElements,
+                           ReadRecord&&       readRecord)
+    {
+        std::int64_t rest = size;
+
+        while (rest > 0) {
+            int dhead;
+            fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+            dhead = Opm::EclIO::flipEndianInt(dhead);
+            const int num = dhead / sizeOfElement;
+
+            if ((num > maxNumberOfElements) || (num < 0)) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+            }
 
-    arr.reserve(size);
+            // Only the last record may hold fewer than the maximum number
+            // of elements.
+            if ((num > rest) || ((num < maxNumberOfElements) && (num != rest))) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, incorrect number of elements");
+            }
 
-    std::int64_t rest = size;
+            readRecord(size - rest, num);
 
-    while (rest > 0) {
-        int dhead;
-        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-        dhead = Opm::EclIO::flipEndianInt(dhead);
-        const int num = dhead / sizeOfElement;
+            rest -= num;
 
-        if ((num > maxNumberOfElements) || (num < 0)) {
-            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
-        }
+            int dtail;
+            fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+            dtail = Opm::EclIO::flipEndianInt(dtail);
 
-        if constexpr (std::is_same_v<T2, std::string>) {
-            for (int i = 0; i < num; i++) {
-                T2 value;
-                value.resize(sizeOfElement) ;
-                fileH.read(&value[0], sizeOfElement);
-                arr.push_back(flip(value));
+            if (dhead != dtail) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
             }
-        } else {
-            std::vector<T2> buf(num);
-            fileH.read(reinterpret_cast<char*>(buf.data()), buf.size()*sizeof(T2));
-
-            for (const auto& value : buf)
-                arr.push_back(flip(value));
         }
+    }
 
-        rest -= num;
-
-        if (( num < maxNumberOfElements && rest != 0) ||
-            (num == maxNumberOfElements && rest < 0)) {
-            OPM_THROW(std::runtime_error, "Error reading binary data, incorrect number of elements");
-        }
-
-        int dtail;
-        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
-        dtail = Opm::EclIO::flipEndianInt(dtail);
-
-        if (dhead != dtail) {
-            OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
-        }
+    // Read fixed-size array elements directly into the result array, then
+    // convert each record in place using convert(first, num) while the
+    // record's data is still in cache.
+    template <typename T, typename Convert>
+    std::vector<T> readBinaryArray(std::fstream&                  fileH,
+                                   const std::int64_t             size,
+                                   const Opm::EclIO::eclArrType   type,
+                                   Convert&&                      convert)
+    {
+        const auto [sizeOfElement, maxNumberOfElements] =
+            binaryRecordLimits(type, static_cast<int>(sizeof(T)));
+
+        std::vector<T> arr(size);
+
+        readBinaryRecords(fileH, size, sizeOfElement, maxNumberOfElements,
+                          [&fileH, &arr, &convert](const std::int64_t offset, const int num)
+                          {
+                              fileH.read(reinterpret_cast<char*>(arr.data() + offset),
+                                         static_cast<std::streamsize>(num) * sizeof(T));
+
+                              convert(arr.data() + offset, num);
+                          });
+
+        return arr;
     }
 
-    return arr;
-}
+    // Read character array elements of 'elementSize' bytes each, with
+    // trailing blanks removed.
+    std::vector<std::string>
+    readBinaryStringArray(std::fstream&                fileH,
+                          const std::int64_t           size,
+                          const Opm::EclIO::eclArrType type,
+                          const int                    elementSize)
+    {
+        const auto [sizeOfElement, maxNumberOfElements] =
+            binaryRecordLimits(type, elementSize);
+
+        std::vector<std::string> arr(size);
+        std::vector<char> buf(static_cast<std::size_t>(maxNumberOfElements) * sizeOfElement);
+
+        readBinaryRecords(fileH, size, sizeOfElement, maxNumberOfElements,
+                          [&fileH, &arr, &buf, sizeOfElement = sizeOfElement]
+                          (const std::int64_t offset, const int num)
+                          {
+                              fileH.read(buf.data(), static_cast<std::streamsize>(num) * sizeOfElement);
+
+                              for (int i = 0; i < num; ++i) {
+                                  arr[offset + i] = Opm::EclIO::trimr
+                                      (std::string(buf.data() + i*sizeOfElement, sizeOfElement));
+                              }
+                          });
+
+        return arr;
+    }
 
+} // Anonymous namespace
 
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    return readBinaryArray<int>(fileH, size, Opm::EclIO::INTE,
+                                [](int* data, const int num)
+                                { Opm::EclIO::flipEndianArray(data, num); });
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    return readBinaryArray<float>(fileH, size, Opm::EclIO::REAL,
+                                  [](float* data, const int num)
+                                  { Opm::EclIO::flipEndianArray(data, num); });
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    return readBinaryArray<double>(fileH, size, Opm::EclIO::DOUB,
+                                   [](double* data, const int num)
+                                   { Opm::EclIO::flipEndianArray(data, num); });
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<bool(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              bool value = false;
-                                              if (intVal == Opm::EclIO::true_value_ecl) {
-                                                  value = true;
-                                              } else if (intVal == Opm::EclIO::false_value) {
-                                                  value = false;
-                                              } else if (intVal == Opm::EclIO::true_value_ix) {
-                                                  value = true;
-                                              } else {
-                                                  OPM_THROW(std::runtime_error, "Error reading logi value");
-                                              }
+    const auto [sizeOfElement, maxNumberOfElements] =
+        binaryRecordLimits(Opm::EclIO::LOGI, sizeOfLogi);
+
+    std::vector<bool> arr(size);
+    std::vector<unsigned int> buf(maxNumberOfElements);
+
+    readBinaryRecords(fileH, size, sizeOfElement, maxNumberOfElements,
+                      [&fileH, &arr, &buf](const std::int64_t offset, const int num)
+                      {
+                          fileH.read(reinterpret_cast<char*>(buf.data()),
+                                     static_cast<std::streamsize>(num) * sizeof(unsigned int));
 
-                                              return value;
-                                          };
-    return readBinaryArray<bool,unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+                          for (int i = 0; i < num; ++i) {
+                              const auto intVal = buf[i];
+
+                              if ((intVal == Opm::EclIO::true_value_ecl) ||
+                                  (intVal == Opm::EclIO::true_value_ix))
+                              {
+                                  arr[offset + i] = true;
+                              }
+                              else if (intVal != Opm::EclIO::false_value) {
+                                  OPM_THROW(std::runtime_error, "Error reading logi value");
+                              }
+                          }
+                      });
+
+    return arr;
 }
 
 std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<unsigned int(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              return intVal;
-                                          };
-    return readBinaryArray<unsigned int, unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    return readBinaryArray<unsigned int>(fileH, size, Opm::EclIO::LOGI,
+                                         [](unsigned int*, int) {});
 }
 
 
 std::vector<std::string> Opm::EclIO::readBinaryCharArray(std::fstream& fileH, const std::int64_t size)
 {
-    using Char8 = std::array<char, 8>;
-    std::function<std::string(Char8)> f = [](const Char8& val)
-                                          {
-                                              std::string res(val.begin(), val.end());
-                                              return Opm::EclIO::trimr(res);
-                                          };
-    return readBinaryArray<std::string,Char8>(fileH, size, Opm::EclIO::CHAR, f, sizeOfChar);
+    return readBinaryStringArray(fileH, size, Opm::EclIO::CHAR, sizeOfChar);
 }
 
 
 std::vector<std::string> Opm::EclIO::readBinaryC0nnArray(std::fstream& fileH, const std::int64_t size, int elementSize)
 {
-    std::function<std::string(std::string)> f = [](const std::string& val)
-                                          {
-                                              return Opm::EclIO::trimr(val);
-                                          };
-
-    return readBinaryArray<std::string,std::string>(fileH, size, Opm::EclIO::C0NN, f, elementSize);
+    return readBinaryStringArray(fileH, size, Opm::EclIO::C0NN, elementSize);
 }
 
 
@@ -22,6 +22,7 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -34,6 +35,14 @@ namespace Opm { namespace EclIO {
     std::int64_t flipEndianLongInt(std::int64_t num);
     float flipEndianFloat(float num);
     double flipEndianDouble(double num);
+
+    /// Reverse the byte order of each element of a contiguous array in
+    /// place.  Converts between the big-endian representation of binary
+    /// result files and the host representation without allocating.
+    void flipEndianArray(int* data, std::size_t num);
+    void flipEndianArray(float* data, std::size_t num);
+    void flipEndianArray(double* data, std::size_t num);
+
     bool isEOF(std::fstream* fileH);
     bool fileExists(const std::string& filename);
     bool isFormatted(const std::string& filename);
@@ -64,13 +73,15 @@ namespace Opm { namespace EclIO {
     void readBinaryHeader(std::fstream& fileH, std::string& arrName,
                       std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize);
 
+    /// Decode array header from memory buffer \p data holding \p avail
+    /// bytes.  Returns the number of bytes occupied by the header,
+    /// including any X231 prefix header.
+    std::size_t readBinaryHeader(const char* data, std::size_t avail, std::string& arrName,
+                      std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize);
+
     void readFormattedHeader(std::fstream& fileH, std::string& arrName,
                       std::int64_t &num, Opm::EclIO::eclArrType &arrType, int& elementSize);
 
-    template<typename T, typename T2>
-    std::vector<T> readBinaryArray(std::fstream& fileH, const std::int64_t size, Opm::EclIO::eclArrType type,
-                               std::function<T(T2)>& flip, int elementSize);
-
     std::vector<int> readBinaryInteArray(std::fstream &fileH, const std::int64_t size);
     std::vector<float> readBinaryRealArray(std::fstream& fileH, const std::int64_t size);
     std::vector<double> readBinaryDoubArray(std::fstream& fileH, const std::int64_t size);
@@ -0,0 +1,344 @@
+/*
+   Copyright 2025 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/EnsembleSummary.hpp>
+
+#include <opm/io/eclipse/ESmry.hpp>
+#include <opm/io/eclipse/ExtESmry.hpp>
+
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Call fn(i) for i = 0, ..., n - 1 on up to numThreads threads.  The
+// first exception thrown by any call is rethrown once all threads are
+// done.
+template <typename Function>
+void parallelFor(const std::size_t n, const unsigned int numThreads, Function&& fn)
+{
+    const auto nthreads = static_cast<unsigned int>
+        (std::min(static_cast<std::size_t>(numThreads), n));
+
+    if (nthreads <= 1) {
+        for (std::size_t i = 0; i < n; ++i)
+            fn(i);
+
+        return;
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error{};
+    std::mutex errorMutex{};
+
+    auto worker = [&]()
+    {
+        for (auto i = next++; i < n; i = next++) {
+            try {
+                fn(i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+
+                if (! error)
+                    error = std::current_exception();
+
+                next = n;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads - 1);
+
+    for (unsigned int t = 1; t < nthreads; ++t)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (auto& thread : threads)
+        thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+bool isExtSummaryFile(const std::string& filename)
+{
+    return std::filesystem::path(filename).extension() == ".ESMRY";
+}
+
+std::string readFileContent(const std::string& filename)
+{
+    auto smspecFile = std::filesystem::path(filename);
+
+    if (smspecFile.extension() == "")
+        smspecFile += ".SMSPEC";
+
+    std::ifstream is(smspecFile, std::ios::in | std::ios::binary);
+
+    if (! is)
+        throw std::invalid_argument("Unable to open summary specification " + smspecFile.string());
+
+    return { std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+}
+
+double toSeconds(const Opm::time_point& tp)
+{
+    return std::chrono::duration<double>(tp.time_since_epoch()).count();
+}
+
+// Rates and ratios are averages over the time step ending at their time
+// stamp, so the value holds for the entire time step.
+bool isTimeStepAverage(const std::string& key)
+{
+    const auto type = Opm::parseKeywordType(key.substr(0, key.find(':')));
+
+    return (type == Opm::SummaryConfigNode::Type::Rate)
+        || (type == Opm::SummaryConfigNode::Type::Ratio);
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+EnsembleSummary::EnsembleSummary(const std::vector<std::string>& filenames, const int numThreads)
+    : m_cases(filenames.size())
+    , m_numSpecGroups(0)
+    , m_numThreads(numThreads > 0 ? static_cast<unsigned int>(numThreads)
+                                  : std::max(std::thread::hardware_concurrency(), 1u))
+    // Cases are opened and loaded concurrently, so each case's loader
+    // gets an equal share of the threads instead of starting its own.
+    , m_loadThreadsPerCase(std::max(m_numThreads / static_cast<unsigned int>
+                                    (std::max(filenames.size(), std::size_t{1})), 1u))
+{
+    for (std::size_t i = 0; i < filenames.size(); ++i)
+        m_cases[i].filename = filenames[i];
+
+    // Group cases by smspec file content.  The first case of each group,
+    // and all ESMRY cases, are opened on their own, the remaining cases
+    // reuse the keywords of their group's first case.  Cases are grouped
+    // by the size and hash of their smspec files.  Only the content of
+    // each group's first case is kept, and compared with the content of
+    // cases with the same size and hash to rule out hash collisions.
+
+    std::vector<std::string> specContent(filenames.size());
+    std::vector<std::pair<std::size_t, std::size_t>> specKey(filenames.size());
+
+    parallelFor(filenames.size(), m_numThreads, [&](const std::size_t i)
+    {
+        if (isExtSummaryFile(filenames[i]))
+            return;
+
+        specContent[i] = readFileContent(filenames[i]);
+        specKey[i] = { specContent[i].size(), std::hash<std::string_view>{}(specContent[i]) };
+    });
+
+    std::map<std::pair<std::size_t, std::size_t>, std::vector<std::size_t>> groupLeaders;
+    std::vector<std::size_t> leader(filenames.size());
+
+    for (std::size_t i = 0; i < filenames.size(); ++i) {
+        leader[i] = i;
+
+        if (isExtSummaryFile(filenames[i]))
+            continue;
+
+        auto& leaders = groupLeaders[specKey[i]];
+
+        const auto same = std::find_if(leaders.begin(), leaders.end(), [&](const std::size_t l)
+        {
+            return std::memcmp(specContent[l].data(), specContent[i].data(), specContent[i].size()) == 0;
+        });
+
+        if (same == leaders.end()) {
+            leaders.push_back(i);
+        }
+        else {
+            leader[i] = *same;
+            specContent[i] = std::string{};
+        }
+    }
+
+    m_numSpecGroups = 0;
+    for (const auto& group : groupLeaders)
+        m_numSpecGroups += group.second.size();
+
+    specContent.clear();
+    groupLeaders.clear();
+
+    auto openCase = [this](Case& smryCase, const Case* sameSpec)
+    {
+        std::vector<time_point> dates;
+
+        if (isExtSummaryFile(smryCase.filename)) {
+            smryCase.ext_smry = std::make_unique<ExtESmry>(smryCase.filename);
+            dates = smryCase.ext_smry->dates();
+        }
+        else {
+            smryCase.smry = (sameSpec == nullptr)
+                ? std::make_unique<ESmry>(smryCase.filename)
+                : std::make_unique<ESmry>(smryCase.filename, *sameSpec->smry);
+
+            smryCase.smry->setMaxLoadThreads(m_loadThreadsPerCase);
+            dates = smryCase.smry->dates();
+        }
+
+        smryCase.seconds.reserve(dates.size());
+        std::transform(dates.begin(), dates.end(), std::back_inserter(smryCase.seconds), toSeconds);
+    };
+
+    parallelFor(m_cases.size(), m_numThreads, [&](const std::size_t i)
+    {
+        if (leader[i] == i)
+            openCase(m_cases[i], nullptr);
+    });
+
+    parallelFor(m_cases.size(), m_numThreads, [&](const std::size_t i)
+    {
+        if (leader[i] != i)
+            openCase(m_cases[i], &m_cases[leader[i]]);
+    });
+
+    std::set<std::string> keywords;
+    std::set<time_point> reportDates;
+
+    for (auto& smryCase : m_cases) {
+        const auto& keys = smryCase.smry ? smryCase.smry->keywordList()
+                                         : smryCase.ext_smry->keywordList();
+
+        keywords.insert(keys.begin(), keys.end());
+
+        const auto dates = smryCase.smry ? smryCase.smry->dates_at_rstep()
+                                         : smryCase.ext_smry->dates_at_rstep();
+
+        reportDates.insert(dates.begin(), dates.end());
+    }
+
+    m_keyword.assign(keywords.begin(), keywords.end());
+    m_reportDates.assign(reportDates.begin(), reportDates.end());
+}
+
+EnsembleSummary::~EnsembleSummary() = default;
+
+std::vector<std::string> EnsembleSummary::caseFiles() const
+{
+    std::vector<std::string> files;
+    files.reserve(m_cases.size());
+
+    std::transform(m_cases.begin(), m_cases.end(), std::back_inserter(files),
+                   [](const Case& smryCase) { return smryCase.filename; });
+
+    return files;
+}
+
+bool EnsembleSummary::hasKey(const std::string& key) const
+{
+    return std::binary_search(m_keyword.begin(), m_keyword.end(), key);
+}
+
+EnsembleSummary::Matrix EnsembleSummary::get(const std::string& key) const
+{
+    return this->get(key, m_reportDates);
+}
+
+EnsembleSummary::Matrix
+EnsembleSummary::get(const std::string& key, const std::vector<time_point>& dates) const
+{
+    if (! this->hasKey(key))
+        throw std::invalid_argument("summary key '" + key + "' not found in any case");
+
+    if (! std::is_sorted(dates.begin(), dates.end()))
+        throw std::invalid_argument("dates for ensemble summary vector must be sorted");
+
+    Matrix matrix;
+    matrix.numTimes = dates.size();
+    matrix.numCases = m_cases.size();
+    matrix.values.assign(matrix.numTimes * matrix.numCases, std::numeric_limits<float>::quiet_NaN());
+
+    std::vector<double> target;
+    target.reserve(dates.size());
+    std::transform(dates.begin(), dates.end(), std::back_inserter(target), toSeconds);
+
+    // Time step averages take the value of the time step containing the
+    // target time, other vectors are interpolated linearly.
+    const bool stepwise = isTimeStepAverage(key);
+
+    parallelFor(m_cases.size(), m_numThreads, [&](const std::size_t c)
+    {
+        const auto& smryCase = m_cases[c];
+
+        const bool has_key = smryCase.smry ? smryCase.smry->hasKey(key)
+                                           : smryCase.ext_smry->hasKey(key);
+        if (! has_key)
+            return;
+
+        const auto& vect = smryCase.smry ? smryCase.smry->get(key)
+                                         : smryCase.ext_smry->get(key);
+
+        const auto& time = smryCase.seconds;
+
+        if (time.empty())
+            return;
+
+        // Both time axes are sorted, so one sweep finds all brackets.
+        auto it = time.begin();
+
+        for (std::size_t t = 0; t < target.size(); ++t) {
+            if ((target[t] < time.front()) || (target[t] > time.back()))
+                continue;
+
+            it = std::lower_bound(it, time.end(), target[t]);
+
+            const auto i = static_cast<std::size_t>(std::distance(time.begin(), it));
+            float value;
+
+            if ((*it == target[t]) || stepwise) {
+                value = vect[i];
+            }
+            else {
+                const double w = (target[t] - time[i - 1]) / (time[i] - time[i - 1]);
+                value = static_cast<float>((1.0 - w) * vect[i - 1] + w * vect[i]);
+            }
+
+            matrix.values[t*matrix.numCases + c] = value;
+        }
+    });
+
+    return matrix;
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,110 @@
+/*
+   Copyright 2025 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ENSEMBLESUMMARY_HPP
+#define OPM_IO_ENSEMBLESUMMARY_HPP
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+class ESmry;
+class ExtESmry;
+
+/// Summary data of an ensemble of simulation cases.
+///
+/// Each case is either an .SMSPEC/.FSMSPEC file, read with ESmry, or an
+/// .ESMRY file, read with ExtESmry.  Cases are opened and loaded
+/// concurrently.  Keywords are parsed only once for each group of cases
+/// with identical smspec files, as is typical for realisations of the
+/// same model.  Base run data of restarted cases is not loaded.  The
+/// threads are shared between the cases, so loading a single case does
+/// not start additional threads unless there are fewer cases than threads.
+///
+/// The time stamps of each case are read when opening, everything else
+/// on request.  An object must not be used from several threads at once.
+class EnsembleSummary
+{
+public:
+    /// Values of a single summary vector for all cases on a common time
+    /// axis, stored row by row.  Values before the first or after the last
+    /// time step of a case, and values of cases without the vector, are NaN.
+    struct Matrix
+    {
+        std::size_t numTimes{0};
+        std::size_t numCases{0};
+        std::vector<float> values{};
+
+        float operator()(const std::size_t t, const std::size_t c) const
+        {
+            return values[t*numCases + c];
+        }
+    };
+
+    /// Open all cases in \p filenames using at most \p numThreads
+    /// threads, or one thread per hardware thread if zero.
+    explicit EnsembleSummary(const std::vector<std::string>& filenames, int numThreads = 0);
+    ~EnsembleSummary();
+
+    EnsembleSummary(const EnsembleSummary&) = delete;
+    EnsembleSummary& operator=(const EnsembleSummary&) = delete;
+
+    std::size_t numberOfCases() const { return m_cases.size(); }
+    std::size_t numberOfSpecGroups() const { return m_numSpecGroups; }
+    std::vector<std::string> caseFiles() const;
+
+    /// Sorted union of summary keys of all cases.
+    const std::vector<std::string>& keywordList() const { return m_keyword; }
+    bool hasKey(const std::string& key) const;
+
+    /// Sorted union of the report step dates of all cases.
+    const std::vector<time_point>& reportDates() const { return m_reportDates; }
+
+    /// Values of \p key at reportDates(), or at \p dates, which must be
+    /// sorted.  Between time steps of a case, rates and ratios, which are
+    /// averages over a time step, take the value at the end of the time
+    /// step, and all other vectors are linearly interpolated.  Throws
+    /// std::invalid_argument unless at least one case has \p key.
+    Matrix get(const std::string& key) const;
+    Matrix get(const std::string& key, const std::vector<time_point>& dates) const;
+
+private:
+    struct Case
+    {
+        std::string filename;
+        std::unique_ptr<ESmry> smry;
+        std::unique_ptr<ExtESmry> ext_smry;
+        std::vector<double> seconds;
+    };
+
+    std::vector<Case> m_cases;
+    std::size_t m_numSpecGroups;
+    unsigned int m_numThreads;
+    unsigned int m_loadThreadsPerCase;
+    std::vector<std::string> m_keyword;
+    std::vector<time_point> m_reportDates;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ENSEMBLESUMMARY_HPP
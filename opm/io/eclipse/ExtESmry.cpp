@@ -23,6 +23,7 @@
 #include <opm/common/utility/shmatch.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ESmryColumns.hpp>
 
 #include <algorithm>
 #include <chrono>
@@ -31,6 +32,7 @@
 #include <fstream>
 #include <filesystem>
 #include <iterator>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -55,6 +57,50 @@ Opm::time_point make_date(const std::vector<int>& datetime) {
     return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
 }
 
+// Read elements [first, first + count) of binary INTE or REAL array whose
+// first data block starts at file offset data_start.  Binary arrays are
+// stored in blocks of at most 4000 bytes, each enclosed by record markers.
+template <typename T>
+std::vector<T> readBinaryRange(std::fstream& fileH, const uint64_t data_start,
+                               const int64_t first, const int64_t count)
+{
+    static_assert(Opm::EclIO::MaxBlockSizeInte == Opm::EclIO::MaxBlockSizeReal);
+    static_assert(sizeof(T) == 4);
+
+    const int64_t block_elements = Opm::EclIO::MaxBlockSizeReal / static_cast<int64_t>(sizeof(T));
+    const uint64_t block_size = Opm::EclIO::MaxBlockSizeReal + 2 * Opm::EclIO::sizeOfInte;
+
+    std::vector<T> values(count);
+
+    for (int64_t i = 0; i < count; ) {
+        const auto block = (first + i) / block_elements;
+        const auto elem = (first + i) % block_elements;
+        const auto num = std::min(count - i, block_elements - elem);
+
+        const auto pos = data_start + block * block_size
+            + Opm::EclIO::sizeOfInte + elem * sizeof(T);
+
+        fileH.seekg(static_cast<std::streamoff>(pos), std::ios_base::beg);
+        fileH.read(reinterpret_cast<char*>(values.data() + i), num * sizeof(T));
+
+        if (!fileH)
+            OPM_THROW(std::runtime_error, "Reading binary array range");
+
+        i += num;
+    }
+
+    Opm::EclIO::flipEndianArray(values.data(), values.size());
+
+    return values;
+}
+
+// File offsets are stored as pairs of 32 bit integers (high, low).
+uint64_t make_offset(const int high, const int low)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(high)) << 32)
+        | static_cast<uint64_t>(static_cast<uint32_t>(low));
+}
+
 
 }
 
@@ -109,13 +155,15 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
     ExtSmryHeadType ext_esmry_head;
 
     uint64_t rstep_offset;
+    std::optional<Chunked> chunked;
+    std::optional<Columns> columns;
 
-    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset, chunked, columns);
     int n_attempts = 1;
 
     while ((!res) && (n_attempts < 10)){
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset, chunked, columns);
         n_attempts ++;
     }
 
@@ -124,6 +172,8 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
     m_startdat = std::get<0>(ext_esmry_head);
     m_rstep_offset.push_back(rstep_offset);
+    m_chunked.push_back(chunked);
+    m_columns.push_back(columns);
 
     std::map<std::string, int> key_index;
 
@@ -167,10 +217,12 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
             m_esmry_files.push_back(rstESmryFile);
 
-            if (!open_esmry(rstESmryFile, ext_esmry_head, rstep_offset))
+            if (!open_esmry(rstESmryFile, ext_esmry_head, rstep_offset, chunked, columns))
                 OPM_THROW( std::runtime_error, "when opening ESMRY file" + rstESmryFile.string() );
 
             m_rstep_offset.push_back(rstep_offset);
+            m_chunked.push_back(chunked);
+            m_columns.push_back(columns);
 
             m_rstep_v.push_back(std::get<4>(ext_esmry_head));
             m_tstep_v.push_back(std::get<5>(ext_esmry_head));
@@ -257,7 +309,9 @@ bool ExtESmry::all_steps_available()
     return true;
 }
 
-bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset)
+bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head,
+                          uint64_t& rstep_offset, std::optional<Chunked>& chunked,
+                          std::optional<Columns>& columns)
 {
     std::fstream fileH;
 
@@ -355,6 +409,8 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
         OPM_THROW( std::runtime_error, "invalid ESMRY file " + inputFileName.string() + ". Size of UNITS not equal size of KEYCHECK");
 
     rstep_offset = static_cast<uint64_t>(fileH.tellg());
+    chunked.reset();
+    columns.reset();
 
     try {
         Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
@@ -363,6 +419,61 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
         return false;
     }
 
+    if (arrName == "CHUNKED ") {
+        std::vector<int> layout;
+
+        try {
+            layout = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+        } catch (const std::runtime_error& error)
+        {
+            return false;
+        }
+
+        if ((layout.size() != 2) or (layout[0] != 1))
+            OPM_THROW(std::invalid_argument, "Unsupported CHUNKED layout, invalid esmry file " + inputFileName.string() );
+
+        std::vector<int> rstep;
+        std::vector<int> tstep;
+
+        auto directoryFileName = inputFileName;
+        directoryFileName += ".dir";
+
+        if (!open_chunks(fileH, directoryFileName, keywords.size(), rstep, tstep, chunked))
+            return false;
+
+        ext_smry_head = std::make_tuple(startdat, rst_entry, keywords, units, rstep, tstep);
+
+        return true;
+    }
+
+    if (arrName == "COLUMNS ") {
+        std::vector<int> layout;
+
+        try {
+            layout = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+        } catch (const std::runtime_error& error)
+        {
+            return false;
+        }
+
+        if ((layout.size() != 4) or (layout[0] != ESmryColumns::version) or (layout[1] != ESmryColumns::codec) or
+            (layout[2] != static_cast<int>(keywords.size())) or (layout[3] < 0))
+            OPM_THROW(std::invalid_argument, "Unsupported COLUMNS layout, invalid esmry file " + inputFileName.string() );
+
+        std::vector<int> rstep;
+        std::vector<int> tstep;
+
+        if (!open_columns(fileH, keywords.size(), rstep, tstep, columns))
+            return false;
+
+        if (tstep.size() != static_cast<size_t>(layout[3]))
+            OPM_THROW(std::invalid_argument, "Size of TSTEP not matching COLUMNS, invalid esmry file " + inputFileName.string() );
+
+        ext_smry_head = std::make_tuple(startdat, rst_entry, keywords, units, rstep, tstep);
+
+        return true;
+    }
+
     if ((arrName != "RSTEP   ") or (arrType != Opm::EclIO::INTE))
         OPM_THROW(std::invalid_argument, "Reading RSTEP, invalid esmry file " + inputFileName.string() );
 
@@ -402,6 +513,200 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
 }
 
 
+bool ExtESmry::open_chunks(std::fstream& fileH, const std::filesystem::path& directoryFileName,
+                           const std::size_t num_vect, std::vector<int>& rstep, std::vector<int>& tstep,
+                           std::optional<Chunked>& chunked) const
+{
+    // While the run is in progress, the directory file identifies the
+    // complete chunks and holds the provisional tail.  It is replaced
+    // atomically and only ever refers to chunks which are already in the
+    // file.  Without a directory file the run has ended, and all chunks
+    // up to the end of the file are complete.
+
+    std::string arrName;
+    int64_t arr_size;
+    Opm::EclIO::eclArrType arrType;
+    int sizeOfElement;
+
+    Chunked result;
+
+    std::vector<int> repstep;
+    std::vector<int> tail_repstep;
+    std::vector<int> tail_tstep;
+
+    std::optional<std::vector<int>> directory;
+
+    try {
+        std::fstream dirH(directoryFileName, std::ios::in | std::ios::binary);
+
+        if (dirH) {
+            Opm::EclIO::readBinaryHeader(dirH, arrName, arr_size, arrType, sizeOfElement);
+
+            if ((arrName != "CHUNKDIR") or (arrType != Opm::EclIO::INTE) or (arr_size != 4))
+                return false;
+
+            directory = Opm::EclIO::readBinaryInteArray(dirH, arr_size);
+
+            dirH.peek();
+
+            if (!dirH.eof()) {
+                Opm::EclIO::readBinaryHeader(dirH, arrName, arr_size, arrType, sizeOfElement);
+
+                if ((arrName != "REPSTEP ") or (arrType != Opm::EclIO::INTE) or (arr_size < 1))
+                    return false;
+
+                tail_repstep = Opm::EclIO::readBinaryInteArray(dirH, arr_size);
+
+                Opm::EclIO::readBinaryHeader(dirH, arrName, arr_size, arrType, sizeOfElement);
+
+                if ((arrName != "TSTEP   ") or (arrType != Opm::EclIO::INTE) or
+                    (arr_size != static_cast<int64_t>(tail_repstep.size())))
+                    return false;
+
+                tail_tstep = Opm::EclIO::readBinaryInteArray(dirH, arr_size);
+
+                Opm::EclIO::readBinaryHeader(dirH, arrName, arr_size, arrType, sizeOfElement);
+
+                if ((arrName != "VALUES  ") or (arrType != Opm::EclIO::REAL) or
+                    (arr_size != static_cast<int64_t>(num_vect * tail_tstep.size())))
+                    return false;
+
+                result.tail_values = Opm::EclIO::readBinaryRealArray(dirH, arr_size);
+                result.tail_tstep = static_cast<int>(tail_tstep.size());
+            }
+        }
+
+        const auto data_start = static_cast<uint64_t>(fileH.tellg());
+
+        fileH.seekg(0, std::ios_base::end);
+        const auto file_size = static_cast<uint64_t>(fileH.tellg());
+
+        const auto sealed_end = directory.has_value()
+            ? make_offset((*directory)[0], (*directory)[1]) : file_size;
+
+        if ((sealed_end < data_start) or (sealed_end > file_size))
+            return false;
+
+        auto offset = data_start;
+
+        while (offset < sealed_end) {
+            fileH.seekg(static_cast<std::streamoff>(offset), std::ios_base::beg);
+            Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+            if ((arrName != "CHUNK   ") or (arrType != Opm::EclIO::INTE) or (arr_size != 1))
+                return false;
+
+            const auto nstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size)[0];
+
+            Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+            if ((arrName != "REPSTEP ") or (arrType != Opm::EclIO::INTE) or (arr_size != nstep))
+                return false;
+
+            const auto chunk_repstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+            repstep.insert(repstep.end(), chunk_repstep.begin(), chunk_repstep.end());
+
+            Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+            if ((arrName != "TSTEP   ") or (arrType != Opm::EclIO::INTE) or (arr_size != nstep))
+                return false;
+
+            const auto chunk_tstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+            tstep.insert(tstep.end(), chunk_tstep.begin(), chunk_tstep.end());
+
+            const auto values_offset = static_cast<uint64_t>(fileH.tellg());
+
+            Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+            if ((arrName != "VALUES  ") or (arrType != Opm::EclIO::REAL) or
+                (arr_size != static_cast<int64_t>(num_vect) * nstep))
+                return false;
+
+            offset = values_offset + 24 + sizeOnDiskBinary(arr_size, Opm::EclIO::REAL, sizeOfReal);
+
+            // a chunk extending beyond the end is still being written
+            if (offset > sealed_end)
+                return false;
+
+            result.chunks.push_back({ values_offset, nstep });
+        }
+
+    } catch (const std::runtime_error& error)
+    {
+        return false;
+    }
+
+    if (directory.has_value()) {
+        if ((static_cast<int>(result.chunks.size()) != (*directory)[2]) or
+            (static_cast<int>(tstep.size()) + result.tail_tstep != (*directory)[3]))
+            return false;
+
+    } else if (result.chunks.empty()) {
+        // header written, but neither chunk nor directory yet
+        return false;
+    }
+
+    repstep.insert(repstep.end(), tail_repstep.begin(), tail_repstep.end());
+    tstep.insert(tstep.end(), tail_tstep.begin(), tail_tstep.end());
+
+    if (tstep.empty())
+        return false;
+
+    // RSTEP is the report step number for the last time step of each
+    // report step and zero otherwise.
+
+    rstep.resize(repstep.size());
+
+    for (size_t n = 0; n < repstep.size(); n++)
+        rstep[n] = ((n + 1 < repstep.size()) && (repstep[n + 1] == repstep[n])) ? 0 : repstep[n];
+
+    chunked = std::move(result);
+
+    return true;
+}
+
+bool ExtESmry::open_columns(std::fstream& fileH, const std::size_t num_vect, std::vector<int>& rstep,
+                            std::vector<int>& tstep, std::optional<Columns>& columns) const
+{
+    // Compressed column files are written in full before being read, so
+    // any inconsistency means the file is being replaced.
+
+    std::string arrName;
+    int64_t arr_size;
+    Opm::EclIO::eclArrType arrType;
+    int sizeOfElement;
+
+    try {
+        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if ((arrName != "RSTEP   ") or (arrType != Opm::EclIO::INTE))
+            return false;
+
+        rstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+
+        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if ((arrName != "TSTEP   ") or (arrType != Opm::EclIO::INTE) or (arr_size != static_cast<int64_t>(rstep.size())))
+            return false;
+
+        tstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+
+        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if ((arrName != "VECTDIR ") or (arrType != Opm::EclIO::INTE) or
+            (arr_size != static_cast<int64_t>(ESmryColumns::dir_entry_size * num_vect)))
+            return false;
+
+    } catch (const std::runtime_error& error)
+    {
+        return false;
+    }
+
+    columns = Columns { static_cast<uint64_t>(fileH.tellg()), tstep.size() };
+
+    return true;
+}
+
 void ExtESmry::updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN) {
 
     if (rootN.parent_path().is_absolute()){
@@ -417,6 +722,12 @@ void ExtESmry::updatePathAndRootName(std::filesystem::path& dir, std::filesystem
 bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind )
 {
+    if (m_chunked[ind].has_value())
+        return load_chunked_esmry(stringVect, keyIndexVect, loadKeyIndex, ind, to_ind);
+
+    if (m_columns[ind].has_value())
+        return load_columns_esmry(stringVect, keyIndexVect, loadKeyIndex, ind, to_ind);
+
     std::fstream fileH;
 
     fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
@@ -504,6 +815,158 @@ bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std:
 }
 
 
+bool ExtESmry::load_chunked_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
+                                  const std::vector<int>& loadKeyIndex, int ind, int to_ind )
+{
+    std::fstream fileH;
+
+    fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
+
+    if (!fileH)
+        return false;
+
+    std::string arrName;
+    Opm::EclIO::eclArrType arrType;
+    int64_t arr_size;
+    int sizeOfElement;
+
+    const auto nvect = static_cast<int64_t>(m_keyword_index[ind].size());
+
+    std::vector<std::vector<float>> smry_data;
+    smry_data.resize(loadKeyIndex.size(), {});
+
+    // Chunks are never modified once written, so the chunks identified
+    // when the file was opened remain valid even if the run has since
+    // appended more chunks.  The provisional tail was read along with
+    // the directory when the file was opened.
+
+    const auto& chunked = *m_chunked[ind];
+
+    int num_loaded = 0;
+
+    for (const auto& chunk : chunked.chunks) {
+
+        if (num_loaded > to_ind)
+            break;
+
+        fileH.seekg(static_cast<std::streamoff>(chunk.values_offset), fileH.beg);
+
+        try {
+            readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+        } catch (const std::runtime_error& error)
+        {
+            return false;
+        }
+
+        if ((arrName != "VALUES  ") or (arrType != Opm::EclIO::REAL) or (arr_size != nvect * chunk.num_tstep))
+            return false;
+
+        const uint64_t data_start = chunk.values_offset + 24;
+
+        for (size_t n = 0 ; n < loadKeyIndex.size(); n++) {
+
+            const auto& key = stringVect[loadKeyIndex[n]];
+            const auto key_pos = m_keyword_index[ind].find(key);
+
+            if (key_pos == m_keyword_index[ind].end()) {
+
+                smry_data[n].resize(smry_data[n].size() + chunk.num_tstep, 0.0);
+
+            } else {
+
+                const auto first = static_cast<int64_t>(key_pos->second) * chunk.num_tstep;
+
+                try {
+                    const auto values = readBinaryRange<float>(fileH, data_start, first, chunk.num_tstep);
+                    smry_data[n].insert(smry_data[n].end(), values.begin(), values.end());
+                } catch (const std::runtime_error& error)
+                {
+                    return false;
+                }
+            }
+        }
+
+        num_loaded += chunk.num_tstep;
+    }
+
+    fileH.close();
+
+    if ((num_loaded <= to_ind) && (chunked.tail_tstep > 0)) {
+        const auto ntail = static_cast<size_t>(chunked.tail_tstep);
+
+        for (size_t n = 0 ; n < loadKeyIndex.size(); n++) {
+
+            const auto& key = stringVect[loadKeyIndex[n]];
+            const auto key_pos = m_keyword_index[ind].find(key);
+
+            if (key_pos == m_keyword_index[ind].end()) {
+                smry_data[n].resize(smry_data[n].size() + ntail, 0.0);
+            } else {
+                const auto first = chunked.tail_values.begin() + key_pos->second * ntail;
+                smry_data[n].insert(smry_data[n].end(), first, first + ntail);
+            }
+        }
+    }
+
+    for (size_t n = 0 ; n < loadKeyIndex.size(); n++)
+        m_vectorData[keyIndexVect[n]].insert(m_vectorData[keyIndexVect[n]].end(), smry_data[n].begin(), smry_data[n].begin() + to_ind + 1);
+
+    return true;
+}
+
+bool ExtESmry::load_columns_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
+                                  const std::vector<int>& loadKeyIndex, int ind, int to_ind )
+{
+    std::fstream fileH;
+
+    fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
+
+    if (!fileH)
+        return false;
+
+    const auto& columns = *m_columns[ind];
+
+    std::vector<std::vector<float>> smry_data;
+    smry_data.resize(loadKeyIndex.size(), {});
+
+    // Only the directory entry and the compressed block of each requested
+    // vector are read.
+
+    for (size_t n = 0 ; n < loadKeyIndex.size(); n++) {
+
+        const auto& key = stringVect[loadKeyIndex[n]];
+        const auto key_pos = m_keyword_index[ind].find(key);
+
+        if (key_pos == m_keyword_index[ind].end()) {
+
+            smry_data[n].resize(to_ind + 1, 0.0);
+
+        } else {
+
+            const int key_ind = key_pos->second;
+
+            try {
+                const auto entry = readBinaryRange<int>(fileH, columns.dir_offset,
+                                                        static_cast<int64_t>(key_ind) * ESmryColumns::dir_entry_size,
+                                                        ESmryColumns::dir_entry_size);
+
+                smry_data[n] = readESmryColumn(fileH, make_offset(entry[0], entry[1]), key_ind,
+                                               static_cast<uint32_t>(entry[2]), columns.num_tstep);
+            } catch (const std::runtime_error& error)
+            {
+                return false;
+            }
+        }
+    }
+
+    fileH.close();
+
+    for (size_t n = 0 ; n < loadKeyIndex.size(); n++)
+        m_vectorData[keyIndexVect[n]].insert(m_vectorData[keyIndexVect[n]].end(), smry_data[n].begin(), smry_data[n].begin() + to_ind + 1);
+
+    return true;
+}
+
 void ExtESmry::loadData(const std::vector<std::string>& stringVect)
 {
     auto start = std::chrono::system_clock::now();
@@ -592,6 +1055,23 @@ std::vector<Opm::time_point> ExtESmry::dates()
     return d;
 }
 
+std::vector<Opm::time_point> ExtESmry::dates_at_rstep()
+{
+    const auto full_vect = this->dates();
+
+    std::vector<Opm::time_point> rs_vect;
+    rs_vect.reserve(m_seqIndex.size());
+
+    std::transform(m_seqIndex.begin(), m_seqIndex.end(),
+                   std::back_inserter(rs_vect),
+                   [&full_vect](const auto& r)
+                   {
+                       return full_vect[r];
+                   });
+
+    return rs_vect;
+}
+
 std::vector<std::string> ExtESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
@@ -21,11 +21,13 @@
 
 #include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <map>
+#include <optional>
 #include <stdint.h>
 
 #include <opm/common/utility/TimeService.hpp>
@@ -44,7 +46,9 @@ class ExtESmry
 {
 public:
 
-    // input is esmry, only binary supported.
+    // input is esmry, only binary supported.  Reads files with any of the
+    // original layout (one array per vector), the chunked layout written
+    // by ExtSmryOutput, and the compressed column layout (ESmryColumns.hpp).
     explicit ExtESmry(const std::string& filename, bool loadBaseRunData=false);
 
     const std::vector<float>& get(const std::string& name);
@@ -66,6 +70,7 @@ public:
     std::vector<std::string> keywordList(const std::string& pattern) const;
 
     std::vector<time_point> dates();
+    std::vector<time_point> dates_at_rstep();
 
     bool all_steps_available();
     std::string rootname() { return m_inputFileName.stem().generic_string(); }
@@ -95,17 +100,74 @@ private:
 
     std::vector<uint64_t> m_rstep_offset;
 
+    // Chunk of time steps in file with chunked layout.
+    struct Chunk
+    {
+        // File offset of chunk's VALUES array.
+        uint64_t values_offset;
+
+        // Number of time steps in chunk.
+        int num_tstep;
+    };
+
+    // Time steps of file with chunked layout.
+    struct Chunked
+    {
+        // Complete chunks in file.
+        std::vector<Chunk> chunks;
+
+        // Number of time steps in provisional tail, i.e., time steps of a
+        // run in progress which are not yet written to a chunk.
+        int tail_tstep{0};
+
+        // Values of provisional tail, one vector after the other.  Read
+        // from the directory file when the file is opened.
+        std::vector<float> tail_values;
+    };
+
+    // Chunks of each file.  Nullopt unless file has chunked layout.
+    std::vector<std::optional<Chunked>> m_chunked;
+
+    // Vector directory of file with compressed column layout.
+    struct Columns
+    {
+        // File offset of VECTDIR array's data.
+        uint64_t dir_offset;
+
+        // Number of time steps of each vector.
+        size_t num_tstep;
+    };
+
+    // Vector directory of each file.  Nullopt unless file has compressed
+    // column layout.
+    std::vector<std::optional<Columns>> m_columns;
+
     time_point m_startdat;
     std::vector<int> m_start_vect;
 
     double m_io_opening;
     double m_io_loading;
 
-    bool open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset);
+    bool open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head,
+                    uint64_t& rstep_offset, std::optional<Chunked>& chunked,
+                    std::optional<Columns>& columns);
+
+    bool open_columns(std::fstream& fileH, std::size_t num_vect, std::vector<int>& rstep,
+                      std::vector<int>& tstep, std::optional<Columns>& columns) const;
+
+    bool open_chunks(std::fstream& fileH, const std::filesystem::path& directoryFileName,
+                     std::size_t num_vect, std::vector<int>& rstep, std::vector<int>& tstep,
+                     std::optional<Chunked>& chunked) const;
 
     bool load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind );
 
+    bool load_chunked_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
+                            const std::vector<int>& loadKeyIndex, int ind, int to_ind );
+
+    bool load_columns_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
+                            const std::vector<int>& loadKeyIndex, int ind, int to_ind );
+
     void updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN);
 };
 
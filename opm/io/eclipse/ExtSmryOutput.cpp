@@ -20,21 +20,34 @@
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/ExtSmryOutput.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ESmryColumns.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <filesystem>
 
+namespace {
+
+// Maximum number of values held in memory when converting the chunked
+// file to compressed column layout.
+constexpr std::size_t max_batch_values = std::size_t{1} << 22;
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
 
 ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const std::vector<std::string>& valueUnits,
-                 const EclipseState& es, const time_t start_time)
+                 const EclipseState& es, const time_t start_time, const bool compressed)
+    : m_compressed(compressed)
 {
     m_nVect = valueKeys.size();
     m_nTimeSteps = 0;
@@ -57,6 +70,7 @@ ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const st
     auto dims = es.gridDims();
 
     m_outputFileName = ioconf.getOutputDir() + "/" + ioconf.getBaseName() + ".ESMRY";
+    m_directoryFileName = m_outputFileName + ".dir";
 
     m_smry_keys = this->make_modified_keys(valueKeys, dims);
     m_smryUnits = valueUnits;
@@ -68,8 +82,10 @@ ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const st
     m_start_date_vect = {ts.day(), ts.month(), ts.year(),
         ts.hour(), ts.minutes(), ts.seconds(), 0 };
 
-    for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++)
-        m_smrydata.push_back({});
+    m_smrydata.resize(m_nVect);
+
+    for (auto& vect : m_smrydata)
+        vect.reserve(max_chunk_size);
 }
 
 
@@ -82,79 +98,213 @@ void ExtSmryOutput::write(const std::vector<float>& ts_data, int report_step, bo
     auto current = std::chrono::system_clock::now();
     std::chrono::duration<double> elapsed_seconds = current - m_last_write;
 
-    if ((m_rstep.size() > 0) && (m_rstep.back() == report_step))
-        m_rstep.back() = 0;
-
-    m_rstep.push_back(report_step);
-
     // flow is yet not supporting rptonly in summary
     // tstep = {0,1,2 .. , m_nTimeSteps-1}
 
-    if (m_tstep.size()==0)
-        m_tstep.push_back(0);
-    else
-        m_tstep.push_back(m_tstep.back()+1);
+    m_repstep.push_back(report_step);
+    m_tstep.push_back(m_nTimeSteps);
+
+    if (m_compressed)
+        m_all_repstep.push_back(report_step);
 
     for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++)
         m_smrydata[n].push_back(ts_data[n]);
 
-    if ((is_final_summary) || (elapsed_seconds.count() > m_min_write_interval))
+    m_nTimeSteps++;
+
+    const bool chunk_full = m_tstep.size() >= static_cast<size_t>(max_chunk_size);
+
+    if ((is_final_summary) || (chunk_full) || (elapsed_seconds.count() > m_min_write_interval))
     {
-        const auto tp = std::chrono::system_clock::now();
-        auto sec_since_epoch = std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+        if (! m_sealed_end.has_value())
+            this->write_header();
 
-        std::filesystem::path esmry_file(m_outputFileName);
-        std::filesystem::path rootName = esmry_file.parent_path() / esmry_file.stem();           
+        // Only complete chunks, and the final one, are appended to the
+        // file.  Time steps of a partial chunk are published through the
+        // directory file.
 
-        std::string tmp_file_name = rootName.string() + "_TMP_" + std::to_string(sec_since_epoch) + ".ESMRY";
-        
-        {
-            Opm::EclIO::EclOutput outFile(tmp_file_name, m_fmt, std::ios::out);
+        if (is_final_summary || chunk_full)
+            this->write_chunk();
 
-            outFile.write<int>("START", m_start_date_vect);
+        if (is_final_summary) {
+            // The directory describes the chunked layout, so it must be
+            // gone before the column layout replaces the file.
+            std::filesystem::remove(m_directoryFileName);
 
-            if (m_restart_rootn.size() > 0) {
-                outFile.write<std::string>("RESTART", {m_restart_rootn});
-                outFile.write<int>("RSTNUM", {m_restart_step});
-            }
+            if (m_compressed)
+                this->write_columns();
+        } else {
+            this->write_directory();
+        }
 
-            outFile.write("KEYCHECK", m_smry_keys);
-            outFile.write("UNITS", m_smryUnits);
+        m_last_write = std::chrono::system_clock::now();
+    }
+}
 
-            outFile.write<int>("RSTEP", m_rstep);
-            outFile.write<int>("TSTEP", m_tstep);
+void ExtSmryOutput::write_header()
+{
+    // A directory left behind by an earlier run does not describe the new
+    // file.
+    std::filesystem::remove(m_directoryFileName);
 
-            for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++ ) {
-                std::string vect_name="V" + std::to_string(n);
-                outFile.write<float>(vect_name, m_smrydata[n]);
-            }
-        }
+    {
+        Opm::EclIO::EclOutput outFile(m_outputFileName, m_fmt, std::ios::out);
 
-        if (rename_tmpfile(tmp_file_name)){
-            m_last_write = std::chrono::system_clock::now();
-        } else {
-            Opm::OpmLog::warning("Not able to rename temporary ESMRY file " + tmp_file_name);
-            std::filesystem::path tmp_file(tmp_file_name);        
-            std::filesystem::remove(tmp_file);
+        outFile.write<int>("START", m_start_date_vect);
+
+        if (m_restart_rootn.size() > 0) {
+            outFile.write<std::string>("RESTART", {m_restart_rootn});
+            outFile.write<int>("RSTNUM", {m_restart_step});
         }
+
+        outFile.write("KEYCHECK", m_smry_keys);
+        outFile.write("UNITS", m_smryUnits);
+
+        // layout version and maximum number of time steps per chunk
+        outFile.write<int>("CHUNKED", {1, max_chunk_size});
     }
 
-    m_nTimeSteps++;
+    m_sealed_end = static_cast<std::uint64_t>(std::filesystem::file_size(m_outputFileName));
 }
 
-bool ExtSmryOutput::rename_tmpfile(const std::string& tmp_fname)
+void ExtSmryOutput::write_chunk()
 {
-    try {
-        std::filesystem::path from_file(tmp_fname);
-        std::filesystem::path to_file(m_outputFileName);
-        std::filesystem::rename(from_file, to_file);
-    } catch (...){
-        return false;
+    const auto nstep = static_cast<int>(m_tstep.size());
+
+    std::vector<float> values;
+    values.reserve(static_cast<size_t>(m_nVect) * nstep);
+
+    for (auto& vect : m_smrydata) {
+        values.insert(values.end(), vect.begin(), vect.end());
+        vect.clear();
+    }
+
+    {
+        Opm::EclIO::EclOutput outFile(m_outputFileName, m_fmt, std::ios::app);
+
+        outFile.write<int>("CHUNK", {nstep});
+        outFile.write<int>("REPSTEP", m_repstep);
+        outFile.write<int>("TSTEP", m_tstep);
+        outFile.write<float>("VALUES", values);
     }
 
-    return true;
+    m_sealed_end = static_cast<std::uint64_t>(std::filesystem::file_size(m_outputFileName));
+    m_num_chunks++;
+
+    m_repstep.clear();
+    m_tstep.clear();
 }
 
+void ExtSmryOutput::write_directory()
+{
+    // The file offset is stored as a pair of 32 bit integers (high, low).
+
+    const auto sealed_end = m_sealed_end.value();
+
+    const std::vector<int> directory {
+        static_cast<int>(static_cast<std::uint32_t>(sealed_end >> 32)),
+        static_cast<int>(static_cast<std::uint32_t>(sealed_end & 0xFFFFFFFFu)),
+        m_num_chunks, m_nTimeSteps
+    };
+
+    // Replace the directory only once the new one is complete.
+
+    const auto tmpFileName = m_directoryFileName + ".tmp";
+
+    {
+        Opm::EclIO::EclOutput outFile(tmpFileName, m_fmt, std::ios::out);
+
+        outFile.write<int>("CHUNKDIR", directory);
+
+        if (! m_tstep.empty()) {
+            std::vector<float> values;
+            values.reserve(static_cast<size_t>(m_nVect) * m_tstep.size());
+
+            for (const auto& vect : m_smrydata)
+                values.insert(values.end(), vect.begin(), vect.end());
+
+            outFile.write<int>("REPSTEP", m_repstep);
+            outFile.write<int>("TSTEP", m_tstep);
+            outFile.write<float>("VALUES", values);
+        }
+    }
+
+    std::filesystem::rename(tmpFileName, m_directoryFileName);
+}
+
+void ExtSmryOutput::write_columns()
+{
+    // RSTEP is the report step number for the last time step of each
+    // report step and zero otherwise.
+
+    std::vector<int> rstep(m_all_repstep.size());
+    std::vector<int> tstep(m_all_repstep.size());
+
+    for (size_t n = 0; n < m_all_repstep.size(); n++) {
+        rstep[n] = ((n + 1 < m_all_repstep.size()) && (m_all_repstep[n + 1] == m_all_repstep[n]))
+            ? 0 : m_all_repstep[n];
+        tstep[n] = static_cast<int>(n);
+    }
+
+    // Replace the chunked file only once the new file is complete.
+
+    const auto tmpFileName = m_outputFileName + ".tmp";
+
+    {
+        Opm::EclIO::EclFile chunked(m_outputFileName);
+        ESmryColumnsWriter columns(tmpFileName, m_start_date_vect, m_restart_rootn, m_restart_step,
+                                   m_smry_keys, m_smryUnits, rstep, tstep);
+
+        // Each chunk's VALUES array holds the chunk's time steps of one
+        // vector after the other, so a batch of consecutive vectors is a
+        // contiguous range of each chunk.
+
+        std::vector<int> values_index;
+        std::vector<size_t> chunk_size;
+
+        const auto arrays = chunked.getList();
+
+        for (size_t i = 0; i < arrays.size(); i++) {
+            if (std::get<0>(arrays[i]) != "VALUES")
+                continue;
+
+            values_index.push_back(static_cast<int>(i));
+            chunk_size.push_back(static_cast<size_t>(std::get<2>(arrays[i])) / m_nVect);
+        }
+
+        const auto nvect = static_cast<size_t>(m_nVect);
+        const auto batch_size = std::max<size_t>(1, max_batch_values / std::max(m_nTimeSteps, 1));
+
+        std::vector<std::vector<float>> batch;
+
+        for (size_t first = 0; first < nvect; first += batch_size) {
+            const auto count = std::min(batch_size, nvect - first);
+
+            batch.resize(count);
+
+            for (auto& vect : batch) {
+                vect.clear();
+                vect.reserve(m_nTimeSteps);
+            }
+
+            for (size_t c = 0; c < values_index.size(); c++) {
+                const auto nstep = chunk_size[c];
+                const auto values = chunked.getRange<float>(values_index[c], first * nstep, count * nstep);
+
+                for (size_t n = 0; n < count; n++)
+                    batch[n].insert(batch[n].end(), values.begin() + n * nstep,
+                                    values.begin() + (n + 1) * nstep);
+            }
+
+            for (const auto& vect : batch)
+                columns.append(vect);
+        }
+
+        columns.finish();
+    }
+
+    std::filesystem::rename(tmpFileName, m_outputFileName);
+}
 
 std::vector<std::string> ExtSmryOutput::make_modified_keys(const std::vector<std::string>& valueKeys, const GridDims& dims)
 {
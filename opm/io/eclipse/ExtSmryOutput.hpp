@@ -21,6 +21,8 @@
 
 #include <array>
 #include <chrono>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -31,41 +33,101 @@ class GridDims;
 
 namespace EclIO {
 
+/// Writer of "transposed" summary files (.ESMRY).
+///
+/// Values are written in chunks of max_chunk_size consecutive time steps,
+/// each of which is appended to the file once it is full.  The file
+/// consists of
+///
+///   START, [RESTART, RSTNUM], KEYCHECK, UNITS, CHUNKED
+///
+/// followed by one record per chunk
+///
+///   CHUNK, REPSTEP, TSTEP, VALUES
+///
+/// CHUNK holds the number of time steps in the chunk, REPSTEP the report
+/// step of each time step, and VALUES the chunk's values of all summary
+/// vectors, one vector after the other.  Only the final chunk, written
+/// with the final summary, may hold fewer than max_chunk_size time steps.
+/// A chunk is never modified once written.
+///
+/// While the run is in progress, the time steps of the current, partial
+/// chunk are published in a separate directory file (.ESMRY.dir) at most
+/// every 15 seconds and whenever a chunk is appended.
+/// The directory file holds
+///
+///   CHUNKDIR, [REPSTEP, TSTEP, VALUES]
+///
+/// where CHUNKDIR holds the file offset of the end of the last complete
+/// chunk, the number of complete chunks and the total number of time
+/// steps, and the optional arrays hold the provisional tail, i.e., the
+/// time steps not yet written to a chunk, in the same layout as a chunk.
+/// The directory file is replaced atomically, so a reader sees either the
+/// previous or the current state of the run.  It is removed once the
+/// final chunk is written.  The writer keeps at most one chunk of values
+/// in memory.
+///
+/// If requested, the chunked file is replaced by a file in compressed
+/// column layout (ESmryColumns.hpp) once the final summary is written.
+/// The conversion reads a batch of vectors at a time from all chunks, so
+/// it holds at most a few million values in memory.
 class ExtSmryOutput
 {
 public:
     ExtSmryOutput(const std::vector<std::string>& valueKeys,
                   const std::vector<std::string>& valueUnits,
                   const EclipseState& es,
-                  const time_t start_time);
+                  const time_t start_time,
+                  const bool compressed = false);
 
     void write(const std::vector<float>& ts_data,
                int report_step,
                bool is_final_summary);
 
+    /// Maximum number of time steps in a single chunk.
+    static constexpr int max_chunk_size = 64;
+
 private:
     static constexpr int m_min_write_interval = 15;  // at least 15 seconds between each write
     std::chrono::time_point<std::chrono::system_clock> m_last_write;
 
     std::string m_outputFileName;
+    std::string m_directoryFileName;
     int m_nTimeSteps;
     int m_nVect;
     bool m_fmt;
+    bool m_compressed;
 
     std::vector<int> m_start_date_vect;
     std::string m_restart_rootn;
     int m_restart_step;
     std::vector<std::string> m_smry_keys;
     std::vector<std::string> m_smryUnits;
-    std::vector<int> m_rstep;
+
+    // Time steps of current, unwritten, chunk.
+    std::vector<int> m_repstep;
     std::vector<int> m_tstep;
     std::vector<std::vector<float>> m_smrydata;
 
+    // Report step of all time steps.  Only maintained when the file is
+    // converted to compressed column layout at the end of the run.
+    std::vector<int> m_all_repstep;
+
+    // File offset of end of last complete chunk.  Nullopt before the
+    // file header is written.
+    std::optional<std::uint64_t> m_sealed_end;
+
+    // Number of complete chunks in file.
+    int m_num_chunks{0};
+
     std::array<int, 3> ijk_from_global_index(const GridDims& dims,
                                              int globInd) const;
     std::vector<std::string> make_modified_keys(const std::vector<std::string>& valueKeys,
                                                 const GridDims& dims);
-    bool rename_tmpfile(const std::string& tmp_fname);
+    void write_header();
+    void write_chunk();
+    void write_directory();
+    void write_columns();
 };
 
 
@@ -36,6 +36,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -301,41 +302,63 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Restart::
-Restart(const ResultSet& rset,
-        const int        seqnum,
-        const Formatted& fmt,
-        const Unified&   unif)
+Restart(const ResultSet&  rset,
+        const int         seqnum,
+        const Formatted&  fmt,
+        const Unified&    unif,
+        const WriteIndex& index)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
 
     const auto fname = outputFileName(rset, ext);
+    const auto writeIndex = index.set && !fmt.set;
+
+    if (writeIndex) {
+        this->fname_ = fname;
+    }
 
     if (unif.set) {
         // Run uses unified restart files.
-        this->openUnified(fname, fmt.set, seqnum);
+        this->openUnified(fname, fmt.set, seqnum, writeIndex);
 
         // Write SEQNUM value to stream to start new output sequence.
         this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
+
+        if (writeIndex) {
+            this->stream_->arrayIndex->back().seqnum = seqnum;
+        }
     }
     else {
         // Run uses separate, not unified, restart files.  Create a
         // new output file and open an output stream on it.
         this->openNew(fname, fmt.set);
+
+        if (writeIndex) {
+            this->stream_->arrayIndex.emplace();
+        }
     }
 }
 
 Opm::EclIO::OutputStream::Restart::~Restart()
-{}
+{
+    this->finishIndex();
+}
 
 Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
-    : stream_{ std::move(rhs.stream_) }
+    : stream_   { std::move(rhs.stream_) }
+    , fname_    { std::move(rhs.fname_) }
+    , indexBase_{ rhs.indexBase_ }
 {}
 
 Opm::EclIO::OutputStream::Restart&
 Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
 {
-    this->stream_ = std::move(rhs.stream_);
+    this->finishIndex();
+
+    this->stream_    = std::move(rhs.stream_);
+    this->fname_     = std::move(rhs.fname_);
+    this->indexBase_ = rhs.indexBase_;
 
     return *this;
 }
@@ -392,13 +415,20 @@ void
 Opm::EclIO::OutputStream::Restart::
 openUnified(const std::string& fname,
             const bool         formatted,
-            const int          seqnum)
+            const int          seqnum,
+            const bool         writeIndex)
 {
     // Determine if we're creating a new output/restart file or
     // if we're opening an existing one, possibly at a specific
     // write position.
     auto rst = Open::Restart::read(fname);
 
+    // If the existing index describes the file, only the new report
+    // step's entries need be written.  Must be checked before the file is
+    // modified.
+    const auto appendIndex = writeIndex && (rst != nullptr)
+        && arrayIndexFileCurrent(fname);
+
     if (rst == nullptr) {
         // No such unified restart file exists.  Create new file.
         this->openNew(fname, formatted);
@@ -419,6 +449,85 @@ openUnified(const std::string& fname,
         this->openExisting(fname, formatted,
                            rst->restartStepWritePosition(seqnum));
     }
+
+    if (appendIndex) {
+        this->indexBase_ = this->numExistingArrays(*rst, seqnum);
+        this->stream_->arrayIndex.emplace();
+    }
+    else if (writeIndex) {
+        this->stream_->arrayIndex = (rst == nullptr)
+            ? std::vector<ArrayIndexEntry>{}
+            : this->existingIndex(*rst, seqnum);
+    }
+}
+
+std::vector<Opm::EclIO::ArrayIndexEntry>
+Opm::EclIO::OutputStream::Restart::
+existingIndex(const ERst& rst, const int seqnum) const
+{
+    const auto numArrays = this->numExistingArrays(rst, seqnum);
+
+    auto entries = std::vector<ArrayIndexEntry>(numArrays);
+
+    auto seqnumValue = rst.seqnum.begin();
+    for (std::size_t i = 0; i < numArrays; ++i) {
+        auto& entry = entries[i];
+
+        entry.name = rst.array_name[i];
+        entry.type = rst.array_type[i];
+        entry.size = rst.array_size[i];
+        entry.elementSize = rst.array_element_size[i];
+        entry.dataPos = rst.ifStreamPos[i];
+
+        if ((entry.name == "SEQNUM") && (seqnumValue != rst.seqnum.end())) {
+            entry.seqnum = *seqnumValue++;
+        }
+    }
+
+    return entries;
+}
+
+std::size_t
+Opm::EclIO::OutputStream::Restart::
+numExistingArrays(const ERst& rst, const int seqnum) const
+{
+    // Arrays from the start of report step 'seqnum' onwards are discarded
+    // by openExisting().
+    const auto next = rst.arrIndexRange.lower_bound(seqnum);
+
+    return (next == rst.arrIndexRange.end())
+        ? rst.array_name.size()
+        : static_cast<std::size_t>(next->second.first);
+}
+
+void Opm::EclIO::OutputStream::Restart::finishIndex()
+{
+    if ((this->stream_ == nullptr) || ! this->stream_->arrayIndex.has_value()) {
+        return;
+    }
+
+    const auto entries = std::move(*this->stream_->arrayIndex);
+
+    // Close the restart file first, since the index records the file's
+    // final size and modification time.
+    this->stream_.reset();
+
+    try {
+        if (this->indexBase_.has_value()) {
+            appendArrayIndexFile(this->fname_, *this->indexBase_, entries);
+        }
+        else {
+            writeArrayIndexFile(this->fname_, entries);
+        }
+    }
+    catch (const std::exception& e) {
+        // The index is optional.  Make sure readers don't see a stale one.
+        auto ec = std::error_code{};
+        std::filesystem::remove(arrayIndexFileName(this->fname_), ec);
+
+        Opm::OpmLog::warning("Unable to write restart index file for "
+                             + this->fname_ + ": " + e.what());
+    }
 }
 
 void
@@ -20,6 +20,7 @@
 #ifndef OPM_IO_OUTPUTSTREAM_HPP_INCLUDED
 #define OPM_IO_OUTPUTSTREAM_HPP_INCLUDED
 
+#include <opm/io/eclipse/ArrayIndexFile.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
@@ -27,12 +28,14 @@
 #include <chrono>
 #include <ios>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace Opm { namespace EclIO {
 
     class EclOutput;
+    class ERst;
 
 }} // namespace Opm::EclIO
 
@@ -148,6 +151,8 @@ namespace Opm { namespace EclIO { namespace OutputStream {
     class Restart
     {
     public:
+        struct WriteIndex { bool set; };
+
         /// Constructor.
         ///
         /// Opens file stream pertaining to restart of particular report
@@ -165,11 +170,22 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] unif Whether or not to create unified output files.
-        explicit Restart(const ResultSet& rset,
-                         const int        seqnum,
-                         const Formatted& fmt,
-                         const Unified&   unif);
-
+        ///
+        /// \param[in] index Whether or not to maintain a sidecar index
+        ///    file (e.g., CASE.UNRST.idx) of the array headers in the
+        ///    restart file.  The index lets readers open large unified
+        ///    restart files without scanning every array header.  Ignored
+        ///    for formatted output files.
+        explicit Restart(const ResultSet&  rset,
+                         const int         seqnum,
+                         const Formatted&  fmt,
+                         const Unified&    unif,
+                         const WriteIndex& index = WriteIndex{false});
+
+        /// Destructor.
+        ///
+        /// Closes the output stream and, if requested, writes the index
+        /// file describing the restart file's complete contents.
         ~Restart();
 
         Restart(const Restart& rhs) = delete;
@@ -239,6 +255,15 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Name of restart file.  Needed to write the index file.
+        std::string fname_{};
+
+        /// Number of entries of an existing, current, index file which
+        /// precede the report step being written.  Only the new step's
+        /// entries are then written to the index file.  Nullopt if the
+        /// index file is written from scratch.
+        std::optional<std::size_t> indexBase_{};
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
@@ -251,9 +276,25 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] seqnum Sequence number of new report.  One-based
         ///    report step ID.
+        ///
+        /// \param[in] writeIndex Whether or not to record array headers
+        ///    for the index file.
         void openUnified(const std::string& fname,
                          const bool         formatted,
-                         const int          seqnum);
+                         const int          seqnum,
+                         const bool         writeIndex);
+
+        /// Array headers of existing unified restart file that precede
+        /// the write position of report step \p seqnum.
+        std::vector<ArrayIndexEntry>
+        existingIndex(const ERst& rst, const int seqnum) const;
+
+        /// Number of arrays of existing unified restart file that precede
+        /// the write position of report step \p seqnum.
+        std::size_t numExistingArrays(const ERst& rst, const int seqnum) const;
+
+        /// Close output stream and write index file if requested.
+        void finishIndex();
 
         /// Open new output stream.
         ///
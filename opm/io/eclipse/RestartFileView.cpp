@@ -119,6 +119,19 @@ public:
             getRestartData<ElmType>(vector, this->report_step_, occurrence);
     }
 
+    template <typename ElmType>
+    std::vector<ElmType>
+    getKeywordWindow(const std::string& vector,
+                     const std::size_t  windowSize,
+                     const std::size_t  windowID,
+                     const int          occurrence)
+    {
+        return this->rst_file_->
+            getRestartRange<ElmType>(vector, this->report_step_,
+                                     windowID * windowSize, windowSize,
+                                     occurrence);
+    }
+
     const std::vector<int>& intehead()
     {
         const auto ihkw = std::string { "INTEHEAD" };
@@ -295,6 +308,17 @@ Opm::EclIO::RestartFileView::getKeyword(const std::string& vector,
     return this->pImpl_->template getKeyword<ElmType>(vector, occurrence);
 }
 
+template <typename ElmType>
+std::vector<ElmType>
+Opm::EclIO::RestartFileView::getKeywordWindow(const std::string& vector,
+                                              const std::size_t  windowSize,
+                                              const std::size_t  windowID,
+                                              const int          occurrence) const
+{
+    return this->pImpl_->template
+        getKeywordWindow<ElmType>(vector, windowSize, windowID, occurrence);
+}
+
 // =====================================================================
 
 namespace Opm { namespace EclIO {
@@ -320,4 +344,16 @@ RestartFileView::getKeyword<double>(const std::string&, const int) const;
 template const std::vector<std::string>&
 RestartFileView::getKeyword<std::string>(const std::string&, const int) const;
 
+template std::vector<int>
+RestartFileView::getKeywordWindow<int>(const std::string&, const std::size_t,
+                                       const std::size_t, const int) const;
+
+template std::vector<float>
+RestartFileView::getKeywordWindow<float>(const std::string&, const std::size_t,
+                                         const std::size_t, const int) const;
+
+template std::vector<double>
+RestartFileView::getKeywordWindow<double>(const std::string&, const std::size_t,
+                                          const std::size_t, const int) const;
+
 }} // Opm::EclIO
@@ -57,6 +57,17 @@ public:
     const std::vector<ElmType>&
     getKeyword(const std::string& vector, const int occurrence = 0) const;
 
+    /// Window \p windowID of size \p windowSize in numeric array, e.g.,
+    /// the IWEL entries of a single well.  Reads only the part of the file
+    /// holding the window unless the array is already loaded.  ElmType
+    /// must be int, float, or double.
+    template <typename ElmType>
+    std::vector<ElmType>
+    getKeywordWindow(const std::string& vector,
+                     const std::size_t  windowSize,
+                     const std::size_t  windowID,
+                     const int          occurrence = 0) const;
+
     const std::vector<int>& intehead() const;
     const std::vector<bool>& logihead() const;
     const std::vector<double>& doubhead() const;
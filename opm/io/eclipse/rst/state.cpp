@@ -31,6 +31,7 @@
 #include <opm/io/eclipse/rst/udq.hpp>
 #include <opm/io/eclipse/rst/well.hpp>
 
+#include <opm/common/utility/ParallelWithFallback.hpp>
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
@@ -334,6 +335,36 @@ namespace {
 
         udq.commitValues();
     }
+
+    // Decode the per-well blocks of all wells concurrently.  Wells are
+    // independent of each other, and each well's connection and segment
+    // blocks are decoded together with the well itself.  Results are
+    // stored in well order.
+    template <typename DecodeWell>
+    void decodeWells(const int                             num_wells,
+                     const Opm::UnitSystem&                unit_system,
+                     DecodeWell&&                          decodeWell,
+                     std::vector<Opm::RestartIO::RstWell>& wells)
+    {
+        auto decoded = std::vector<std::optional<Opm::RestartIO::RstWell>>(num_wells);
+
+        wells.reserve(wells.size() + num_wells);
+
+        Opm::parallelWithSequentialFallback
+            (num_wells, 16, unit_system,
+             [&decoded, &decodeWell](const Opm::UnitSystem& units, const std::size_t iw)
+             { decoded[iw].emplace(decodeWell(units, static_cast<int>(iw))); },
+
+             [&decoded, &decodeWell, &unit_system, &wells]
+             (const std::size_t iw, const bool failed)
+             {
+                 if (failed) {
+                     decoded[iw].emplace(decodeWell(unit_system, static_cast<int>(iw)));
+                 }
+
+                 wells.push_back(std::move(*decoded[iw]));
+             });
+    }
 }
 
 namespace Opm::RestartIO {
@@ -461,8 +492,9 @@ void RstState::add_wells(const std::vector<std::string>& zwel,
                          const std::vector<float>& scon,
                          const std::vector<double>& xcon)
 {
-
-    for (int iw = 0; iw < this->header.num_wells; iw++) {
+    auto decodeWell = [&zwel, &iwel, &swel, &xwel, &icon, &scon, &xcon, this]
+        (const UnitSystem& units, const int iw)
+    {
         std::size_t zwel_offset = iw * this->header.nzwelz;
         std::size_t iwel_offset = iw * this->header.niwelz;
         std::size_t swel_offset = iw * this->header.nswelz;
@@ -471,20 +503,24 @@ void RstState::add_wells(const std::vector<std::string>& zwel,
         std::size_t scon_offset = iw * this->header.nsconz * this->header.ncwmax;
         std::size_t xcon_offset = iw * this->header.nxconz * this->header.ncwmax;
         int group_index = iwel[ iwel_offset + VI::IWell::Group ] - 1;
-        const std::string group = this->groups[group_index].name;
-
-        this->wells.emplace_back(this->unit_system,
-                                 this->header,
-                                 group,
-                                 zwel.data() + zwel_offset,
-                                 iwel.data() + iwel_offset,
-                                 swel.data() + swel_offset,
-                                 xwel.data() + xwel_offset,
-                                 icon.data() + icon_offset,
-                                 scon.data() + scon_offset,
-                                 xcon.data() + xcon_offset);
-
-        if (this->wells.back().msw_index)
+        const std::string& group = this->groups[group_index].name;
+
+        return RstWell { units,
+                         this->header,
+                         group,
+                         zwel.data() + zwel_offset,
+                         iwel.data() + iwel_offset,
+                         swel.data() + swel_offset,
+                         xwel.data() + xwel_offset,
+                         icon.data() + icon_offset,
+                         scon.data() + scon_offset,
+                         xcon.data() + xcon_offset };
+    };
+
+    decodeWells(this->header.num_wells, this->unit_system, decodeWell, this->wells);
+
+    for (const auto& well : this->wells) {
+        if (well.msw_index)
             throw std::logic_error("MSW data not accounted for in this constructor");
     }
 }
@@ -499,8 +535,9 @@ void RstState::add_msw(const std::vector<std::string>& zwel,
                        const std::vector<int>& iseg,
                        const std::vector<double>& rseg)
 {
-
-    for (int iw = 0; iw < this->header.num_wells; iw++) {
+    auto decodeWell = [&zwel, &iwel, &swel, &xwel, &icon, &scon, &xcon, &iseg, &rseg, this]
+        (const UnitSystem& units, const int iw)
+    {
         std::size_t zwel_offset = iw * this->header.nzwelz;
         std::size_t iwel_offset = iw * this->header.niwelz;
         std::size_t swel_offset = iw * this->header.nswelz;
@@ -509,21 +546,23 @@ void RstState::add_msw(const std::vector<std::string>& zwel,
         std::size_t scon_offset = iw * this->header.nsconz * this->header.ncwmax;
         std::size_t xcon_offset = iw * this->header.nxconz * this->header.ncwmax;
         int group_index = iwel[ iwel_offset + VI::IWell::Group ] - 1;
-        const std::string group = this->groups[group_index].name;
-
-        this->wells.emplace_back(this->unit_system,
-                                 this->header,
-                                 group,
-                                 zwel.data() + zwel_offset,
-                                 iwel.data() + iwel_offset,
-                                 swel.data() + swel_offset,
-                                 xwel.data() + xwel_offset,
-                                 icon.data() + icon_offset,
-                                 scon.data() + scon_offset,
-                                 xcon.data() + xcon_offset,
-                                 iseg,
-                                 rseg);
-    }
+        const std::string& group = this->groups[group_index].name;
+
+        return RstWell { units,
+                         this->header,
+                         group,
+                         zwel.data() + zwel_offset,
+                         iwel.data() + iwel_offset,
+                         swel.data() + swel_offset,
+                         xwel.data() + xwel_offset,
+                         icon.data() + icon_offset,
+                         scon.data() + scon_offset,
+                         xcon.data() + xcon_offset,
+                         iseg,
+                         rseg };
+    };
+
+    decodeWells(this->header.num_wells, this->unit_system, decodeWell, this->wells);
 }
 
 void RstState::add_udqs(std::shared_ptr<EclIO::RestartFileView> rstView)
@@ -64,7 +64,8 @@ namespace {
     float dfactor_correlation_coefficient_a(const Opm::UnitSystem& unit_system,
                                             const float            coeff_a)
     {
-        const auto dimension = Opm::ParserKeywords::WDFACCOR{}
+        // Looked up once rather than constructing the keyword for each well.
+        static const auto dimension = Opm::ParserKeywords::WDFACCOR{}
             .getRecord(0).get(Opm::ParserKeywords::WDFACCOR::A::itemName)
             .dimensions().front();
 
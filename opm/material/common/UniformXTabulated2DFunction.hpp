@@ -33,6 +33,7 @@
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/common/MathToolbox.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iosfwd>
@@ -80,11 +81,17 @@ public:
                                 const std::vector<Scalar>& yPos,
                                 const std::vector<std::vector<SamplePoint>>& samples,
                                 InterpolationPolicy interpolationGuide)
-        : samples_(samples)
-        , xPos_(xPos)
+        : xPos_(xPos)
         , yPos_(yPos)
         , interpolationGuide_(interpolationGuide)
-    { }
+    {
+        for (const auto& column : samples) {
+            for (const auto& point : column) {
+                flatSamples_.push_back({std::get<1>(point), std::get<2>(point)});
+            }
+            columnOffset_.push_back(flatSamples_.size());
+        }
+    }
 
     /*!
      * \brief Returns the minimum of the X coordinate of the sampling points.
@@ -108,13 +115,13 @@ public:
      * \brief Returns the value of the Y coordinate of a sampling point.
      */
     Scalar yAt(size_t i, size_t j) const
-    { return std::get<1>(samples_[i][j]); }
+    { return flatSamples_[columnOffset_[i] + j].y; }
 
     /*!
      * \brief Returns the value of a sampling point.
      */
     Scalar valueAt(size_t i, size_t j) const
-    { return std::get<2>(samples_[i][j]); }
+    { return flatSamples_[columnOffset_[i] + j].value; }
 
     /*!
      * \brief Returns the number of sampling points in X direction.
@@ -126,19 +133,19 @@ public:
      * \brief Returns the minimum of the Y coordinate of the sampling points for a given column.
      */
     Scalar yMin(unsigned i) const
-    { return std::get<1>(samples_.at(i).front()); }
+    { return flatSamples_[columnOffset_.at(i)].y; }
 
     /*!
      * \brief Returns the maximum of the Y coordinate of the sampling points for a given column.
      */
     Scalar yMax(unsigned i) const
-    { return std::get<1>(samples_.at(i).back()); }
+    { return flatSamples_[columnOffset_.at(i + 1) - 1].y; }
 
     /*!
      * \brief Returns the number of sampling points in Y direction a given column.
      */
     size_t numY(unsigned i) const
-    { return samples_.at(i).size(); }
+    { return columnOffset_.at(i + 1) - columnOffset_[i]; }
 
     /*!
      * \brief Return the position on the x-axis of the i-th interval.
@@ -150,9 +157,21 @@ public:
         return xPos_.at(i);
     }
 
-    const std::vector<std::vector<SamplePoint>>& samples() const
+    /*!
+     * \brief Returns the sampling points column by column.
+     *
+     * The points are stored in a single contiguous array, so this builds a copy.
+     */
+    std::vector<std::vector<SamplePoint>> samples() const
     {
-        return samples_;
+        std::vector<std::vector<SamplePoint>> result(numX());
+        for (std::size_t i = 0; i < numX(); ++i) {
+            result[i].reserve(numY(i));
+            for (std::size_t j = columnOffset_[i]; j < columnOffset_[i + 1]; ++j) {
+                result[i].emplace_back(xPos_[i], flatSamples_[j].y, flatSamples_[j].value);
+            }
+        }
+        return result;
     }
 
     const std::vector<Scalar>& xPos() const
@@ -176,9 +195,9 @@ public:
     Scalar jToY(unsigned i, unsigned j) const
     {
         assert(i < numX());
-        assert(size_t(j) < samples_[i].size());
+        assert(size_t(j) < numY(i));
 
-        return std::get<1>(samples_.at(i).at(j));
+        return yAt(i, j);
     }
 
     /*!
@@ -237,24 +256,25 @@ public:
                            [[maybe_unused]] bool extrapolate = false) const
     {
         assert(xSampleIdx < numX());
-        const auto& colSamplePoints = samples_.at(xSampleIdx);
+        const FlatSample* colSamplePoints = flatSamples_.data() + columnOffset_[xSampleIdx];
+        const unsigned numColSamples = columnOffset_[xSampleIdx + 1] - columnOffset_[xSampleIdx];
 
-        assert(colSamplePoints.size() >= 2);
+        assert(numColSamples >= 2);
         assert(extrapolate || (yMin(xSampleIdx) <= y && y <= yMax(xSampleIdx)));
 
-        if (y <= std::get<1>(colSamplePoints[1]))
+        if (y <= colSamplePoints[1].y)
             return 0;
-        else if (y >= std::get<1>(colSamplePoints[colSamplePoints.size() - 2]))
-            return colSamplePoints.size() - 2;
+        else if (y >= colSamplePoints[numColSamples - 2].y)
+            return numColSamples - 2;
         else {
-            assert(colSamplePoints.size() >= 3);
+            assert(numColSamples >= 3);
 
             // bisection
             unsigned lowerIdx = 1;
-            unsigned upperIdx = colSamplePoints.size() - 2;
+            unsigned upperIdx = numColSamples - 2;
             while (lowerIdx + 1 < upperIdx) {
                 unsigned pivotIdx = (lowerIdx + upperIdx) / 2;
-                if (y < std::get<1>(colSamplePoints[pivotIdx]))
+                if (y < colSamplePoints[pivotIdx].y)
                     upperIdx = pivotIdx;
                 else
                     lowerIdx = pivotIdx;
@@ -276,10 +296,10 @@ public:
         assert(xSampleIdx < numX());
         assert(ySegmentIdx < numY(xSampleIdx) - 1);
 
-        const auto& colSamplePoints = samples_.at(xSampleIdx);
+        const FlatSample* segment = flatSamples_.data() + columnOffset_[xSampleIdx] + ySegmentIdx;
 
-        Scalar y1 = std::get<1>(colSamplePoints[ySegmentIdx]);
-        Scalar y2 = std::get<1>(colSamplePoints[ySegmentIdx + 1]);
+        Scalar y1 = segment[0].y;
+        Scalar y2 = segment[1].y;
 
         return (y - y1)/(y2 - y1);
     }
@@ -296,16 +316,13 @@ public:
         unsigned i = xSegmentIndex(x, /*extrapolate=*/false);
         Scalar alpha = xToAlpha(decay<Scalar>(x), i);
 
-        const auto& col1SamplePoints = samples_.at(i);
-        const auto& col2SamplePoints = samples_.at(i + 1);
-
         Scalar minY =
-                alpha*std::get<1>(col1SamplePoints.front()) +
-                (1 - alpha)*std::get<1>(col2SamplePoints.front());
+                alpha*yMin(i) +
+                (1 - alpha)*yMin(i + 1);
 
         Scalar maxY =
-                alpha*std::get<1>(col1SamplePoints.back()) +
-                (1 - alpha)*std::get<1>(col2SamplePoints.back());
+                alpha*yMax(i) +
+                (1 - alpha)*yMax(i + 1);
 
         return minY <= y && y <= maxY;
     }
@@ -352,52 +369,17 @@ public:
         // bi-linear interpolation: first, calculate the x and y indices in the lookup
         // table ...
         i = xSegmentIndex(x, extrapolate);
-        alpha = xToAlpha(x, i);
-        // The 'shift' is used to shift the points used to interpolate within
-        // the (i) and (i+1) sets of sample points, so that when approaching
-        // the boundary of the domain given by the samples, one gets the same
-        // value as one would get by interpolating along the boundary curve
-        // itself.
-        Evaluation shift = 0.0;
-        if (interpolationGuide_ == InterpolationPolicy::Vertical) {
-            // Shift is zero, no need to reset it.
-        } else {
-            // find upper and lower y value
-            if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
-                // The domain is above the boundary curve, up to y = infinity.
-                // The shift is therefore the same for all values of y.
-                shift = yPos_[i+1] - yPos_[i];
-            } else {
-                assert(interpolationGuide_ == InterpolationPolicy::RightExtreme);
-                // The domain is below the boundary curve, down to y = 0.
-                // The shift is therefore no longer the the same for all
-                // values of y, since at y = 0 the shift must be zero.
-                // The shift is computed by linear interpolation between
-                // the maximal value at the domain boundary curve, and zero.
-                shift = yPos_[i+1] - yPos_[i];
-                auto yEnd = yPos_[i]*(1.0 - alpha) + yPos_[i+1]*alpha;
-                if (yEnd > 0.) {
-                    shift = shift * y / yEnd;
-                } else {
-                    shift = 0.;
-                }
-            }
-        }
-        auto yLower =  y - alpha*shift;
-        auto yUpper =  y + (1-alpha)*shift;
-
-        j1 = ySegmentIndex(yLower, i, extrapolate);
-        j2 = ySegmentIndex(yUpper, i + 1, extrapolate);
-        beta1 = yToBeta(yLower, i, j1);
-        beta2 = yToBeta(yUpper, i + 1, j2);
+        findYPoints_(i, j1, j2, alpha, beta1, beta2, x, y, extrapolate);
     }
 
     template <class Evaluation>
     Evaluation eval(const unsigned& i, const unsigned& j1, const unsigned& j2, const Evaluation& alpha,const Evaluation& beta1,const Evaluation& beta2) const
     {
         // evaluate the two function values for the same y value ...
-        const Evaluation& s1 = valueAt(i, j1)*(1.0 - beta1) + valueAt(i, j1 + 1)*beta1;
-        const Evaluation& s2 = valueAt(i + 1, j2)*(1.0 - beta2) + valueAt(i + 1, j2 + 1)*beta2;
+        const FlatSample* p1 = flatSamples_.data() + columnOffset_[i] + j1;
+        const FlatSample* p2 = flatSamples_.data() + columnOffset_[i + 1] + j2;
+        const Evaluation& s1 = p1[0].value*(1.0 - beta1) + p1[1].value*beta1;
+        const Evaluation& s2 = p2[0].value*(1.0 - beta2) + p2[1].value*beta2;
 
         Valgrind::CheckDefined(s1);
         Valgrind::CheckDefined(s2);
@@ -409,6 +391,42 @@ public:
         return result;
     }
 
+    /*!
+     * \brief Evaluate the function at a sequence of (x,y) positions.
+     *
+     * This is equivalent to calling eval() for each pair of x[k] and y[k], but
+     * the x segment found for one point is tried first for the next one, so that
+     * the bisection on the x axis is skipped for runs of points that fall into
+     * the same Rs (or Rv) interval.
+     */
+    template <class Evaluation>
+    void evalBatch(const std::vector<Evaluation>& x,
+                   const std::vector<Evaluation>& y,
+                   std::vector<Evaluation>& result,
+                   bool extrapolate = false) const
+    {
+        assert(x.size() == y.size());
+        result.resize(x.size());
+
+        Evaluation alpha, beta1, beta2;
+        unsigned i = 0, j1, j2;
+        for (std::size_t k = 0; k < x.size(); ++k) {
+#ifndef NDEBUG
+            if (!extrapolate && !applies(x[k], y[k])) {
+                throw NumericalProblem("Attempt to get undefined table value (" +
+                                       std::to_string(scalarValue(x[k])) + ", " +
+                                       std::to_string(scalarValue(y[k])) + ")");
+            }
+#endif
+            if (k == 0 || !isXSegment_(x[k], i)) {
+                i = xSegmentIndex(x[k], extrapolate);
+            }
+
+            findYPoints_(i, j1, j2, alpha, beta1, beta2, x[k], y[k], extrapolate);
+            result[k] = eval(i, j1, j2, alpha, beta1, beta2);
+        }
+    }
+
     /*!
      * \brief Set the x-position of a vertical line.
      *
@@ -419,14 +437,14 @@ public:
         if (xPos_.empty() || xPos_.back() < nextX) {
             xPos_.push_back(nextX);
             yPos_.push_back(std::numeric_limits<Scalar>::lowest() / 2);
-            samples_.push_back({});
+            columnOffset_.push_back(columnOffset_.back());
             return xPos_.size() - 1;
         }
         else if (xPos_.front() > nextX) {
             // this is slow, but so what?
             xPos_.insert(xPos_.begin(), nextX);
             yPos_.insert(yPos_.begin(), std::numeric_limits<Scalar>::lowest() / 2);
-            samples_.insert(samples_.begin(), std::vector<SamplePoint>());
+            columnOffset_.insert(columnOffset_.begin(), 0);
             return 0;
         }
         throw std::invalid_argument("Sampling points should be specified either monotonically "
@@ -441,22 +459,21 @@ public:
     size_t appendSamplePoint(size_t i, Scalar y, Scalar value)
     {
         assert(i < numX());
-        Scalar x = iToX(i);
-        if (samples_[i].empty()) {
-            samples_[i].emplace_back(x, y, value);
+        if (numY(i) == 0) {
+            insertSamplePoint_(i, 0, y, value);
             yPos_[i] = y;
             return 0;
         }
-        else if (std::get<1>(samples_[i].back()) < y) {
-            samples_[i].emplace_back(x, y, value);
+        else if (yMax(i) < y) {
+            insertSamplePoint_(i, numY(i), y, value);
             if (interpolationGuide_ == InterpolationPolicy::RightExtreme) {
                 yPos_[i] = y;
             }
-            return samples_[i].size() - 1;
+            return numY(i) - 1;
         }
-        else if (std::get<1>(samples_[i].front()) > y) {
+        else if (yMin(i) > y) {
             // slow, but we still don't care...
-            samples_[i].emplace(samples_[i].begin(), x, y, value);
+            insertSamplePoint_(i, 0, y, value);
             if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
                 yPos_[i] = y;
             }
@@ -478,21 +495,107 @@ public:
     bool operator==(const UniformXTabulated2DFunction<Scalar>& data) const {
         return this->xPos() == data.xPos() &&
                this->yPos() == data.yPos() &&
-               this->samples() == data.samples() &&
+               this->columnOffset_ == data.columnOffset_ &&
+               std::equal(this->flatSamples_.begin(), this->flatSamples_.end(),
+                          data.flatSamples_.begin(), data.flatSamples_.end(),
+                          [](const FlatSample& a, const FlatSample& b)
+                          { return a.y == b.y && a.value == b.value; }) &&
                this->interpolationGuide() == data.interpolationGuide();
     }
 
 private:
-    // the vector which contains the values of the sample points
-    // f(x_i, y_j). don't use this directly, use getSamplePoint(i,j)
-    // instead!
-    std::vector<std::vector<SamplePoint> > samples_;
+    // a sampling point of the flattened table. the x coordinate is the one of
+    // the point's column.
+    struct FlatSample
+    {
+        Scalar y;
+        Scalar value;
+    };
+
+    template <class Evaluation>
+    bool isXSegment_(const Evaluation& x, unsigned i) const
+    {
+        // must agree with the segment which would be returned by
+        // xSegmentIndex(), which tests the first segment before the last one
+        const std::size_t n = xPos_.size();
+        if (x <= xPos_[1])
+            return i == 0;
+        else if (x >= xPos_[n - 2])
+            return i == n - 2;
+
+        return xPos_[i] <= x && x < xPos_[i + 1];
+    }
+
+    template <class Evaluation>
+    void findYPoints_(unsigned i,
+                      unsigned& j1,
+                      unsigned& j2,
+                      Evaluation& alpha,
+                      Evaluation& beta1,
+                      Evaluation& beta2,
+                      const Evaluation& x,
+                      const Evaluation& y,
+                      bool extrapolate) const
+    {
+        alpha = xToAlpha(x, i);
+        // The 'shift' is used to shift the points used to interpolate within
+        // the (i) and (i+1) sets of sample points, so that when approaching
+        // the boundary of the domain given by the samples, one gets the same
+        // value as one would get by interpolating along the boundary curve
+        // itself.
+        Evaluation shift = 0.0;
+        if (interpolationGuide_ == InterpolationPolicy::Vertical) {
+            // Shift is zero, no need to reset it.
+        } else {
+            // find upper and lower y value
+            if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
+                // The domain is above the boundary curve, up to y = infinity.
+                // The shift is therefore the same for all values of y.
+                shift = yPos_[i+1] - yPos_[i];
+            } else {
+                assert(interpolationGuide_ == InterpolationPolicy::RightExtreme);
+                // The domain is below the boundary curve, down to y = 0.
+                // The shift is therefore no longer the the same for all
+                // values of y, since at y = 0 the shift must be zero.
+                // The shift is computed by linear interpolation between
+                // the maximal value at the domain boundary curve, and zero.
+                shift = yPos_[i+1] - yPos_[i];
+                auto yEnd = yPos_[i]*(1.0 - alpha) + yPos_[i+1]*alpha;
+                if (yEnd > 0.) {
+                    shift = shift * y / yEnd;
+                } else {
+                    shift = 0.;
+                }
+            }
+        }
+        auto yLower =  y - alpha*shift;
+        auto yUpper =  y + (1-alpha)*shift;
+
+        j1 = ySegmentIndex(yLower, i, extrapolate);
+        j2 = ySegmentIndex(yUpper, i + 1, extrapolate);
+        beta1 = yToBeta(yLower, i, j1);
+        beta2 = yToBeta(yUpper, i + 1, j2);
+    }
+
+    // insert a sampling point at position j of column i
+    void insertSamplePoint_(std::size_t i, std::size_t j, Scalar y, Scalar value)
+    {
+        flatSamples_.insert(flatSamples_.begin() + columnOffset_[i] + j, FlatSample{y, value});
+        for (std::size_t k = i + 1; k < columnOffset_.size(); ++k) {
+            ++columnOffset_[k];
+        }
+    }
 
     // the position of each vertical line on the x-axis
     std::vector<Scalar> xPos_;
     // the position on the y-axis of the guide point
     std::vector<Scalar> yPos_;
     InterpolationPolicy interpolationGuide_;
+
+    // the sampling points f(x_i, y_j) stored contiguously column by column, the
+    // points of column i are in [columnOffset_[i], columnOffset_[i + 1]).
+    std::vector<FlatSample> flatSamples_;
+    std::vector<std::size_t> columnOffset_{0};
 };
 } // namespace Opm
 
@@ -35,6 +35,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -228,6 +231,7 @@ void LiveOilPvt<Scalar>::setNumRegions(std::size_t numRegions)
     saturatedOilMuTable_.resize(numRegions);
     saturatedGasDissolutionFactorTable_.resize(numRegions);
     saturationPressure_.resize(numRegions);
+    saturationPressureIsExact_.resize(numRegions, false);
 }
 
 template<class Scalar>
@@ -348,6 +352,24 @@ void LiveOilPvt<Scalar>::updateSaturationPressure_(unsigned regionIdx)
 {
     const auto& gasDissolutionFac = saturatedGasDissolutionFactorTable_[regionIdx];
 
+    // if Rs(p) is strictly monotonic, the piecewise linear table can be inverted
+    // exactly by swapping the axes of its sampling points. linear extrapolation
+    // beyond the end points is preserved because the end segments stay the same.
+    const auto& pValues = gasDissolutionFac.xValues();
+    const auto& RsValues = gasDissolutionFac.yValues();
+    const auto strictlyIncreasing =
+        std::adjacent_find(RsValues.begin(), RsValues.end(), std::greater_equal<>{}) == RsValues.end();
+    const auto strictlyDecreasing =
+        std::adjacent_find(RsValues.begin(), RsValues.end(), std::less_equal<>{}) == RsValues.end();
+
+    if (gasDissolutionFac.numSamples() > 1 && (strictlyIncreasing || strictlyDecreasing)) {
+        saturationPressure_[regionIdx].setXYContainers(RsValues, pValues, /*sortInputs=*/false);
+        saturationPressureIsExact_[regionIdx] = true;
+        return;
+    }
+
+    saturationPressureIsExact_[regionIdx] = false;
+
     // create the function representing saturation pressure depending of the mass
     // fraction in gas
     std::size_t n = gasDissolutionFac.numSamples();
@@ -307,6 +307,18 @@ public:
                                   const Evaluation&,
                                   const Evaluation& Rs) const
     {
+        // the saturation pressure table is the exact inverse of the piecewise
+        // linear Rs(p) table if the latter is strictly monotonic, so the
+        // Newton iteration below can be skipped entirely in that case.
+        if (saturationPressureIsExact_[regionIdx]) {
+            const Evaluation pSat = saturationPressure_[regionIdx].eval(Rs, /*extrapolate=*/true);
+            if (pSat < 0.0) {
+                return 0.0;
+            }
+
+            return pSat;
+        }
+
         using Toolbox = MathToolbox<Evaluation>;
 
         const auto& RsTable = saturatedGasDissolutionFactorTable_[regionIdx];
@@ -396,6 +408,13 @@ public:
     const std::vector<TabulatedOneDFunction>& saturationPressure() const
     { return saturationPressure_; }
 
+    /*!
+     * \brief Whether the saturation pressure table of a region is the exact
+     *        inverse of the saturated Rs table.
+     */
+    bool saturationPressureIsExact(unsigned regionIdx) const
+    { return saturationPressureIsExact_[regionIdx]; }
+
     Scalar vapPar2() const
     { return vapPar2_; }
 
@@ -412,6 +431,7 @@ private:
     std::vector<TabulatedOneDFunction> inverseSaturatedOilBMuTable_{};
     std::vector<TabulatedOneDFunction> saturatedGasDissolutionFactorTable_{};
     std::vector<TabulatedOneDFunction> saturationPressure_{};
+    std::vector<bool> saturationPressureIsExact_{};
 
     Scalar vapPar2_ = 0.0;
 };
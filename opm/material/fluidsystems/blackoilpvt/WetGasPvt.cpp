@@ -35,6 +35,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -228,6 +231,7 @@ void WetGasPvt<Scalar>::setNumRegions(std::size_t numRegions)
     gasMu_.resize(numRegions, TabulatedTwoDFunction{TabulatedTwoDFunction::InterpolationPolicy::RightExtreme});
     saturatedOilVaporizationFactorTable_.resize(numRegions);
     saturationPressure_.resize(numRegions);
+    saturationPressureIsExact_.resize(numRegions, false);
 }
 
 template<class Scalar>
@@ -379,6 +383,24 @@ updateSaturationPressure_(unsigned regionIdx)
 {
     const auto& oilVaporizationFac = saturatedOilVaporizationFactorTable_[regionIdx];
 
+    // if Rv(p) is strictly monotonic, the piecewise linear table can be inverted
+    // exactly by swapping the axes of its sampling points. linear extrapolation
+    // beyond the end points is preserved because the end segments stay the same.
+    const auto& pValues = oilVaporizationFac.xValues();
+    const auto& RvValues = oilVaporizationFac.yValues();
+    const auto strictlyIncreasing =
+        std::adjacent_find(RvValues.begin(), RvValues.end(), std::greater_equal<>{}) == RvValues.end();
+    const auto strictlyDecreasing =
+        std::adjacent_find(RvValues.begin(), RvValues.end(), std::less_equal<>{}) == RvValues.end();
+
+    if (oilVaporizationFac.numSamples() > 1 && (strictlyIncreasing || strictlyDecreasing)) {
+        saturationPressure_[regionIdx].setXYContainers(RvValues, pValues, /*sortInputs=*/false);
+        saturationPressureIsExact_[regionIdx] = true;
+        return;
+    }
+
+    saturationPressureIsExact_[regionIdx] = false;
+
     // create the taublated function representing saturation pressure depending of
     // Rv
     std::size_t n = oilVaporizationFac.numSamples();
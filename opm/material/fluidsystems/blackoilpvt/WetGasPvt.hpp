@@ -331,6 +331,18 @@ public:
                                   const Evaluation&,
                                   const Evaluation& Rv) const
     {
+        // the saturation pressure table is the exact inverse of the piecewise
+        // linear Rv(p) table if the latter is strictly monotonic, so the
+        // Newton iteration below can be skipped entirely in that case.
+        if (saturationPressureIsExact_[regionIdx]) {
+            const Evaluation pSat = saturationPressure_[regionIdx].eval(Rv, /*extrapolate=*/true);
+            if (pSat < 0.0) {
+                return 0.0;
+            }
+
+            return pSat;
+        }
+
         using Toolbox = MathToolbox<Evaluation>;
 
         const auto& RvTable = saturatedOilVaporizationFactorTable_[regionIdx];
@@ -417,6 +429,13 @@ public:
     const std::vector<TabulatedOneDFunction>& saturationPressure() const
     { return saturationPressure_; }
 
+    /*!
+     * \brief Whether the saturation pressure table of a region is the exact
+     *        inverse of the saturated Rv table.
+     */
+    bool saturationPressureIsExact(unsigned regionIdx) const
+    { return saturationPressureIsExact_[regionIdx]; }
+
     Scalar vapPar1() const
     { return vapPar1_; }
 
@@ -432,6 +451,7 @@ private:
     std::vector<TabulatedOneDFunction> inverseSaturatedGasBMu_{};
     std::vector<TabulatedOneDFunction> saturatedOilVaporizationFactorTable_{};
     std::vector<TabulatedOneDFunction> saturationPressure_{};
+    std::vector<bool> saturationPressureIsExact_{};
 
     Scalar vapPar1_ = 0.0;
 };
@@ -31,9 +31,13 @@
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
 
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
@@ -54,16 +58,22 @@
 
 #include <algorithm>
 #include <cctype>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <utility>    // move
 #include <vector>
@@ -154,9 +164,167 @@ public:
          const std::string&   baseName,
          const bool           writeEsmry);
 
+    /// Destructor.
+    ///
+    /// Waits for any pending asynchronous output to be written.
+    ~Impl();
+
+    /// Files to create at a single time step.
+    struct TimeStepOutput
+    {
+        /// One-based report step index.  Report_step=0 represents time
+        /// zero.
+        int report_step{0};
+
+        /// Whether or not this is a time step in the middle of a report
+        /// step.
+        bool isSubstep{false};
+
+        /// Elapsed physical (i.e., simulated) time in seconds since start
+        /// of simulation.
+        double secs_elapsed{0.0};
+
+        /// Current time step index.  Nullopt if the sequence number should
+        /// be the same as the report step index.
+        std::optional<int> time_step{};
+
+        /// Whether or not to output restart file arrays in double
+        /// precision.
+        bool write_double{false};
+
+        /// Zero based count of time steps performed.
+        int ministep_id{0};
+
+        /// Whether or not to create RFT file output.
+        bool rft{false};
+
+        /// Whether or not the run's RFT file already exists.
+        bool haveExistingRFT{false};
+
+        /// Whether or not to create summary file output.
+        bool summary{false};
+
+        /// Whether or not to create restart file output.
+        bool restart{false};
+
+        /// Whether or not to create the RSM file.
+        bool runSummary{false};
+    };
+
+    /// Decide which files to create at the current time step.
+    ///
+    /// Records summary file output events, including SUMTHIN triggers, so
+    /// must be called exactly once per call to EclipseIO::writeTimeStep().
+    ///
+    /// \param[in] report_step One-based report step index for which to
+    /// create output.  Report_step=0 represents time zero.
+    ///
+    /// \param[in] isSubstep Whether or not we're being called in the middle
+    /// of a report step.
+    ///
+    /// \param[in] secs_elapsed Elapsed physical (i.e., simulated) time in
+    /// seconds since start of simulation.
+    ///
+    /// \param[in] time_step Current time step index.  Nullopt if the
+    /// sequence number should be the same as the report step index.
+    ///
+    /// \param[in] write_double Whether or not to output simulation results
+    /// as double precision floating-point numbers.
+    ///
+    /// \return Output requests at this time step.
+    TimeStepOutput planOutput(const int                report_step,
+                              const bool               isSubstep,
+                              const double             secs_elapsed,
+                              const std::optional<int> time_step,
+                              const bool               write_double);
+
+    /// Create all file output requested at a single time step.
+    ///
+    /// Writes RFT, summary, restart, and RSM files, in that order, as
+    /// requested in \p request.
+    ///
+    /// \param[in] request Files to create at this time step.
+    ///
+    /// \param[in] action_state Run's current action system state.
+    ///
+    /// \param[in] wtest_state Run's current WTEST information.
+    ///
+    /// \param[in] st Summary values from most recent call to
+    /// Summary::eval().
+    ///
+    /// \param[in] udq_state Run's current UDQ values.
+    ///
+    /// \param[in] value Collection of per-cell, per-well, per-connection,
+    /// per-segment, per-group, and per-aquifer dynamic results pertaining
+    /// to this time point.
+    void writeOutput(const TimeStepOutput& request,
+                     const Action::State&  action_state,
+                     const WellTestState&  wtest_state,
+                     const SummaryState&   st,
+                     const UDQState&       udq_state,
+                     RestartValue&&        value);
+
+    /// Whether or not time step output is currently written on a separate
+    /// thread.
+    bool asyncOutput() const { return this->writer_.joinable(); }
+
+    /// Start writer thread for asynchronous time step output.
+    ///
+    /// No operation if the writer thread is already running, other than
+    /// resetting the queue capacity.
+    ///
+    /// \param[in] maxPendingSteps Maximum number of queued time steps.
+    void startAsyncOutput(const std::size_t maxPendingSteps);
+
+    /// Stop writer thread for asynchronous time step output.
+    ///
+    /// Writes all pending output before returning.  Does not report any
+    /// errors encountered by the writer thread.  Those remain available to
+    /// flushOutput().
+    void stopAsyncOutput();
+
+    /// Queue time step output for the writer thread.
+    ///
+    /// Blocks while the queue is full.  Rethrows any exception raised by
+    /// the writer thread.
+    ///
+    /// \param[in] request Files to create at this time step.
+    ///
+    /// \param[in] action_state Run's current action system state.
+    ///
+    /// \param[in] wtest_state Run's current WTEST information.
+    ///
+    /// \param[in] st Summary values from most recent call to
+    /// Summary::eval().
+    ///
+    /// \param[in] udq_state Run's current UDQ values.
+    ///
+    /// \param[in] value Collection of per-cell, per-well, per-connection,
+    /// per-segment, per-group, and per-aquifer dynamic results pertaining
+    /// to this time point.
+    void queueOutput(const TimeStepOutput& request,
+                     const Action::State&  action_state,
+                     const WellTestState&  wtest_state,
+                     const SummaryState&   st,
+                     const UDQState&       udq_state,
+                     RestartValue&&        value);
+
+    /// Wait until the writer thread has written all queued output.
+    ///
+    /// Rethrows any exception raised by the writer thread.
+    void flushOutput();
+
     /// Whether or not run requests file output.
     bool outputEnabled() const { return this->output_enabled_; }
 
+    /// Select whether or not to maintain a restart index file.
+    ///
+    /// \param[in] writeIndex Whether or not to write the index.
+    void setRestartIndexOutput(const bool writeIndex)
+    {
+        this->writeRestartIndex_ = writeIndex;
+    }
+
     /// Whether or not run requests RFT file output at this time.
     ///
     /// \param[in] report_step One-based report step index.
@@ -326,15 +494,14 @@ public:
     /// \param[in] time_step Zero-based time step ID.  Nullopt if the
     /// sequence number should be the same as the report step.
     ///
-    /// \param[in] secs_elapsed Elapsed physical (i.e., simulated) time in
-    /// seconds since start of simulation.
+    /// \param[in] ministep_id Zero based count of time steps performed.
     ///
     /// \param[in] isSubstep Whether or not we're being called in the middle
     /// of a report step.
     void writeSummaryFile(const SummaryState&      st,
                           const int                report_step,
                           const std::optional<int> time_step,
-                          const double             secs_elapsed,
+                          const int                ministep_id,
                           const bool               isSubstep);
 
     /// Create restart file output.
@@ -441,6 +608,10 @@ private:
     /// Run's current time step ID.
     int miniStepId_{0};
 
+    /// Whether or not to maintain an index file of the restart file's
+    /// array headers.
+    bool writeRestartIndex_{false};
+
     /// Static aquifer descriptions for restart file output.
     ///
     /// Nullopt unless run includes aquifers.
@@ -465,6 +636,64 @@ private:
     /// Stored as \c float to mimic the summary file's TIME vector.
     float last_summary_output_{std::numeric_limits<float>::lowest()};
 
+    /// Time step output and copies of the dynamic state objects needed to
+    /// create that output.  Element type of asynchronous output queue.
+    struct PendingOutput
+    {
+        /// Files to create at this time step.
+        TimeStepOutput request;
+
+        /// Run's action system state at this time step.
+        Action::State action_state;
+
+        /// Run's WTEST information at this time step.
+        WellTestState wtest_state;
+
+        /// Summary vector values at this time step.
+        SummaryState st;
+
+        /// Run's UDQ values at this time step.
+        UDQState udq_state;
+
+        /// Dynamic results at this time step.
+        RestartValue value;
+    };
+
+    /// Writer thread for asynchronous time step output.
+    ///
+    /// Not joinable in synchronous output mode.
+    std::thread writer_{};
+
+    /// Serialises access to the asynchronous output queue and status.
+    std::mutex queueMutex_{};
+
+    /// Signals changes to the asynchronous output queue and status.
+    std::condition_variable queueChanged_{};
+
+    /// Time steps waiting to be written by the writer thread.
+    std::deque<PendingOutput> pending_{};
+
+    /// Maximum number of elements in pending_.
+    std::size_t maxPending_{1};
+
+    /// Whether or not the writer thread is currently creating output.
+    bool writing_{false};
+
+    /// Whether or not the writer thread should terminate once the queue
+    /// is empty.
+    bool stopWriter_{false};
+
+    /// First error raised by the writer thread.
+    ///
+    /// Time step output queued after an error is discarded.
+    std::exception_ptr writeError_{};
+
+    /// Writer thread's main loop.
+    ///
+    /// Creates output for queued time steps, in order, until requested to
+    /// stop and the queue is empty.
+    void drainOutputQueue();
+
     /// Output static properties to INIT file.
     ///
     /// \param[in] simProps Initial per-cell properties such as
@@ -589,6 +818,168 @@ Opm::EclipseIO::Impl::Impl(const EclipseState&  eclipseState,
     }
 }
 
+Opm::EclipseIO::Impl::~Impl()
+{
+    this->stopAsyncOutput();
+
+    if (this->writeError_ == nullptr) {
+        return;
+    }
+
+    try {
+        std::rethrow_exception(this->writeError_);
+    }
+    catch (const std::exception& e) {
+        OpmLog::error(std::string { "Asynchronous output failed: " } + e.what());
+    }
+    catch (...) {
+        OpmLog::error("Asynchronous output failed");
+    }
+}
+
+Opm::EclipseIO::Impl::TimeStepOutput
+Opm::EclipseIO::Impl::planOutput(const int                report_step,
+                                 const bool               isSubstep,
+                                 const double             secs_elapsed,
+                                 const std::optional<int> time_step,
+                                 const bool               write_double)
+{
+    auto request = TimeStepOutput {};
+
+    request.report_step  = report_step;
+    request.isSubstep    = isSubstep;
+    request.secs_elapsed = secs_elapsed;
+    request.time_step    = time_step;
+    request.write_double = write_double;
+    request.ministep_id  = this->miniStepId_;
+
+    // RFT file written only if requested and never for substeps.
+    std::tie(request.rft, request.haveExistingRFT) =
+        this->wantRFTOutput(report_step, isSubstep);
+
+    request.summary =
+        this->wantSummaryOutput(report_step, isSubstep, secs_elapsed, time_step);
+
+    if (request.summary) {
+        this->recordSummaryOutput(secs_elapsed);
+    }
+
+    // Restart file output (RPTRST &c).
+    request.restart = this->wantRestartOutput(report_step, isSubstep, time_step);
+
+    // Write RSM file at end of simulation.
+    request.runSummary = !isSubstep
+        && this->isFinalStep(report_step)
+        && this->summaryConfig_.createRunSummary();
+
+    return request;
+}
+
+void Opm::EclipseIO::Impl::writeOutput(const TimeStepOutput& request,
+                                       const Action::State&  action_state,
+                                       const WellTestState&  wtest_state,
+                                       const SummaryState&   st,
+                                       const UDQState&       udq_state,
+                                       RestartValue&&        value)
+{
+    if (request.rft) {
+        this->writeRftFile(request.secs_elapsed, request.report_step,
+                           request.haveExistingRFT, value.wells);
+    }
+
+    if (request.summary) {
+        this->writeSummaryFile(st, request.report_step, request.time_step,
+                               request.ministep_id, request.isSubstep);
+    }
+
+    if (request.restart) {
+        this->writeRestartFile(action_state, wtest_state, st, udq_state,
+                               request.report_step, request.time_step,
+                               request.secs_elapsed, request.write_double,
+                               std::move(value));
+    }
+
+    if (request.runSummary) {
+        this->writeRunSummary();
+    }
+}
+
+void Opm::EclipseIO::Impl::startAsyncOutput(const std::size_t maxPendingSteps)
+{
+    {
+        std::lock_guard<std::mutex> lock { this->queueMutex_ };
+        this->maxPending_ = std::max(maxPendingSteps, std::size_t{1});
+    }
+
+    // Capacity may have increased.
+    this->queueChanged_.notify_all();
+
+    if (! this->writer_.joinable()) {
+        this->stopWriter_ = false;
+        this->writer_ = std::thread { [this]() { this->drainOutputQueue(); } };
+    }
+}
+
+void Opm::EclipseIO::Impl::stopAsyncOutput()
+{
+    if (! this->writer_.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock { this->queueMutex_ };
+        this->stopWriter_ = true;
+    }
+
+    this->queueChanged_.notify_all();
+    this->writer_.join();
+}
+
+void Opm::EclipseIO::Impl::queueOutput(const TimeStepOutput& request,
+                                       const Action::State&  action_state,
+                                       const WellTestState&  wtest_state,
+                                       const SummaryState&   st,
+                                       const UDQState&       udq_state,
+                                       RestartValue&&        value)
+{
+    // Copy state objects before taking the lock to keep the critical
+    // section short.
+    auto output = PendingOutput {
+        request, action_state, wtest_state, st, udq_state, std::move(value)
+    };
+
+    {
+        std::unique_lock<std::mutex> lock { this->queueMutex_ };
+
+        this->queueChanged_.wait(lock, [this]() {
+            return (this->writeError_ != nullptr)
+                || (this->pending_.size() < this->maxPending_);
+        });
+
+        if (this->writeError_ != nullptr) {
+            std::rethrow_exception(this->writeError_);
+        }
+
+        this->pending_.push_back(std::move(output));
+    }
+
+    this->queueChanged_.notify_all();
+}
+
+void Opm::EclipseIO::Impl::flushOutput()
+{
+    std::unique_lock<std::mutex> lock { this->queueMutex_ };
+
+    this->queueChanged_.wait(lock, [this]() {
+        return (this->writeError_ != nullptr)
+            || (this->pending_.empty() && !this->writing_);
+    });
+
+    if (this->writeError_ != nullptr) {
+        std::rethrow_exception(this->writeError_);
+    }
+}
+
 std::pair<bool, bool>
 Opm::EclipseIO::Impl::wantRFTOutput(const int  report_step,
                                     const bool isSubstep) const
@@ -714,19 +1105,17 @@ void Opm::EclipseIO::Impl::writeInitial(data::Solution
 void Opm::EclipseIO::Impl::writeSummaryFile(const SummaryState&      st,
                                             const int                report_step,
                                             const std::optional<int> time_step,
-                                            const double             secs_elapsed,
+                                            const int                ministep_id,
                                             const bool               isSubstep)
 {
     this->summary_.add_timestep(st, this->reportIndex(report_step, time_step),
-                                this->miniStepId_,
+                                ministep_id,
                                 !time_step.has_value() || isSubstep);
 
     const auto is_final_summary =
         this->isFinalStep(report_step) && !isSubstep;
 
     this->summary_.write(is_final_summary);
-
-    this->recordSummaryOutput(secs_elapsed);
 }
 
 void Opm::EclipseIO::Impl::writeRestartFile(const Action::State& action_state,
@@ -743,7 +1132,8 @@ void Opm::EclipseIO::Impl::writeRestartFile(const Action::State& action_state,
         EclIO::OutputStream::ResultSet { this->outputDir_, this->baseName_ },
         this->reportIndex(report_step, time_step),
         EclIO::OutputStream::Formatted { this->es_.get().cfg().io().getFMTOUT() },
-        EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() }
+        EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() },
+        EclIO::OutputStream::Restart::WriteIndex { this->writeRestartIndex_ }
     };
 
     RestartIO::save(rstFile, report_step, secs_elapsed,
@@ -829,6 +1219,57 @@ void Opm::EclipseIO::Impl::writeEGridFile(const std::vector<NNCdata>& nnc) const
     this->grid_.save(egridFile, formatted, nnc, this->es_.get().getDeckUnitSystem());
 }
 
+void Opm::EclipseIO::Impl::drainOutputQueue()
+{
+    std::unique_lock<std::mutex> lock { this->queueMutex_ };
+
+    while (true) {
+        this->queueChanged_.wait(lock, [this]() {
+            return this->stopWriter_ || !this->pending_.empty();
+        });
+
+        if (this->pending_.empty()) {
+            // Stop requested and no more pending output.
+            return;
+        }
+
+        auto output = std::move(this->pending_.front());
+        this->pending_.pop_front();
+
+        const auto skip = this->writeError_ != nullptr;
+        this->writing_ = !skip;
+
+        lock.unlock();
+
+        // Queue has room for another time step.
+        this->queueChanged_.notify_all();
+
+        auto error = std::exception_ptr {};
+        if (! skip) {
+            try {
+                this->writeOutput(output.request,
+                                  output.action_state,
+                                  output.wtest_state,
+                                  output.st,
+                                  output.udq_state,
+                                  std::move(output.value));
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+        }
+
+        lock.lock();
+
+        this->writing_ = false;
+        if ((error != nullptr) && (this->writeError_ == nullptr)) {
+            this->writeError_ = error;
+        }
+
+        this->queueChanged_.notify_all();
+    }
+}
+
 void Opm::EclipseIO::Impl::recordSummaryOutput(const double secs_elapsed)
 {
     if (this->sumthin_triggered_) {
@@ -929,36 +1370,49 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
         return;
     }
 
-    // RFT file written only if requested and never for substeps.
-    if (const auto& [wantRFT, haveExistingRFT] =
-        this->impl->wantRFTOutput(report_step, isSubstep);
-        wantRFT)
-    {
-        this->impl->writeRftFile(secs_elapsed, report_step,
-                                 haveExistingRFT, value.wells);
-    }
+    const auto request = this->impl->
+        planOutput(report_step, isSubstep, secs_elapsed,
+                   time_step, write_double);
 
-    if (this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed, time_step)) {
-        this->impl->writeSummaryFile(st, report_step, time_step,
-                                     secs_elapsed, isSubstep);
+    if (this->impl->asyncOutput()) {
+        this->impl->queueOutput(request, action_state, wtest_state,
+                                st, udq_state, std::move(value));
+    }
+    else {
+        this->impl->writeOutput(request, action_state, wtest_state,
+                                st, udq_state, std::move(value));
     }
 
-    if (this->impl->wantRestartOutput(report_step, isSubstep, time_step)) {
-        // Restart file output (RPTRST &c).
-        this->impl->writeRestartFile(action_state, wtest_state, st, udq_state,
-                                     report_step, time_step, secs_elapsed,
-                                     write_double, std::move(value));
+    this->impl->countTimeStep();
+}
+
+void Opm::EclipseIO::setAsyncOutput(const bool        async,
+                                    const std::size_t maxPendingSteps)
+{
+    if (async) {
+        this->impl->startAsyncOutput(maxPendingSteps);
+    }
+    else {
+        this->impl->flushOutput();
+        this->impl->stopAsyncOutput();
     }
+}
 
-    if (! isSubstep &&
-        this->impl->isFinalStep(report_step) &&
-        this->impl->summaryConfig().createRunSummary())
-    {
-        // Write RSM file at end of simulation.
-        this->impl->writeRunSummary();
+void Opm::EclipseIO::setRestartIndexOutput(const bool writeIndex)
+{
+    // Restart files might be written on the writer thread.
+    this->flushOutput();
+
+    this->impl->setRestartIndexOutput(writeIndex);
+}
+
+void Opm::EclipseIO::flushOutput()
+{
+    if (! this->impl->asyncOutput()) {
+        return;
     }
 
-    this->impl->countTimeStep();
+    this->impl->flushOutput();
 }
 
 Opm::RestartValue
@@ -27,6 +27,7 @@
 #include <opm/output/data/Solution.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -228,6 +229,58 @@ public:
                        const bool           write_double = false,
                        std::optional<int>   time_step = std::nullopt);
 
+    /// Select synchronous or asynchronous time step file output.
+    ///
+    /// In asynchronous mode, writeTimeStep() decides which files to create
+    /// at the current time, moves the RestartValue and copies the dynamic
+    /// state objects into a bounded queue, and returns without waiting for
+    /// the files to be written.  A dedicated writer thread drains the queue
+    /// into the run's summary, restart, and RFT files in the order in which
+    /// the time steps were submitted.  If the queue is full, writeTimeStep()
+    /// blocks until the writer thread has finished with the oldest entry.
+    ///
+    /// Summary::eval() may be called while the writer thread is active,
+    /// since the writer thread only uses Summary::add_timestep() and
+    /// Summary::write() which look up their own summary vector identifiers.
+    /// Callers that need to read back the run's result files must call
+    /// flushOutput() first.  Any exception raised by the writer thread is
+    /// rethrown from the next call to writeTimeStep() or flushOutput().
+    ///
+    /// The writer thread reads the Schedule object passed to the
+    /// constructor.  Callers must therefore call flushOutput() before
+    /// modifying that object--e.g., through Schedule::applyAction() or
+    /// Schedule::runPyAction() when an ACTIONX or PYACTION block triggers.
+    ///
+    /// Switching back to synchronous output waits for all pending output.
+    ///
+    /// \param[in] async Whether or not to write time step output on a
+    /// separate thread.  Synchronous output is the default.
+    ///
+    /// \param[in] maxPendingSteps Maximum number of time steps waiting to
+    /// be written in asynchronous mode.  Bounds the amount of additional
+    /// memory needed for result copies.  Treated as one if zero.
+    void setAsyncOutput(const bool        async,
+                        const std::size_t maxPendingSteps = 2);
+
+    /// Select whether or not to maintain a sidecar index file of the
+    /// restart file's array headers.
+    ///
+    /// The index (e.g., CASE.UNRST.idx) is rewritten whenever a report
+    /// step is added to the restart file.  It records the restart file's
+    /// size and modification time, and EclFile and ERst use it in place of
+    /// scanning every array header when it matches the file.  Applies to
+    /// unformatted restart files only.
+    ///
+    /// \param[in] writeIndex Whether or not to write the index.  Default
+    /// is not to write an index.
+    void setRestartIndexOutput(const bool writeIndex);
+
+    /// Wait until all pending time step output has been written.
+    ///
+    /// Output barrier, e.g., before creating a checkpoint or modifying the
+    /// Schedule.  No operation in synchronous output mode.
+    void flushOutput();
+
     /// Load per-cell solution data and wellstate from restart file.
     ///
     /// Name of restart file and report step from which to restart inferred
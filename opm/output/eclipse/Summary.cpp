@@ -24,6 +24,7 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ParallelWithFallback.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/EclipseState/Aquifer/AquiferCT.hpp>
@@ -84,6 +85,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -563,8 +565,8 @@ struct quantity {
 struct fn_args
 {
     const std::vector<const Opm::Well*>& schedule_wells;
-    const std::string group_name;
-    const std::string keyword_name;
+    const std::string& group_name;
+    const std::string& keyword_name;
     double duration;
     const int sim_step;
     int  num;
@@ -576,7 +578,7 @@ struct fn_args
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    const std::vector< std::pair< std::string, double > >& eff_factors;
     const std::optional<Opm::Inplace>& initial_inplace;
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -3648,117 +3650,140 @@ bool need_wells(const Opm::EclIO::SummaryNode& node)
     };
 }
 
-void updateValue(const Opm::EclIO::SummaryNode& node, const double value, Opm::SummaryState& st)
+Opm::SummaryState::KeyId summaryKey(const Opm::EclIO::SummaryNode& node,
+                                    const Opm::SummaryState&       st)
 {
     using Cat = Opm::EclIO::SummaryNode::Category;
 
     switch (node.category) {
     case Cat::Well:
-        st.update_well_var(node.wgname, node.keyword, value);
-        break;
+        return st.well_key_id(node.wgname, node.keyword);
 
     case Cat::Group:
     case Cat::Node:
-        st.update_group_var(node.wgname, node.keyword, value);
-        break;
+        return st.group_key_id(node.wgname, node.keyword);
 
     case Cat::Connection:
-        st.update_conn_var(node.wgname, node.keyword, node.number, value);
-        break;
+        return st.conn_key_id(node.wgname, node.keyword, node.number);
 
     case Cat::Segment:
-        st.update_segment_var(node.wgname, node.keyword, node.number, value);
-        break;
+        return st.segment_key_id(node.wgname, node.keyword, node.number);
 
     case Cat::Region:
-        st.update_region_var(node.fip_region.value_or("FIPNUM"),
-                             node.keyword, node.number, value);
-        break;
+        return st.region_key_id(node.fip_region.value_or("FIPNUM"),
+                                node.keyword, node.number);
 
     default:
-        st.update(node.unique_key(), value);
-        break;
+        return st.key_id(node.unique_key());
     }
 }
 
-/*
- * The well efficiency factor will not impact the well rate itself, but is
- * rather applied for accumulated values.The WEFAC can be considered to shut
- * and open the well for short intervals within the same timestep, and the well
- * is therefore solved at full speed.
- *
- * Groups are treated similarly as wells. The group's GEFAC is not applied for
- * rates, only for accumulated volumes. When GEFAC is set for a group, it is
- * considered that all wells are taken down simultaneously, and GEFAC is
- * therefore not applied to the group's rate. However, any efficiency factors
- * applied to the group's wells or sub-groups must be included.
- *
- * Regions and fields will have the well and group efficiency applied for both
- * rates and accumulated values.
- *
- */
-struct EfficiencyFactor
-{
-    using Factor  = std::pair<std::string, double>;
-    using FacColl = std::vector<Factor>;
+namespace Evaluator {
+    /// Wells of the current report step, shared by all evaluators.
+    ///
+    /// Well lists and group trees only change between report steps, so
+    /// evaluators resolve the wells they need once per report step and
+    /// refer to them by position in this table.  The Well objects
+    /// themselves may be replaced within a report step, e.g., when a well
+    /// is shut, so refresh() looks up the object of each well at every
+    /// evaluation.
+    class ScheduleWells
+    {
+    public:
+        /// Prepare table for evaluation at a particular report step.
+        void refresh(const Opm::Schedule&    sched,
+                     const int               sim_step,
+                     const Opm::data::Wells& wellSol)
+        {
+            const auto& wells = sched[sim_step].wells;
 
-    FacColl factors{};
+            if ((sim_step != this->sim_step_) ||
+                (wells.size() != this->names_.size()) ||
+                ! this->lookup(wells))
+            {
+                this->rebuild(wells);
+                this->sim_step_ = sim_step;
+            }
 
-    void setFactors(const Opm::EclIO::SummaryNode&       node,
-                    const Opm::Schedule&                 schedule,
-                    const std::vector<const Opm::Well*>& schedule_wells,
-                    const int                            sim_step,
-                    const Opm::data::Wells&              sim_res);
-};
+            this->scaling_.assign(this->names_.size(), 1.0);
+            for (auto i = 0*this->names_.size(); i < this->names_.size(); ++i) {
+                if (auto res = wellSol.find(this->names_[i]); res != wellSol.end()) {
+                    this->scaling_[i] = res->second.efficiency_scaling_factor;
+                }
+            }
+        }
 
-void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
-                                  const Opm::Schedule&                 schedule,
-                                  const std::vector<const Opm::Well*>& schedule_wells,
-                                  const int                            sim_step,
-                                  const Opm::data::Wells&              sim_res)
-{
-    this->factors.clear();
+        /// Identifies the current set of wells.  Changes whenever the
+        /// report step or the set of wells changes.
+        std::size_t generation() const
+        {
+            return this->generation_;
+        }
 
-    const bool is_field  { node.category == Opm::EclIO::SummaryNode::Category::Field  } ;
-    const bool is_group  { node.category == Opm::EclIO::SummaryNode::Category::Group  } ;
-    const bool is_region { node.category == Opm::EclIO::SummaryNode::Category::Region } ;
-    const bool is_rate   { node.type     != Opm::EclIO::SummaryNode::Type::Total      } ;
+        /// Position of named well in table.  Nullopt if the well does not
+        /// exist at the current report step.
+        std::optional<std::size_t> index(const std::string& well) const
+        {
+            auto pos = this->index_.find(well);
+            if (pos == this->index_.end()) {
+                return std::nullopt;
+            }
 
-    if (!is_field && !is_group && !is_region && is_rate)
-        return;
+            return pos->second;
+        }
 
-    for (const auto* well : schedule_wells) {
-        if (!well->hasBeenDefined(sim_step))
-            continue;
+        const Opm::Well* well(const std::size_t i) const
+        {
+            return this->wells_[i];
+        }
 
-        const auto res_it = sim_res.find(well->name());
-        double efficiency_scaling_factor = 1.0;
-        if (res_it != sim_res.end()) {
-            efficiency_scaling_factor = res_it->second.efficiency_scaling_factor;
+        /// Dynamic efficiency scaling factor of well at position i.  One
+        /// if the well has no dynamic results.
+        double scaling(const std::size_t i) const
+        {
+            return this->scaling_[i];
         }
 
-        double eff_factor = well->getEfficiencyFactor() * efficiency_scaling_factor;
-        const auto* group_ptr = std::addressof(schedule.getGroup(well->groupName(), sim_step));
+    private:
+        int sim_step_{-1};
+        std::size_t generation_{0};
+        std::vector<std::string> names_{};
+        std::unordered_map<std::string, std::size_t> index_{};
+        std::vector<const Opm::Well*> wells_{};
+        std::vector<double> scaling_{};
+
+        template <typename Wells>
+        bool lookup(const Wells& wells)
+        {
+            for (auto i = 0*this->names_.size(); i < this->names_.size(); ++i) {
+                const auto well = wells.get_ptr(this->names_[i]);
+                if (well == nullptr) {
+                    return false;
+                }
 
-        while (group_ptr) {
-            if (is_group && is_rate && (group_ptr->name() == node.wgname))
-                break;
+                this->wells_[i] = well.get();
+            }
 
-            eff_factor *= group_ptr->getGroupEfficiencyFactor();
+            return true;
+        }
 
-            const auto parent_group = group_ptr->flow_group();
+        template <typename Wells>
+        void rebuild(const Wells& wells)
+        {
+            this->names_ = wells.keys();
 
-            if (parent_group.has_value())
-                group_ptr = std::addressof(schedule.getGroup( parent_group.value(), sim_step ));
-            else
-                group_ptr = nullptr;
-        }
+            this->index_.clear();
+            for (auto i = 0*this->names_.size(); i < this->names_.size(); ++i) {
+                this->index_.emplace(this->names_[i], i);
+            }
 
-        this->factors.emplace_back(well->name(), eff_factor);
-    }
-}
+            this->wells_.resize(this->names_.size());
+            this->lookup(wells);
+
+            ++this->generation_;
+        }
+    };
 
-namespace Evaluator {
     struct InputData
     {
         const Opm::EclipseState& es;
@@ -3766,6 +3791,7 @@ namespace Evaluator {
         const Opm::EclipseGrid& grid;
         const Opm::out::RegionCache& reg;
         const std::optional<Opm::Inplace>& initial_inplace;
+        const ScheduleWells& wells;
     };
 
     struct SimulatorResults
@@ -3786,6 +3812,11 @@ namespace Evaluator {
     public:
         virtual ~Base() {}
 
+        /// Look up summary vector identifiers in the key registry of a
+        /// SummaryState object.  Called before the first update() with an
+        /// object of a different key scope than that of the previous call.
+        virtual void bind(const Opm::SummaryState& /* st */) {}
+
         virtual void update(const std::size_t       sim_step,
                             const double            stepSize,
                             const InputData&        input,
@@ -3793,40 +3824,96 @@ namespace Evaluator {
                             Opm::SummaryState&      st) const = 0;
     };
 
-    class FunctionRelation : public Base
+    /// Evaluator of a single summary vector.
+    ///
+    /// Computes the vector's value without modifying the SummaryState,
+    /// whence distinct vectors may be evaluated concurrently and their
+    /// values stored afterwards.
+    class SingleValue : public Base
     {
     public:
-        explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
-            : node_(std::move(node))
-            , fcn_ (std::move(fcn))
+        explicit SingleValue(const Opm::EclIO::SummaryNode& node)
+            : vector_  (node)
+            , category_(node.category)
+        {}
+
+        void bind(const Opm::SummaryState& st) final
         {
-            if (this->use_number()) {
-                this->number_ = std::max(0, this->node_.number);
-            }
+            this->key_ = summaryKey(this->vector_, st);
         }
 
         void update(const std::size_t       sim_step,
                     const double            stepSize,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Opm::SummaryState&      st) const final
+        {
+            const auto value = this->evaluate(sim_step, stepSize, input, simRes, st);
+
+            if (value.has_value()) {
+                st.update_value(this->key_, *value);
+            }
+        }
+
+        /// Compute summary vector value in output units.
+        ///
+        /// \return Vector value.  Nullopt if the simulator did not provide
+        ///   the vector's underlying quantity, in which case the vector
+        ///   retains its current value.
+        virtual std::optional<double>
+        evaluate(const std::size_t        sim_step,
+                 const double             stepSize,
+                 const InputData&         input,
+                 const SimulatorResults&  simRes,
+                 const Opm::SummaryState& st) const = 0;
+
+        Opm::SummaryState::KeyId key() const
         {
-            const auto wells = need_wells(this->node_)
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<const Opm::Well*>{};
+            return this->key_;
+        }
 
-            EfficiencyFactor eFac{};
-            eFac.setFactors(this->node_, input.sched, wells, sim_step, simRes.wellSol);
+        Opm::EclIO::SummaryNode::Category category() const
+        {
+            return this->category_;
+        }
+
+    private:
+        Opm::EclIO::SummaryNode vector_{};
+        Opm::SummaryState::KeyId key_{};
+        Opm::EclIO::SummaryNode::Category category_{};
+    };
+
+    class FunctionRelation : public SingleValue
+    {
+    public:
+        explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
+            : SingleValue(node)
+            , node_      (std::move(node))
+            , fcn_       (std::move(fcn))
+            , group_name_(this->groupName())
+        {
+            if (this->use_number()) {
+                this->number_ = std::max(0, this->node_.number);
+            }
+        }
+
+        std::optional<double>
+        evaluate(const std::size_t        sim_step,
+                 const double             stepSize,
+                 const InputData&         input,
+                 const SimulatorResults&  simRes,
+                 const Opm::SummaryState& st) const override
+        {
+            const auto& plan = this->evaluationPlan(sim_step, input);
 
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword,
+                plan.wells, this->group_name_, this->node_.keyword,
                 stepSize, static_cast<int>(sim_step),
                 this->number_, this->node_.fip_region,
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(eFac.factors),
+                plan.factors,
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits()
             };
@@ -3834,15 +3921,138 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            return usys.from_si(prm.unit, prm.value);
         }
 
     private:
+        /// Inputs of the evaluation function which only change between
+        /// report steps, or which are cheaply refreshed from such inputs.
+        struct Plan
+        {
+            /// ScheduleWells::generation() for which the plan was made.
+            std::optional<std::size_t> generation{};
+
+            /// Positions of the vector's wells in ScheduleWells.
+            std::vector<std::size_t> well_index{};
+
+            /// Wells of the vector, refreshed at each evaluation.
+            std::vector<const Opm::Well*> wells{};
+
+            /// Wells subject to efficiency factors, as positions in
+            /// 'wells', and their accumulated group efficiency factors.
+            std::vector<std::size_t> factor_well{};
+            std::vector<double> group_factor{};
+
+            /// Well efficiency factors, refreshed at each evaluation.
+            std::vector<std::pair<std::string, double>> factors{};
+        };
+
         Opm::EclIO::SummaryNode node_;
         ofun                    fcn_;
+        std::string             group_name_{};
         int                     number_{0};
+        mutable Plan            plan_{};
+
+        const Plan& evaluationPlan(const std::size_t sim_step,
+                                   const InputData&  input) const
+        {
+            auto& plan = this->plan_;
+
+            if (plan.generation != input.wells.generation()) {
+                this->makePlan(static_cast<int>(sim_step), input);
+            }
+
+            for (auto i = 0*plan.wells.size(); i < plan.wells.size(); ++i) {
+                plan.wells[i] = input.wells.well(plan.well_index[i]);
+            }
+
+            for (auto i = 0*plan.factors.size(); i < plan.factors.size(); ++i) {
+                const auto well = plan.factor_well[i];
+
+                plan.factors[i].second = plan.wells[well]->getEfficiencyFactor()
+                    * input.wells.scaling(plan.well_index[well])
+                    * plan.group_factor[i];
+            }
 
-        std::string group_name() const
+            return plan;
+        }
+
+        void makePlan(const int sim_step, const InputData& input) const
+        {
+            auto& plan = this->plan_;
+
+            plan = Plan{};
+            plan.generation = input.wells.generation();
+
+            if (! need_wells(this->node_)) {
+                return;
+            }
+
+            plan.wells = find_wells(input.sched, this->node_, sim_step, input.reg);
+
+            for (const auto* well : plan.wells) {
+                plan.well_index.push_back(input.wells.index(well->name()).value());
+            }
+
+            // The well efficiency factor will not impact the well rate
+            // itself, but is rather applied for accumulated values.  The
+            // WEFAC can be considered to shut and open the well for short
+            // intervals within the same timestep, and the well is therefore
+            // solved at full speed.
+            //
+            // Groups are treated similarly as wells.  The group's GEFAC is
+            // not applied for rates, only for accumulated volumes.  When
+            // GEFAC is set for a group, it is considered that all wells are
+            // taken down simultaneously, and GEFAC is therefore not applied
+            // to the group's rate.  However, any efficiency factors applied
+            // to the group's wells or sub-groups must be included.
+            //
+            // Regions and fields will have the well and group efficiency
+            // applied for both rates and accumulated values.
+            //
+            // The group tree part of the factors only changes between
+            // report steps and is therefore resolved here, once per plan.
+            using Cat = Opm::EclIO::SummaryNode::Category;
+
+            const auto is_field  = this->node_.category == Cat::Field;
+            const auto is_group  = this->node_.category == Cat::Group;
+            const auto is_region = this->node_.category == Cat::Region;
+            const auto is_rate   = this->node_.type != Opm::EclIO::SummaryNode::Type::Total;
+
+            if (!is_field && !is_group && !is_region && is_rate) {
+                return;
+            }
+
+            for (auto i = 0*plan.wells.size(); i < plan.wells.size(); ++i) {
+                const auto* well = plan.wells[i];
+                if (! well->hasBeenDefined(sim_step)) {
+                    continue;
+                }
+
+                auto group_factor = 1.0;
+                const auto* group_ptr = std::addressof
+                    (input.sched.getGroup(well->groupName(), sim_step));
+
+                while (group_ptr) {
+                    if (is_group && is_rate && (group_ptr->name() == this->node_.wgname))
+                        break;
+
+                    group_factor *= group_ptr->getGroupEfficiencyFactor();
+
+                    const auto parent_group = group_ptr->flow_group();
+
+                    group_ptr = parent_group.has_value()
+                        ? std::addressof(input.sched.getGroup(parent_group.value(), sim_step))
+                        : nullptr;
+                }
+
+                plan.factor_well.push_back(i);
+                plan.group_factor.push_back(group_factor);
+                plan.factors.emplace_back(well->name(), 1.0);
+            }
+        }
+
+        std::string groupName() const
         {
             using Cat = ::Opm::EclIO::SummaryNode::Category;
 
@@ -3870,28 +4080,30 @@ namespace Evaluator {
         }
     };
 
-    class BlockValue : public Base
+    class BlockValue : public SingleValue
     {
     public:
         explicit BlockValue(Opm::EclIO::SummaryNode node,
                             const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
+            : SingleValue(node)
+            , node_(std::move(node))
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        evaluate(const std::size_t     /* sim_step */,
+                 const double          /* stepSize */,
+                 const InputData&         input,
+                 const SimulatorResults&  simRes,
+                 const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            return usys.from_si(this->m_, xPos->second);
         }
 
     private:
@@ -3904,71 +4116,75 @@ namespace Evaluator {
         }
     };
 
-    class AquiferValue: public Base
+    class AquiferValue: public SingleValue
     {
     public:
         explicit AquiferValue(Opm::EclIO::SummaryNode node,
                               const Opm::UnitSystem::measure m)
-        : node_(std::move(node))
+        : SingleValue(node)
+        , node_(std::move(node))
         , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        evaluate(const std::size_t     /* sim_step */,
+                 const double          /* stepSize */,
+                 const InputData&         input,
+                 const SimulatorResults&  simRes,
+                 const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.aquifers.find(this->node_.number);
             if (xPos == simRes.aquifers.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            return usys.from_si(this->m_, xPos->second.get(this->node_.keyword));
         }
     private:
         Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
     };
 
-    class RegionValue : public Base
+    class RegionValue : public SingleValue
     {
     public:
         explicit RegionValue(Opm::EclIO::SummaryNode node,
                              const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
+            : SingleValue(node)
+            , node_(std::move(node))
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        evaluate(const std::size_t     /* sim_step */,
+                 const double          /* stepSize */,
+                 const InputData&         input,
+                 const SimulatorResults&  simRes,
+                 const Opm::SummaryState& /* st */) const override
         {
             if (this->node_.number < 0) {
-                return;
+                return std::nullopt;
             }
 
             auto xPos = simRes.region.find(this->node_.keyword);
             if (xPos == simRes.region.end()) {
                 // Vector (e.g., RPR) not available from simulator.
                 // Typically at time zero.
-                return;
+                return std::nullopt;
             }
 
             const auto ix = this->index();
             if (ix >= xPos->second.size()) {
                 // Region ID outside active set (e.g., the node specifies
                 // region ID 12 when max(FIPNUM) == 10)
-                return;
+                return std::nullopt;
             }
 
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
@@ -3981,12 +4197,13 @@ namespace Evaluator {
         }
     };
 
-    class InterRegionValue : public Base
+    class InterRegionValue : public SingleValue
     {
     public:
         explicit InterRegionValue(const Opm::EclIO::SummaryNode& node,
                                   const Opm::UnitSystem::measure m)
-            : node_   (node)
+            : SingleValue(node)
+            , node_   (node)
             , m_      (m)
             , regname_(node_.fip_region.has_value()
                        ? node_.fip_region.value()
@@ -3995,30 +4212,31 @@ namespace Evaluator {
             this->analyzeKeyword();
         }
 
-        void update(const std::size_t    /* sim_step */,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        evaluate(const std::size_t     /* sim_step */,
+                 const double             stepSize,
+                 const InputData&         input,
+                 const SimulatorResults&  simRes,
+                 const Opm::SummaryState& /* st */) const override
         {
             if (this->component_ == Component::NumComponents) {
-                return;
+                return std::nullopt;
             }
 
             auto flows = simRes.ireg.find(this->regname_);
             if (flows == simRes.ireg.end()) {
-                return;
+                return std::nullopt;
             }
 
             auto flow = flows->second.getInterRegFlows(this->r1_, this->r2_);
             if (! flow.has_value()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
@@ -4174,29 +4392,31 @@ namespace Evaluator {
         }
     };
 
-    class GlobalProcessValue : public Base
+    class GlobalProcessValue : public SingleValue
     {
     public:
         explicit GlobalProcessValue(Opm::EclIO::SummaryNode node,
                                     const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
+            : SingleValue(node)
+            , node_(std::move(node))
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        evaluate(const std::size_t     /* sim_step */,
+                 const double          /* stepSize */,
+                 const InputData&         input,
+                 const SimulatorResults&  simRes,
+                 const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword);
             if (xPos == simRes.single.end())
-                return;
+                return std::nullopt;
 
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
@@ -4928,7 +5148,8 @@ public:
                                    const EclipseGrid&  grid,
                                    const Schedule&     sched,
                                    const std::string&  basename,
-                                   const bool          writeEsmry);
+                                   const bool          writeEsmry,
+                                   const bool          compressEsmry);
 
     SummaryImplementation(const SummaryImplementation& rhs) = delete;
     SummaryImplementation(SummaryImplementation&& rhs) = default;
@@ -4947,7 +5168,7 @@ public:
               const BlockValues&                     block_values,
               const data::Aquifers&                  aquifer_values,
               const InterRegFlowValues&              interreg_flows,
-              SummaryState&                          st) const;
+              SummaryState&                          st);
 
     void internal_store(const SummaryState& st,
                         const int           report_step,
@@ -4956,6 +5177,11 @@ public:
 
     void write(const bool is_final_summary);
 
+    void set_parallel_eval(const bool parallel)
+    {
+        this->parallelEval_ = parallel;
+    }
+
 private:
     struct MiniStep
     {
@@ -4965,6 +5191,18 @@ private:
         std::vector<float> params{};
     };
 
+    /// Consecutive summary vectors, in evaluation order, which are
+    /// processed as a unit in parallel evaluation mode.  Either a single
+    /// evaluator which must run sequentially--e.g., time vectors--or a run
+    /// of single value evaluators of the same category and their most
+    /// recently computed values.
+    struct EvalPartition
+    {
+        const Evaluator::Base* serial{nullptr};
+        std::vector<const Evaluator::SingleValue*> evaluators{};
+        std::vector<std::optional<double>> values{};
+    };
+
     using EvalPtr = SummaryOutputParameters::EvalPtr;
 
     std::reference_wrapper<const Opm::EclipseGrid> grid_;
@@ -4972,6 +5210,9 @@ private:
     std::reference_wrapper<const Opm::Schedule> sched_;
     Opm::out::RegionCache regCache_{};
 
+    // Wells of the most recently evaluated report step.
+    mutable Evaluator::ScheduleWells schedWells_{};
+
     std::unique_ptr<SMSpecStreamDeferredCreation> deferredSMSpec_;
 
     Opm::EclIO::OutputStream::ResultSet rset_;
@@ -4985,6 +5226,19 @@ private:
     SummaryOutputParameters                  outputParameters_{};
     std::unordered_map<std::string, EvalPtr> extra_parameters{};
     std::vector<std::string> valueKeys_{};
+    std::vector<SummaryState::KeyId> valueKeyIds_{};
+
+    // Key scope of the SummaryState for which the evaluators' summary
+    // vector identifiers were looked up.  Used by eval() only.
+    std::optional<std::uint64_t> keyScope_{};
+
+    // Key scope of the SummaryState for which valueKeyIds_ were looked
+    // up.  Used by internal_store() only, which may run on the output
+    // writer thread concurrently with eval().
+    std::optional<std::uint64_t> valueKeyScope_{};
+
+    bool parallelEval_{false};
+    mutable std::vector<EvalPartition> partitions_{};
     std::vector<std::string> valueUnits_{};
     std::vector<MiniStep>    unwritten_{};
 
@@ -5009,6 +5263,17 @@ private:
                       Evaluator::Factory& evaluatorFactory,
                       SummaryConfig&      summary_config);
 
+    void configureEvalPartitions();
+
+    void bindKeys(const SummaryState& st);
+    void bindValueKeys(const SummaryState& st);
+
+    void evalPartitioned(const int                          sim_step,
+                         const double                       duration,
+                         const Evaluator::InputData&        input,
+                         const Evaluator::SimulatorResults& simRes,
+                         SummaryState&                      st) const;
+
     MiniStep& getNextMiniStep(const int  report_step,
                               const int  ministep_id,
                               const bool isSubstep);
@@ -5027,7 +5292,8 @@ SummaryImplementation(SummaryConfig&      sumcfg,
                       const EclipseGrid&  grid,
                       const Schedule&     sched,
                       const std::string&  basename,
-                      const bool          writeEsmry)
+                      const bool          writeEsmry,
+                      const bool          compressEsmry)
     : grid_          (std::cref(grid))
     , es_            (std::cref(es))
     , sched_         (std::cref(sched))
@@ -5051,6 +5317,7 @@ SummaryImplementation(SummaryConfig&      sumcfg,
                                              sched, evaluatorFactory);
 
     this->configureUDQ(es, sched, evaluatorFactory, sumcfg);
+    this->configureEvalPartitions();
 
     this->regCache_.buildCache(sumcfg.fip_regions(),
                                es.globalFieldProps(),
@@ -5065,7 +5332,7 @@ SummaryImplementation(SummaryConfig&      sumcfg,
 
     if (writeEsmry && !es.cfg().io().getFMTOUT()) {
         this->esmry_ = std::make_unique<Opm::EclIO::ExtSmryOutput>
-            (this->valueKeys_, this->valueUnits_, es, sched.posixStartTime());
+            (this->valueKeys_, this->valueUnits_, es, sched.posixStartTime(), compressEsmry);
     }
 
     if (writeEsmry && es.cfg().io().getFMTOUT()) {
@@ -5081,15 +5348,17 @@ internal_store(const SummaryState& st,
 {
     auto& ms = this->getNextMiniStep(report_step, ministep_id, isSubstep);
 
+    this->bindValueKeys(st);
+
     const auto nParam = this->valueKeys_.size();
 
     for (auto i = decltype(nParam){0}; i < nParam; ++i) {
-        if (! st.has(this->valueKeys_[i]))
+        if (! st.has_value(this->valueKeyIds_[i]))
             // Parameter not yet evaluated (e.g., well/group not
             // yet active).  Nothing to do here.
             continue;
 
-        ms.params[i] = st.get(this->valueKeys_[i]);
+        ms.params[i] = st.get_value(this->valueKeyIds_[i]);
     }
 }
 
@@ -5107,17 +5376,22 @@ eval(const int                              sim_step,
      const BlockValues&                     block_values,
      const data::Aquifers&                  aquifer_values,
      const InterRegFlowValues&              interreg_flows,
-     Opm::SummaryState&                     st) const
+     Opm::SummaryState&                     st)
 {
     validateElapsedTime(secs_elapsed, this->es_, st);
 
+    this->bindKeys(st);
+
     const auto duration = secs_elapsed - st.get_elapsed();
 
     single_values["TIMESTEP"] = duration;
     st.update("TIMESTEP", this->es_.get().getUnits().from_si(Opm::UnitSystem::measure::time, duration));
 
+    this->schedWells_.refresh(this->sched_, sim_step, well_solution);
+
     const Evaluator::InputData input {
-        this->es_, this->sched_, this->grid_, this->regCache_, initial_inplace
+        this->es_, this->sched_, this->grid_, this->regCache_, initial_inplace,
+        this->schedWells_
     };
 
     const Evaluator::SimulatorResults simRes {
@@ -5125,16 +5399,95 @@ eval(const int                              sim_step,
         region_values, block_values, aquifer_values, interreg_flows
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    if (this->parallelEval_) {
+        this->evalPartitioned(sim_step, duration, input, simRes, st);
+    }
+    else {
+        for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
+            evalPtr->update(sim_step, duration, input, simRes, st);
+        }
+
+        for (auto& [_, evalPtr] : this->extra_parameters) {
+            (void)_;
+            evalPtr->update(sim_step, duration, input, simRes, st);
+        }
+    }
+
+    st.update_elapsed(duration);
+}
+
+void Opm::out::Summary::SummaryImplementation::bindKeys(const SummaryState& st)
+{
+    if (this->keyScope_ == st.key_scope()) {
+        return;
+    }
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators()) {
+        evalPtr->bind(st);
     }
 
     for (auto& [_, evalPtr] : this->extra_parameters) {
         (void)_;
-        evalPtr->update(sim_step, duration, input, simRes, st);
+        evalPtr->bind(st);
     }
 
-    st.update_elapsed(duration);
+    this->keyScope_ = st.key_scope();
+}
+
+void Opm::out::Summary::SummaryImplementation::bindValueKeys(const SummaryState& st)
+{
+    if (this->valueKeyScope_ == st.key_scope()) {
+        return;
+    }
+
+    this->valueKeyIds_.clear();
+    std::transform(this->valueKeys_.begin(), this->valueKeys_.end(),
+                   std::back_inserter(this->valueKeyIds_),
+                   [&st](const std::string& key)
+                   { return st.key_id(key); });
+
+    this->valueKeyScope_ = st.key_scope();
+}
+
+void
+Opm::out::Summary::SummaryImplementation::
+evalPartitioned(const int                          sim_step,
+                const double                       duration,
+                const Evaluator::InputData&        input,
+                const Evaluator::SimulatorResults& simRes,
+                SummaryState&                      st) const
+{
+    // Partitions are processed in the same order as the sequential
+    // evaluation, and each partition is merged into the SummaryState
+    // before the next one is evaluated.  Within a partition, evaluators
+    // only read values from the SummaryState which are not written by the
+    // partition itself.
+    for (auto& partition : this->partitions_) {
+        if (partition.serial != nullptr) {
+            partition.serial->update(sim_step, duration, input, simRes, st);
+            continue;
+        }
+
+        parallelWithSequentialFallback
+            (partition.evaluators.size(), 64,
+             [&](const std::size_t i)
+             {
+                 partition.values[i] = partition.evaluators[i]
+                     ->evaluate(sim_step, duration, input, simRes, st);
+             },
+
+             [&](const std::size_t i, const bool failed)
+             {
+                 const auto* evaluator = partition.evaluators[i];
+
+                 if (failed) {
+                     evaluator->update(sim_step, duration, input, simRes, st);
+                 }
+                 else if (partition.values[i].has_value()) {
+                     st.update_value(evaluator->key(), *partition.values[i]);
+                 }
+             });
+    }
 }
 
 void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary)
@@ -5162,7 +5515,7 @@ void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary
         for (auto i = 0*this->numUnwritten_; i < this->numUnwritten_; ++i) {
             this->esmry_->write(this->unwritten_[i].params,
                                 this->unwritten_[i].seq,
-                                is_final_summary);
+                                is_final_summary && (i + 1 == this->numUnwritten_));
         }
     }
 
@@ -5440,6 +5793,48 @@ configureUDQ(const EclipseState& es,
     }
 }
 
+void Opm::out::Summary::SummaryImplementation::configureEvalPartitions()
+{
+    // Keep the sequential evaluation order--i.e., SummaryConfig order
+    // followed by the extra parameters--since some vectors use values
+    // computed earlier in the same step.  ROEW, for instance, uses the
+    // current step's COPT values, which SummaryConfig places ahead of
+    // it.  See roew().
+    auto addEvaluator = [this](const Evaluator::Base* evaluator)
+    {
+        const auto* single = dynamic_cast<const Evaluator::SingleValue*>(evaluator);
+
+        if (single == nullptr) {
+            // Time vectors and the like.  Cheap, and might not be
+            // independent of one another.
+            this->partitions_.emplace_back().serial = evaluator;
+            return;
+        }
+
+        if (this->partitions_.empty() ||
+            (this->partitions_.back().serial != nullptr) ||
+            (this->partitions_.back().evaluators.front()->category() != single->category()))
+        {
+            this->partitions_.emplace_back();
+        }
+
+        this->partitions_.back().evaluators.push_back(single);
+    };
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators()) {
+        addEvaluator(evalPtr.get());
+    }
+
+    for (const auto& [_, evalPtr] : this->extra_parameters) {
+        (void)_;
+        addEvaluator(evalPtr.get());
+    }
+
+    for (auto& partition : this->partitions_) {
+        partition.values.resize(partition.evaluators.size());
+    }
+}
+
 void
 Opm::out::Summary::SummaryImplementation::
 configureRequiredRestartParameters(const SummaryConfig& sumcfg,
@@ -5568,8 +5963,10 @@ Summary::Summary(SummaryConfig&       sumcfg,
                  const EclipseGrid&   grid,
                  const Schedule&      sched,
                  const std::string&   basename,
-                 const bool           writeEsmry)
-    : pImpl_ { std::make_unique<SummaryImplementation>(sumcfg, es, grid, sched, basename, writeEsmry) }
+                 const bool           writeEsmry,
+                 const bool           compressEsmry)
+    : pImpl_ { std::make_unique<SummaryImplementation>(sumcfg, es, grid, sched, basename,
+                                                       writeEsmry, compressEsmry) }
 {}
 
 void Summary::eval(SummaryState&                          st,
@@ -5620,6 +6017,11 @@ void Summary::write(const bool is_final_summary) const
     this->pImpl_->write(is_final_summary);
 }
 
+void Summary::set_parallel_eval(const bool parallel)
+{
+    this->pImpl_->set_parallel_eval(parallel);
+}
+
 Summary::~Summary() {}
 
 } // namespace Opm::out
@@ -105,12 +105,17 @@ public:
     /// especially if the user only needs to view a small number of vectors.
     /// On the other hand, ESMRY files typically require more memory while
     /// writing.
+    ///
+    /// \param[in] compressEsmry Whether or not to convert the .ESMRY file
+    /// to the smaller, compressed column layout once the final summary is
+    /// written.  Ignored unless \p writeEsmry is set.
     Summary(SummaryConfig&      sumcfg,
             const EclipseState& es,
             const EclipseGrid&  grid,
             const Schedule&     sched,
             const std::string&  basename = "",
-            const bool          writeEsmry = false);
+            const bool          writeEsmry = false,
+            const bool          compressEsmry = false);
 
     /// Destructor.
     ///
@@ -119,6 +124,9 @@ public:
 
     /// Linearise summary values into internal buffer for output purposes.
     ///
+    /// Shares no state with eval(), so add_timestep() and write() may run
+    /// on one thread while eval() runs on another.
+    ///
     /// \param[in] st Summary values from most recent call to eval().
     /// Source object from which to retrieve the values that go into the
     /// output buffer.
@@ -209,6 +217,19 @@ public:
     /// ESMRY file output containing all summary vector values.
     void write(const bool is_final_summary = false) const;
 
+    /// Select serial or parallel evaluation of summary vectors.
+    ///
+    /// In parallel mode, eval() computes the values of all vectors of a
+    /// single category--e.g., all connection level vectors--concurrently
+    /// using OpenMP threads, and stores those values in the SummaryState
+    /// once the whole category has been evaluated.  Summary vector values
+    /// are the same in both modes.  Parallel mode is mainly useful in
+    /// models with many connection or segment level vectors.
+    ///
+    /// \param[in] parallel Whether or not to evaluate summary vectors in
+    /// parallel.  Serial evaluation is the default.
+    void set_parallel_eval(const bool parallel);
+
 private:
     /// Implementation type.
     class SummaryImplementation;
@@ -2,6 +2,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 #include <pybind11/chrono.h>
+#include <cstring>
 #include <filesystem>
 #include <stdexcept>
 
@@ -11,6 +12,7 @@
 #include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/ExtESmry.hpp>
 #include <opm/io/eclipse/EGrid.hpp>
+#include <opm/io/eclipse/EnsembleSummary.hpp>
 #include <opm/io/eclipse/ERft.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/common/utility/TimeService.hpp>
@@ -54,12 +56,12 @@ public:
             return m_ext_esmry->hasKey(key);
     }
 
-    void make_esmry_file()
+    void make_esmry_file(const bool compressed)
     {
         if (m_esmry == nullptr)
             throw std::invalid_argument("make_esmry_file only available for SMSPEC input files");
 
-        m_esmry->make_esmry_file();
+        m_esmry->make_esmry_file(compressed);
     }
 
     size_t numberOfTimeSteps()
@@ -169,6 +171,78 @@ private:
 
 
 
+class EnsembleSummaryBind {
+
+public:
+
+    EnsembleSummaryBind(const std::vector<std::string>& filenames, int threads)
+        : m_ensemble(filenames, threads)
+    {}
+
+    std::size_t numberOfCases() const { return m_ensemble.numberOfCases(); }
+    std::vector<std::string> caseFiles() const { return m_ensemble.caseFiles(); }
+    bool hasKey(const std::string& key) const { return m_ensemble.hasKey(key); }
+
+    const std::vector<std::string>& keywordList() const
+    {
+        return m_ensemble.keywordList();
+    }
+
+    // See ESmryBind::dates() regarding local time.
+    std::vector<time_point> dates() const
+    {
+        const auto& times = m_ensemble.reportDates();
+
+        std::vector<time_point> result;
+        result.reserve(times.size());
+
+        for (const auto& t : times) {
+            auto utc_time_t   = std::chrono::system_clock::to_time_t(t);
+            auto utc_ts       = Opm::TimeStampUTC(utc_time_t);
+            auto local_time_t = Opm::asLocalTimeT(utc_ts);
+            result.push_back(TimeService::from_time_t(local_time_t));
+        }
+
+        return result;
+    }
+
+    py::array_t<float> get(const std::string& key) const
+    {
+        return numpy_matrix(m_ensemble.get(key));
+    }
+
+    py::array_t<float> get_at_dates(const std::string& key, const std::vector<time_point>& dates) const
+    {
+        std::vector<time_point> utc_dates;
+        utc_dates.reserve(dates.size());
+
+        for (const auto& d : dates) {
+            auto local_time_t = std::chrono::system_clock::to_time_t(d);
+            std::tm* local_tm = std::localtime(&local_time_t);
+
+            auto utc_ts = Opm::TimeStampUTC({ local_tm->tm_year + 1900, local_tm->tm_mon + 1, local_tm->tm_mday },
+                                            local_tm->tm_hour, local_tm->tm_min, local_tm->tm_sec, 0);
+
+            utc_dates.push_back(Opm::asTimePoint(utc_ts));
+        }
+
+        return numpy_matrix(m_ensemble.get(key, utc_dates));
+    }
+
+private:
+    Opm::EclIO::EnsembleSummary m_ensemble;
+
+    static py::array_t<float> numpy_matrix(const Opm::EclIO::EnsembleSummary::Matrix& matrix)
+    {
+        auto output = py::array_t<float>({ matrix.numTimes, matrix.numCases });
+
+        if (! matrix.values.empty())
+            std::memcpy(output.request().ptr, matrix.values.data(), matrix.values.size() * sizeof(float));
+
+        return output;
+    }
+};
+
 class EclOutputBind {
 
 public:
@@ -263,6 +337,164 @@ npArray get_vector_occurrence(Opm::EclIO::EclFile * file_ptr, const std::string&
     return get_vector_index(file_ptr, array_index);
 }
 
+// Numeric arrays are stored in records of at most 1000 elements, each
+// enclosed by a pair of record markers.  Views of mapped arrays are
+// big-endian numpy arrays, regardless of the array's size.
+constexpr std::size_t mapped_record_size = 1000;
+
+template <typename T>
+py::capsule mapped_base(const Opm::EclIO::EclFile::ArrayView<T>& view)
+{
+    using View = Opm::EclIO::EclFile::ArrayView<T>;
+
+    auto* keep_alive = new View(view);
+    return py::capsule(keep_alive, [](void* v) { delete static_cast<View*>(v); });
+}
+
+py::array read_only(py::array array)
+{
+    array.attr("flags").attr("writeable") = false;
+    return array;
+}
+
+// Single record arrays refer directly to the mapped file.  Larger arrays
+// are interrupted by record markers and are therefore returned as
+// contiguous copies of the raw big-endian records.
+template <typename T>
+py::array mapped_array(const Opm::EclIO::EclFile::ArrayView<T>& view, const char* be_format)
+{
+    if (view.numRecords() == 1) {
+        return read_only(py::array(py::dtype(be_format), { view.size() }, { sizeof(T) },
+                                   view.recordData(0), mapped_base(view)));
+    }
+
+    auto array = py::array(py::dtype(be_format), { view.size() });
+    auto* dest = static_cast<char*>(array.mutable_data());
+
+    for (std::size_t rec = 0; rec < view.numRecords(); ++rec) {
+        const auto nbytes = view.recordSize(rec) * sizeof(T);
+
+        std::memcpy(dest, view.recordData(rec), nbytes);
+        dest += nbytes;
+    }
+
+    return read_only(array);
+}
+
+// Zero-copy view of all records.  The full records form a records x 1000
+// array whose row stride includes the record markers, and the elements of
+// a final, partial, record form a separate one-dimensional array.
+template <typename T>
+std::tuple<py::array, py::array>
+mapped_records(const Opm::EclIO::EclFile::ArrayView<T>& view, const char* be_format)
+{
+    const auto num_full = view.size() / mapped_record_size;
+    const auto tail_size = view.size() % mapped_record_size;
+
+    if (view.empty()) {
+        return { read_only(py::array(py::dtype(be_format), { std::size_t{0}, mapped_record_size })),
+                 read_only(py::array(py::dtype(be_format), { std::size_t{0} })) };
+    }
+
+    const auto base = mapped_base(view);
+
+    const auto row_stride = (view.numRecords() > 1)
+        ? static_cast<py::ssize_t>(view.recordData(1) - view.recordData(0))
+        : static_cast<py::ssize_t>(mapped_record_size * sizeof(T) + 2 * sizeof(int));
+
+    auto records = (num_full > 0)
+        ? py::array(py::dtype(be_format), { num_full, mapped_record_size },
+                    { row_stride, static_cast<py::ssize_t>(sizeof(T)) },
+                    view.recordData(0), base)
+        : py::array(py::dtype(be_format), { std::size_t{0}, mapped_record_size });
+
+    auto tail = (tail_size > 0)
+        ? py::array(py::dtype(be_format), { tail_size }, { sizeof(T) },
+                    view.recordData(num_full), base)
+        : py::array(py::dtype(be_format), { std::size_t{0} });
+
+    return { read_only(records), read_only(tail) };
+}
+
+npArray get_view_index(const Opm::EclIO::EclFile * file_ptr, std::size_t array_index)
+{
+    auto array_type = std::get<1>(file_ptr->getList()[array_index]);
+
+    if (array_type == Opm::EclIO::INTE)
+        return std::make_tuple (mapped_array(file_ptr->view<int>(array_index), ">i4"), array_type);
+
+    if (array_type == Opm::EclIO::REAL)
+        return std::make_tuple (mapped_array(file_ptr->view<float>(array_index), ">f4"), array_type);
+
+    if (array_type == Opm::EclIO::DOUB)
+        return std::make_tuple (mapped_array(file_ptr->view<double>(array_index), ">f8"), array_type);
+
+    throw std::logic_error("Array views only support INTE, REAL and DOUB arrays");
+}
+
+npArray get_view_name(const Opm::EclIO::EclFile * file_ptr, const std::string& array_name)
+{
+    if (file_ptr->hasKey(array_name) == false)
+        throw std::logic_error("Array " + array_name + " not found in EclFile");
+
+    auto array_list = file_ptr->getList();
+    size_t array_index = get_array_index(array_list, array_name, 0);
+
+    return get_view_index(file_ptr, array_index);
+}
+
+npArray get_view_occurrence(const Opm::EclIO::EclFile * file_ptr, const std::string& array_name, size_t occurrence)
+{
+    if (occurrence >= file_ptr->count(array_name) )
+        throw std::logic_error("Occurrence " + std::to_string(occurrence) + " not found in EclFile");
+
+    auto array_list = file_ptr->getList();
+    size_t array_index = get_array_index(array_list, array_name, occurrence);
+
+    return get_view_index(file_ptr, array_index);
+}
+
+std::tuple<py::array, py::array>
+get_record_view_index(const Opm::EclIO::EclFile * file_ptr, std::size_t array_index)
+{
+    auto array_type = std::get<1>(file_ptr->getList()[array_index]);
+
+    if (array_type == Opm::EclIO::INTE)
+        return mapped_records(file_ptr->view<int>(array_index), ">i4");
+
+    if (array_type == Opm::EclIO::REAL)
+        return mapped_records(file_ptr->view<float>(array_index), ">f4");
+
+    if (array_type == Opm::EclIO::DOUB)
+        return mapped_records(file_ptr->view<double>(array_index), ">f8");
+
+    throw std::logic_error("Array views only support INTE, REAL and DOUB arrays");
+}
+
+std::tuple<py::array, py::array>
+get_record_view_name(const Opm::EclIO::EclFile * file_ptr, const std::string& array_name)
+{
+    if (file_ptr->hasKey(array_name) == false)
+        throw std::logic_error("Array " + array_name + " not found in EclFile");
+
+    auto array_list = file_ptr->getList();
+    size_t array_index = get_array_index(array_list, array_name, 0);
+
+    return get_record_view_index(file_ptr, array_index);
+}
+
+std::tuple<py::array, py::array>
+get_record_view_occurrence(const Opm::EclIO::EclFile * file_ptr, const std::string& array_name, size_t occurrence)
+{
+    if (occurrence >= file_ptr->count(array_name) )
+        throw std::logic_error("Occurrence " + std::to_string(occurrence) + " not found in EclFile");
+
+    auto array_list = file_ptr->getList();
+    size_t array_index = get_array_index(array_list, array_name, occurrence);
+
+    return get_record_view_index(file_ptr, array_index);
+}
+
 bool erst_contains(Opm::EclIO::ERst * file_ptr, std::tuple<std::string, int> keyword)
 {
     bool hasKeyAtReport = file_ptr->occurrence_count(std::get<0>(keyword), std::get<1>(keyword)) > 0 ? true : false;
@@ -467,14 +699,23 @@ void python::common::export_IO(py::module& m) {
         .export_values();
 
     py::class_<Opm::EclIO::EclFile>(m, "EclFile", EclFile_docstring)
-        .def(py::init<const std::string &, bool>(), py::arg("filename"), py::arg("preload") = false, EclFile_init_docstring)
+        .def(py::init([](const std::string& filename, bool preload, bool memory_map) {
+                return std::make_unique<Opm::EclIO::EclFile>(filename, Opm::EclIO::EclFile::MemoryMapped{memory_map}, preload);
+            }), py::arg("filename"), py::arg("preload") = false, py::arg("memory_map") = false, EclFile_init_docstring)
+        .def_property_readonly("memory_mapped", &Opm::EclIO::EclFile::memoryMapped, EclFile_memory_mapped_docstring)
         .def_property_readonly("arrays", &Opm::EclIO::EclFile::getList, EclFile_arrays_docstring)
         .def("__contains__", &Opm::EclIO::EclFile::hasKey, py::arg("name"), EclFile_contains_docstring)
         .def("__len__", &Opm::EclIO::EclFile::size, EclFile_len_docstring)
         .def("count", &Opm::EclIO::EclFile::count, py::arg("name"), EclFile_count_docstring)
         .def("__get_data", &get_vector_index, py::arg("index"), EclFile_get_data_index_docstring)
         .def("__get_data", &get_vector_name, py::arg("name"), EclFile_get_data_name_docstring)
-        .def("__get_data", &get_vector_occurrence, py::arg("name"), py::arg("occurrence"), EclFile_get_data_occurrence_docstring);
+        .def("__get_data", &get_vector_occurrence, py::arg("name"), py::arg("occurrence"), EclFile_get_data_occurrence_docstring)
+        .def("__get_view", &get_view_index, py::arg("index"), EclFile_get_view_index_docstring)
+        .def("__get_view", &get_view_name, py::arg("name"), EclFile_get_view_name_docstring)
+        .def("__get_view", &get_view_occurrence, py::arg("name"), py::arg("occurrence"), EclFile_get_view_occurrence_docstring)
+        .def("__get_record_view", &get_record_view_index, py::arg("index"), EclFile_get_record_view_index_docstring)
+        .def("__get_record_view", &get_record_view_name, py::arg("name"), EclFile_get_record_view_name_docstring)
+        .def("__get_record_view", &get_record_view_occurrence, py::arg("name"), py::arg("occurrence"), EclFile_get_record_view_occurrence_docstring);
 
     py::class_<Opm::EclIO::ERst>(m, "ERst", ERst_docstring)
         .def(py::init<const std::string &>(), py::arg("filename"), ERst_init_docstring)
@@ -495,7 +736,7 @@ void python::common::export_IO(py::module& m) {
    py::class_<ESmryBind>(m, "ESmry", ESmry_docstring)
         .def(py::init<const std::string &, const bool>(), py::arg("filename"), py::arg("load_base_run") = false, ESmry_init_docstring)
         .def("__contains__", &ESmryBind::hasKey, py::arg("key"), ESmry_contains_docstring)
-        .def("make_esmry_file", &ESmryBind::make_esmry_file, ESmry_make_esmry_file_docstring)
+        .def("make_esmry_file", &ESmryBind::make_esmry_file, py::arg("compressed") = false, ESmry_make_esmry_file_docstring)
         .def("__len__", &ESmryBind::numberOfTimeSteps, ESmry_len_docstring)
         .def("__get_all", &ESmryBind::get_smry_vector, py::arg("key"), ESmry_get_all_docstring)
         .def("__get_at_rstep", &ESmryBind::get_smry_vector_at_rsteps, py::arg("key"), ESmry_get_at_rstep_docstring)
@@ -507,6 +748,16 @@ void python::common::export_IO(py::module& m) {
         .def("dates", &ESmryBind::dates, ESmry_dates_docstring)
         .def("units", &ESmryBind::units, py::arg("field"), ESmry_units_docstring);
 
+   py::class_<EnsembleSummaryBind>(m, "EnsembleSummary", EnsembleSummary_docstring)
+        .def(py::init<const std::vector<std::string>&, int>(), py::arg("filenames"), py::arg("threads") = 0, EnsembleSummary_init_docstring)
+        .def("__contains__", &EnsembleSummaryBind::hasKey, py::arg("key"), EnsembleSummary_contains_docstring)
+        .def("__len__", &EnsembleSummaryBind::numberOfCases, EnsembleSummary_len_docstring)
+        .def("__getitem__", &EnsembleSummaryBind::get, py::arg("key"), EnsembleSummary_getitem_docstring)
+        .def("get", &EnsembleSummaryBind::get_at_dates, py::arg("key"), py::arg("dates"), EnsembleSummary_get_docstring)
+        .def_property_readonly("case_files", &EnsembleSummaryBind::caseFiles, EnsembleSummary_case_files_docstring)
+        .def("keys", &EnsembleSummaryBind::keywordList, EnsembleSummary_keys_docstring)
+        .def("dates", &EnsembleSummaryBind::dates, EnsembleSummary_dates_docstring);
+
    py::class_<Opm::EclIO::EGrid>(m, "EGrid", EGrid_docstring)
         .def(py::init<const std::string &, const std::string &>(), py::arg("filename"), py::arg("grid_name") = "global", EGrid_init_docstring)
         .def_property_readonly("active_cells", &Opm::EclIO::EGrid::activeCells, EGrid_active_cells_docstring)
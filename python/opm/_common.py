@@ -26,6 +26,7 @@ from .opmcommon_python import SummaryConfig
 from .opmcommon_python import EclFile, eclArrType
 from .opmcommon_python import ERst
 from .opmcommon_python import ESmry
+from .opmcommon_python import EnsembleSummary
 from .opmcommon_python import EGrid
 from .opmcommon_python import ERft
 from .opmcommon_python import EclOutput
@@ -2,6 +2,7 @@ from opm._common import eclArrType
 from opm._common import EclFile
 from opm._common import ERst
 from opm._common import ESmry
+from opm._common import EnsembleSummary
 from opm._common import EGrid
 from opm._common import ERft
 from opm._common import EclOutput
@@ -29,6 +30,30 @@ def getitem_eclfile(self, arg):
     return data
 
 
+def view_eclfile(self, arg, occurrence=None):
+
+    if isinstance(arg, tuple):
+        arg, occurrence = arg
+
+    if occurrence is not None:
+        data, array_type = self.__get_view(str(arg), int(occurrence))
+    else:
+        data, array_type = self.__get_view(arg)
+
+    return data
+
+
+def view_records_eclfile(self, arg, occurrence=None):
+
+    if isinstance(arg, tuple):
+        arg, occurrence = arg
+
+    if occurrence is not None:
+        return self.__get_record_view(str(arg), int(occurrence))
+
+    return self.__get_record_view(arg)
+
+
 def getitem_erst(self, arg):
 
     if not isinstance(arg, tuple):
@@ -188,6 +213,8 @@ def ecloutput_write(self, name, array, C0nn=False):
 
 
 setattr(EclFile, "__getitem__", getitem_eclfile)
+setattr(EclFile, "view", view_eclfile)
+setattr(EclFile, "view_records", view_records_eclfile)
 
 setattr(ERst, "__contains__", contains_erst)
 setattr(ERst, "__getitem__", getitem_erst)
@@ -2599,11 +2599,22 @@ class ESmry:
     def keys(self) -> List[str]: ...
     @overload
     def keys(self, pattern: str) -> List[str]: ...
-    def make_esmry_file(self) -> None: ...
+    def make_esmry_file(self, compressed: bool = False) -> None: ...
     def units(self, field: str) -> str: ...
     def __contains__(self, key: str) -> bool: ...
     def __len__(self) -> int: ...
 
+class EnsembleSummary:
+    def __init__(self, filenames: List[str], threads: int = ...) -> None: ...
+    def __getitem__(self, key: str) -> numpy.ndarray: ...
+    def get(self, key: str, dates: List[datetime.datetime]) -> numpy.ndarray: ...
+    def dates(self) -> List[datetime.datetime]: ...
+    def keys(self) -> List[str]: ...
+    def __contains__(self, key: str) -> bool: ...
+    def __len__(self) -> int: ...
+    @property
+    def case_files(self) -> List[str]: ...
+
 class EclFile:
     def __init__(self, filename: str, preload: bool = ...) -> None: ...
     @overload
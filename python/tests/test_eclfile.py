@@ -184,6 +184,47 @@ class TestEclFile(unittest.TestCase):
         self.assertEqual(file1.count("XXXX"), 0)
 
 
+    def test_memory_mapped_view(self):
+
+        file1 = EclFile(test_path("data/SPE9.UNRST"))
+        file2 = EclFile(test_path("data/SPE9.UNRST"), memory_map=True)
+
+        self.assertFalse(file1.memory_mapped)
+        self.assertTrue(file2.memory_mapped)
+
+        with self.assertRaises(RuntimeError):
+            file1.view("PRESSURE")
+
+        # Single record arrays refer directly to the mapped file
+        intehead = file2.view("INTEHEAD")
+        self.assertFalse(intehead.flags.writeable)
+        self.assertTrue(np.array_equal(intehead, file1["INTEHEAD"]))
+
+        pres2 = file2.view("PRESSURE", 1)
+        self.assertFalse(pres2.flags.writeable)
+        self.assertEqual(len(pres2), 9000)
+        self.assertTrue(np.array_equal(pres2, file1["PRESSURE", 1]))
+
+        self.assertTrue(np.array_equal(file2["PRESSURE", 1], pres2))
+
+        # Same big-endian dtype regardless of the number of records
+        self.assertEqual(intehead.dtype, np.dtype(">i4"))
+        self.assertEqual(pres2.dtype, np.dtype(">f4"))
+
+        # Zero-copy view of all records
+        records, tail = file2.view_records("PRESSURE", 1)
+        self.assertFalse(records.flags.writeable)
+        self.assertEqual(records.shape, (9, 1000))
+        self.assertEqual(records.dtype, np.dtype(">f4"))
+        self.assertEqual(records.strides, (4008, 4))
+        self.assertEqual(len(tail), 0)
+        self.assertTrue(np.array_equal(records.ravel(), file1["PRESSURE", 1]))
+
+        records, tail = file2.view_records("INTEHEAD")
+        self.assertEqual(records.shape, (0, 1000))
+        self.assertTrue(np.array_equal(tail, file1["INTEHEAD"]))
+
+
 if __name__ == "__main__":
 
     unittest.main()
@@ -1,10 +1,12 @@
+import os
+import shutil
 import unittest
 import sys
 import numpy as np
 import datetime
 
-from opm.io.ecl import ESmry
-from .utils import test_path
+from opm.io.ecl import ESmry, EnsembleSummary
+from .utils import test_path, tmp
 
 
 class TestEclFile(unittest.TestCase):
@@ -225,6 +227,59 @@ class TestEclFile(unittest.TestCase):
             self.assertEqual(key, ref)
 
 
+    def test_compressed_esmry(self):
+
+        with tmp():
+            for ext in ("SMSPEC", "UNSMRY"):
+                shutil.copy(test_path("data/SPE1CASE1.{}".format(ext)), os.getcwd())
+
+            smry1 = ESmry("SPE1CASE1.SMSPEC")
+            smry1.make_esmry_file(compressed=True)
+
+            extsmry1 = ESmry("SPE1CASE1.ESMRY")
+
+            self.assertEqual(len(extsmry1), len(smry1))
+            self.assertEqual(extsmry1.keys(), smry1.keys())
+            self.assertEqual(extsmry1.units("FGOR"), "STB/MSCF")
+
+            for key in ("TIME", "FOPR", "BPR:10,10,3", "WGPR:PROD"):
+                self.assertTrue(np.array_equal(extsmry1[key], smry1[key]))
+                self.assertTrue(np.array_equal(extsmry1[key, True], smry1[key, True]))
+
+    def test_ensemble_summary(self):
+
+        with tmp():
+            cases = []
+            for real in ("R0", "R1"):
+                os.mkdir(real)
+                for ext in ("SMSPEC", "UNSMRY"):
+                    shutil.copy(test_path("data/SPE1CASE1.{}".format(ext)), real)
+
+                cases.append(os.path.join(real, "SPE1CASE1.SMSPEC"))
+
+            smry = ESmry(cases[0])
+            ens = EnsembleSummary(cases, threads=2)
+
+            self.assertEqual(len(ens), 2)
+            self.assertEqual(ens.case_files, cases)
+            self.assertEqual(ens.keys(), sorted(smry.keys()))
+            self.assertTrue("FOPT" in ens)
+            self.assertFalse("XXXX" in ens)
+            self.assertEqual(len(ens.dates()), len(smry["TIME", True]))
+
+            fopt = ens["FOPT"]
+            self.assertEqual(fopt.shape, (len(ens.dates()), 2))
+            self.assertTrue(np.array_equal(fopt[:, 0], smry["FOPT", True]))
+            self.assertTrue(np.array_equal(fopt[:, 0], fopt[:, 1]))
+
+            fopr = ens.get("FOPR", smry.dates()[:3])
+            self.assertEqual(fopr.shape, (3, 2))
+            self.assertTrue(np.array_equal(fopr[:, 1], smry["FOPR"][:3]))
+
+            with self.assertRaises(ValueError):
+                ens["XXXX"]
+
+
 
 if __name__ == "__main__":
 
@@ -37,6 +37,7 @@
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/IntervalTabulated2DFunction.hpp>
+#include <opm/material/densead/Math.hpp>
 
 #include <memory>
 #include <cmath>
@@ -335,6 +336,93 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunction2, Scalar, Types)
                                     1e-2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunctionBatch, Scalar, Types)
+{
+    Test<Scalar> test;
+    auto uniformXTab = test.createUniformXTabulatedFunction2(test.testFn3);
+
+    // a mix of ordered and unordered points, including extrapolation
+    std::vector<Scalar> x, y;
+    for (unsigned k = 0; k < 200; ++k) {
+        x.push_back(-2.5 + 6.0*Scalar(k)/199);
+        y.push_back(-4.5 + 10.0*Scalar((k*37) % 200)/199);
+    }
+    x.push_back(3.0);
+    y.push_back(5.0);
+    x.push_back(-2.0);
+    y.push_back(-4.0);
+
+    std::vector<Scalar> result;
+    uniformXTab.evalBatch(x, y, result, /*extrapolate=*/true);
+    BOOST_REQUIRE_EQUAL(result.size(), x.size());
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        BOOST_CHECK_EQUAL(result[k], uniformXTab.eval(x[k], y[k], /*extrapolate=*/true));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UniformXTabulatedFunctionBatchSegment)
+{
+    // with three columns, a point on the middle column belongs to the first
+    // segment even if the previous point was in the last one.  the segments
+    // have different slopes, so the derivative tells them apart.
+    using Scalar = double;
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 1>;
+
+    Opm::UniformXTabulated2DFunction<Scalar>
+        tab(Opm::UniformXTabulated2DFunction<Scalar>::InterpolationPolicy::LeftExtreme);
+
+    for (unsigned i = 0; i < 3; ++i) {
+        tab.appendXPos(Scalar(i));
+        for (unsigned j = 0; j < 3; ++j) {
+            tab.appendSamplePoint(i, Scalar(j), Scalar(i*i) + Scalar(3*j));
+        }
+    }
+
+    BOOST_CHECK_EQUAL(tab.xSegmentIndex(Scalar(1.0)), 0u);
+
+    std::vector<Eval> x, y;
+    for (const Scalar xk : {1.5, 1.0, 0.5, 1.0}) {
+        x.push_back(Eval::createVariable(xk, 0));
+        y.push_back(Eval(1.5));
+    }
+
+    std::vector<Eval> result;
+    tab.evalBatch(x, y, result);
+    BOOST_REQUIRE_EQUAL(result.size(), x.size());
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        const auto expected = tab.eval(x[k], y[k]);
+        BOOST_CHECK_EQUAL(result[k].value(), expected.value());
+        BOOST_CHECK_EQUAL(result[k].derivative(0), expected.derivative(0));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunctionSamples, Scalar, Types)
+{
+    using Table = Opm::UniformXTabulated2DFunction<Scalar>;
+
+    Test<Scalar> test;
+    const auto uniformXTab = test.createUniformXTabulatedFunction2(test.testFn3);
+
+    // extend columns at both ends after all columns exist
+    auto extended = uniformXTab;
+    extended.appendSamplePoint(1, extended.yMax(1) + 1.0, 3.0);
+    extended.appendSamplePoint(0, extended.yMin(0) - 1.0, 2.0);
+
+    BOOST_CHECK_EQUAL(extended.numY(0), uniformXTab.numY(0) + 1);
+    BOOST_CHECK_EQUAL(extended.numY(1), uniformXTab.numY(1) + 1);
+    BOOST_CHECK_EQUAL(extended.valueAt(0, 0), 2.0);
+    BOOST_CHECK_EQUAL(extended.valueAt(1, extended.numY(1) - 1), 3.0);
+    BOOST_CHECK_EQUAL(extended.yAt(2, 0), uniformXTab.yAt(2, 0));
+
+    for (const Table& tab : {uniformXTab, extended}) {
+        const Table copy(tab.xPos(), tab.yPos(), tab.samples(), tab.interpolationGuide());
+        BOOST_CHECK(copy == tab);
+        BOOST_CHECK(copy.samples() == tab.samples());
+    }
+
+    BOOST_CHECK(!(extended == uniformXTab));
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction1, Scalar, Types)
 {
     Test<Scalar> test;
@@ -292,4 +292,42 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantCompressibilityWater, Scalar, Types)
                         refTmp << ". (is " << tmp << ")");
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(SaturationPressureInverse, Scalar, Types)
+{
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 1>;
+    constexpr Scalar tolerance = std::numeric_limits<Scalar>::epsilon()*1e4;
+
+    // increasing Rs(p) table
+    Opm::LiveOilPvt<Scalar> liveOilPvt;
+    liveOilPvt.setNumRegions(1);
+    liveOilPvt.setSaturatedOilGasDissolutionFactor(0, {{1e5, 1.0}, {50e5, 20.0},
+                                                       {100e5, 50.0}, {200e5, 90.0}});
+    const std::vector<std::pair<Scalar, Scalar>> satOil {{1e5, 1.0}, {50e5, 1.1},
+                                                         {100e5, 1.2}, {200e5, 1.3}};
+    liveOilPvt.setSaturatedOilFormationVolumeFactor(0, satOil);
+    liveOilPvt.setSaturatedOilViscosity(0, satOil);
+    liveOilPvt.initEnd();
+    BOOST_CHECK(liveOilPvt.saturationPressureIsExact(0));
+
+    for (const Scalar p : {Scalar{1e5}, Scalar{25e5}, Scalar{100e5}, Scalar{150e5}, Scalar{250e5}}) {
+        const Eval Rs(liveOilPvt.saturatedGasDissolutionFactor(0, Scalar{300.0}, p), 0);
+        const Eval pSat = liveOilPvt.saturationPressure(0, Eval(300.0), Rs);
+        const Scalar dRsdp = liveOilPvt.saturatedGasDissolutionFactorTable()[0].evalDerivative(p, /*extrapolate=*/true);
+        BOOST_CHECK_CLOSE(pSat.value(), p, tolerance);
+        BOOST_CHECK_CLOSE(pSat.derivative(0), 1.0/dRsdp, tolerance);
+    }
+
+    // the saturation pressure is clamped to zero below the table
+    BOOST_CHECK_EQUAL(liveOilPvt.saturationPressure(0, Scalar{300.0}, Scalar{0.1}), 0.0);
+
+    // decreasing Rv(p) table (region 1 of PVTG)
+    Opm::WetGasPvt<Scalar> wetGasPvt;
+    wetGasPvt.initFromState(eclState, schedule);
+    BOOST_CHECK(wetGasPvt.saturationPressureIsExact(0));
+    for (const Scalar p : {Scalar{1e5}, Scalar{200e5}, Scalar{500e5}}) {
+        const Scalar Rv = wetGasPvt.saturatedOilVaporizationFactor(0, Scalar{300.0}, p);
+        BOOST_CHECK_CLOSE(wetGasPvt.saturationPressure(0, Scalar{300.0}, Rv), p, tolerance);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
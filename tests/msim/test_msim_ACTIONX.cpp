@@ -53,6 +53,7 @@
 #include <cstddef>
 #include <memory>
 #include <initializer_list>
+#include <map>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -309,6 +310,61 @@ BOOST_AUTO_TEST_CASE(WELL_CLOSE_EXAMPLE) {
     }
 }
 
+// ACTIONX blocks trigger at report steps 6 and 11 while earlier steps are
+// still queued for asynchronous output.  The result files must be the same
+// as in synchronous mode.
+BOOST_AUTO_TEST_CASE(WELL_CLOSE_EXAMPLE_ASYNC_OUTPUT) {
+#include "actionx1.include"
+
+    auto run = [&actionx1](const bool async)
+    {
+        test_data td(actionx1);
+        msim sim(td.state, td.schedule);
+
+        // Writer reads the Schedule object which the actions modify, as in
+        // a simulator.
+        WorkArea work_area("test_msim");
+        EclipseIO io(td.state, td.state.getInputGrid(), sim.schedule, td.summary_config);
+        io.setAsyncOutput(async, 8);
+
+        sim.well_rate("P1", data::Rates::opt::oil, prod_opr);
+        sim.well_rate("P2", data::Rates::opt::oil, prod_opr);
+        sim.well_rate("P3", data::Rates::opt::oil, prod_opr);
+        sim.well_rate("P4", data::Rates::opt::oil, prod_opr);
+
+        sim.well_rate("P1", data::Rates::opt::wat, prod_wpr_P1);
+        sim.well_rate("P2", data::Rates::opt::wat, prod_wpr_P2);
+        sim.well_rate("P3", data::Rates::opt::wat, prod_wpr_P3);
+        sim.well_rate("P4", data::Rates::opt::wat, prod_wpr_P4);
+
+        sim.run(io, false);
+        io.flushOutput();
+
+        BOOST_CHECK(sim.schedule.getWell("P2", 6).getStatus() == Well::Status::SHUT);
+        BOOST_CHECK(sim.schedule.getWell("P4", 11).getStatus() == Well::Status::SHUT);
+
+        const auto& base_name = td.state.getIOConfig().getBaseName();
+        const EclIO::ESmry ecl_sum(base_name + ".SMSPEC");
+
+        auto vectors = std::map<std::string, std::vector<float>>{};
+        for (const auto& key : ecl_sum.keywordList()) {
+            vectors.emplace(key, ecl_sum.get(key));
+        }
+
+        return vectors;
+    };
+
+    const auto sync = run(false);
+    const auto async = run(true);
+
+    BOOST_REQUIRE_EQUAL(async.size(), sync.size());
+    for (const auto& [key, values] : sync) {
+        const auto pos = async.find(key);
+        BOOST_REQUIRE_MESSAGE(pos != async.end(), "Missing " << key);
+        BOOST_CHECK_MESSAGE(pos->second == values, "Vector " << key << " differs");
+    }
+}
+
 BOOST_AUTO_TEST_CASE(UDQ_ASSIGN) {
 #include "actionx1.include"
 
@@ -1250,6 +1250,74 @@ END
     BOOST_CHECK(wellpi.empty());
 }
 
+BOOST_AUTO_TEST_CASE(Action_Reiterate_Converged)
+{
+    const auto deck_string = std::string{ R"(
+SCHEDULE
+
+WELSPECS
+    'PROD1' 'G1'  1 1 10 'OIL' /
+/
+
+GCONPROD
+'G1' 'ORAT' 100  /
+/
+
+ACTIONX
+'A' /
+WWCT 'OPX'     > 0.75 /
+/
+
+GCONPROD
+   'G1'  'ORAT' 200 /
+/
+
+ENDACTIO
+
+TSTEP
+10 /
+
+GCONPROD
+'G1' 'ORAT' 100  /
+/
+
+TSTEP
+10 10 10 /
+END
+)"};
+
+    const auto unit_system =  UnitSystem::newMETRIC();
+    const auto st = SummaryState{ TimeService::now(), 0.0 };
+    const auto oil_target = [&unit_system](const double rate)
+    {
+        return unit_system.to_si(UnitSystem::measure::liquid_surface_rate, rate);
+    };
+
+    Schedule sched = make_schedule(deck_string);
+    const auto num_steps = sched.size();
+    const auto& action1 = sched[0].actions.get()["A"];
+
+    const Action::Result action_result{true};
+    sched.applyAction(0, action1, action_result.matches(),
+                      std::unordered_map<std::string,double>{}, true);
+
+    // The second report step overrides the action, so the re-iteration
+    // converges to the original snapshots from report step 2 onwards.
+    BOOST_CHECK_EQUAL(sched.size(), num_steps);
+    BOOST_CHECK_CLOSE(sched.getGroup("G1", 0).productionControls(st).oil_target, oil_target(200), 1e-5);
+    for (std::size_t step = 1; step < sched.size(); ++step) {
+        BOOST_CHECK_CLOSE(sched.getGroup("G1", step).productionControls(st).oil_target, oil_target(100), 1e-5);
+        BOOST_CHECK_EQUAL(sched[step].sim_step(), step);
+    }
+
+    // Applying the action a second time at the same report step compares
+    // against the snapshots of the first application.
+    sched.applyAction(0, action1, action_result.matches(),
+                      std::unordered_map<std::string,double>{}, true);
+    BOOST_CHECK_EQUAL(sched.size(), num_steps);
+    BOOST_CHECK_CLOSE(sched.getGroup("G1", num_steps - 1).productionControls(st).oil_target, oil_target(100), 1e-5);
+}
+
 namespace {
 
 bool has_well(const std::vector<std::string>& wells,
@@ -2126,3 +2194,139 @@ BOOST_AUTO_TEST_CASE(Eval_RegionVector_In_Condition_Default_RegSet_2)
                             "Condition must be satisfied");
     }
 }
+
+BOOST_AUTO_TEST_CASE(TestMatchingWells_WellSetChanges)
+{
+    Action::AST ast({"WWCT", "OP*", ">", "0.5", "AND", "FOPR", ">", "100"});
+    SummaryState st(TimeService::now(), 0.0);
+    WListManager wlm;
+
+    st.update("FOPR", 200.0);
+    st.update_well_var("OP1", "WWCT", 0.7);
+    st.update_well_var("OP2", "WWCT", 0.2);
+    st.update_well_var("WI1", "WWCT", 0.9);
+
+    {
+        const auto res = ast.eval(Action::Context { st, wlm });
+        const auto wells = res.matches().wells().asVector();
+
+        BOOST_CHECK(res.conditionSatisfied());
+        BOOST_CHECK_EQUAL(wells.size(), 1U);
+        BOOST_CHECK_EQUAL(wells[0], "OP1");
+    }
+
+    // Value changes with the same set of wells.
+    st.update_well_var("OP2", "WWCT", 0.6);
+    {
+        const auto res = ast.eval(Action::Context { st, wlm });
+        const auto wells = res.matches().wells().asVector();
+
+        BOOST_CHECK(res.conditionSatisfied());
+        BOOST_CHECK_EQUAL(wells.size(), 2U);
+        BOOST_CHECK_EQUAL(std::count(wells.begin(), wells.end(), "OP2"), 1);
+    }
+
+    // New well matching the template.
+    st.update_well_var("OP3", "WWCT", 0.8);
+    {
+        const auto res = ast.eval(Action::Context { st, wlm });
+        const auto wells = res.matches().wells().asVector();
+
+        BOOST_CHECK(res.conditionSatisfied());
+        BOOST_CHECK_EQUAL(wells.size(), 3U);
+        BOOST_CHECK_EQUAL(std::count(wells.begin(), wells.end(), "OP3"), 1);
+        BOOST_CHECK_EQUAL(std::count(wells.begin(), wells.end(), "WI1"), 0);
+    }
+
+    // Well removed from the summary state.
+    st.erase_well_var("OP1", "WWCT");
+    {
+        const auto res = ast.eval(Action::Context { st, wlm });
+        const auto wells = res.matches().wells().asVector();
+
+        BOOST_CHECK(res.conditionSatisfied());
+        BOOST_CHECK_EQUAL(wells.size(), 2U);
+        BOOST_CHECK_EQUAL(std::count(wells.begin(), wells.end(), "OP1"), 0);
+    }
+
+    st.update("FOPR", 50.0);
+    {
+        const auto res = ast.eval(Action::Context { st, wlm });
+
+        BOOST_CHECK(! res.conditionSatisfied());
+        BOOST_CHECK(res.matches().wells().empty());
+    }
+
+    // Copies evaluate the same way as the original.
+    const auto copy = ast;
+    BOOST_CHECK(! copy.eval(Action::Context { st, wlm }).conditionSatisfied());
+}
+
+BOOST_AUTO_TEST_CASE(TestMatchingWells_SharedCache)
+{
+    Action::AST ast({"WWCT", "OP*", ">", "0.5", "OR", "WWCT", "*INJ", ">", "0.5", "OR", "FOPR", ">", "100"});
+    SummaryState st(TimeService::now(), 0.0);
+    WListManager wlm;
+    Action::State action_state;
+
+    wlm.newList("*INJ", {"WI1"});
+
+    st.update("FOPR", 50.0);
+    st.update_well_var("OP1", "WWCT", 0.7);
+    st.update_well_var("WI1", "WWCT", 0.9);
+    st.update_well_var("WI2", "WWCT", 0.8);
+
+    auto eval = [&ast, &action_state, &wlm](const SummaryState& summary_state)
+    {
+        const auto res = ast.eval(Action::Context {
+            summary_state, wlm, action_state.context_cache()
+        });
+
+        auto wells = res.matches().wells().asVector();
+        std::sort(wells.begin(), wells.end());
+
+        return wells;
+    };
+
+    BOOST_CHECK(eval(st) == (std::vector<std::string> {"OP1", "WI1"}));
+
+    // New well matching the template.
+    st.update_well_var("OP2", "WWCT", 0.6);
+    BOOST_CHECK(eval(st) == (std::vector<std::string> {"OP1", "OP2", "WI1"}));
+
+    // New well list member.
+    wlm.addWListWell("WI2", "*INJ");
+    BOOST_CHECK(eval(st) == (std::vector<std::string> {"OP1", "OP2", "WI1", "WI2"}));
+
+    // Value changes only.
+    st.update_well_var("OP1", "WWCT", 0.1);
+    BOOST_CHECK(eval(st) == (std::vector<std::string> {"OP2", "WI1", "WI2"}));
+
+    // Summary state with a different key registry.
+    SummaryState other(TimeService::now(), 0.0);
+    other.update("FOPR", 50.0);
+    other.update_well_var("OP3", "WWCT", 0.9);
+    other.update_well_var("WI1", "WWCT", 0.1);
+    other.update_well_var("WI2", "WWCT", 0.1);
+    BOOST_CHECK(eval(other) == (std::vector<std::string> {"OP3"}));
+
+    BOOST_CHECK(eval(st) == (std::vector<std::string> {"OP2", "WI1", "WI2"}));
+}
+
+BOOST_AUTO_TEST_CASE(AND_Evaluates_All_Operands)
+{
+    Action::AST ast({"FOPR", ">", "100", "AND", "FWCT", "<", "0.5"});
+    SummaryState st(TimeService::now(), 0.0);
+    WListManager wlm;
+
+    // Unknown vector FWCT is reported even though the first operand
+    // already makes the condition false.
+    st.update("FOPR", 50.0);
+    BOOST_CHECK_THROW(ast.eval(Action::Context { st, wlm }), std::out_of_range);
+
+    st.update("FWCT", 0.2);
+    BOOST_CHECK(! ast.eval(Action::Context { st, wlm }).conditionSatisfied());
+
+    st.update("FOPR", 200.0);
+    BOOST_CHECK(ast.eval(Action::Context { st, wlm }).conditionSatisfied());
+}
@@ -319,6 +319,38 @@ BOOST_AUTO_TEST_CASE(GetFaults) {
     BOOST_CHECK_EQUAL( transMult.getMultiplier( 4, 3, 0, FaceDir::ZPlus ), 1.00 );
 }
 
+BOOST_AUTO_TEST_CASE(SelectedComponents) {
+    auto deck = createDeck();
+    EclipseState state( deck, EclipseState::Components::gridProperties() );
+
+    BOOST_CHECK_EQUAL( state.getInputGrid().getCartesianSize(), 1000U );
+    BOOST_CHECK( state.fieldProps().has_double( "PORO" ) );
+    BOOST_CHECK_EQUAL( state.getTitle(), "The title" );
+
+    BOOST_CHECK( !state.getFaults().hasFault( "F1" ) );
+    BOOST_CHECK_EQUAL( state.getFaults().size(), 0U );
+
+    auto faultsOnly = EclipseState::Components{};
+    faultsOnly.tables = faultsOnly.grid = faultsOnly.fieldProps = false;
+    faultsOnly.aquifers = faultsOnly.transMult = faultsOnly.lgrs = false;
+    faultsOnly.tracers = faultsOnly.compositional = false;
+
+    const auto resolved = faultsOnly.withDependencies();
+    BOOST_CHECK( resolved.transMult );
+    BOOST_CHECK( resolved.fieldProps );
+    BOOST_CHECK( resolved.grid );
+    BOOST_CHECK( resolved.tables );
+    BOOST_CHECK( !resolved.aquifers );
+
+    auto noFieldProps = EclipseState::Components::gridProperties();
+    noFieldProps.fieldProps = false;
+
+    EclipseState gridOnly( deck, noFieldProps );
+    BOOST_CHECK_EQUAL( gridOnly.getInputGrid().getCartesianSize(), 1000U );
+    BOOST_CHECK_THROW( gridOnly.fieldProps(), std::logic_error );
+    BOOST_CHECK_THROW( gridOnly.globalFieldProps(), std::logic_error );
+}
+
 
 BOOST_AUTO_TEST_CASE(FaceTransMults) {
     auto deck = createDeckNoFaults();
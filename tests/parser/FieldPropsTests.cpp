@@ -1804,6 +1804,41 @@ BOOST_AUTO_TEST_CASE(SatFunc_EndPts_Family_I_TolCrit_Zero) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(SatFunc_EndPts_Multiple_Keywords) {
+    const auto es = ::Opm::EclipseState {
+        ::Opm::Parser{}.parseString(satfunc_model_setup() + satfunc_family_I() + end())
+    };
+
+    const auto& tm   = es.getTableManager();
+    const auto& ph   = es.runspec().phases();
+    const auto  rtep = satfunc::getRawTableEndpoints(tm, ph, 0.0);
+
+    const auto depth  = std::vector<double>(10, 2000.0);
+    const auto satnum = std::vector<int>(10, 1);
+    const auto imbnum = std::vector<int>(10, 1);
+    const auto endnum = std::vector<int>(10, 1);
+
+    const auto keywords = std::vector<std::string> {
+        "SWL", "ISWL", "SWU", "KRW", "IKRORG", "PCG",
+    };
+
+    const auto values = satfunc::init(keywords, tm, ph, rtep, depth, satnum, imbnum, endnum);
+    BOOST_REQUIRE_EQUAL(values.size(), keywords.size());
+
+    for (std::size_t i = 0; i < keywords.size(); ++i) {
+        const auto& num = (keywords[i][0] == 'I') ? imbnum : satnum;
+        const auto expect = satfunc::init(keywords[i], tm, ph, rtep, depth, num, endnum);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(values[i].begin(), values[i].end(),
+                                      expect.begin(), expect.end());
+    }
+
+    auto badSatnum = satnum;
+    badSatnum[3] = 0;
+    BOOST_CHECK_THROW(satfunc::init(keywords, tm, ph, rtep, depth, badSatnum, imbnum, endnum),
+                      std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(SatFunc_EndPts_Family_II_TolCrit_Zero) {
     const auto es = ::Opm::EclipseState {
         ::Opm::Parser{}.parseString(satfunc_model_setup() + tolCrit(0.0) + satfunc_family_II() + end())
@@ -1172,3 +1172,91 @@ WELSEGS
     const auto es    = ::Opm::EclipseState { deck };
     BOOST_CHECK_THROW(::Opm::Schedule(deck, es, std::make_shared<const ::Opm::Python>()), ::Opm::OpmInputError);
 }
+
+BOOST_AUTO_TEST_CASE(WELSEGS_Multiple_Report_Steps)
+{
+    const auto deck = ::Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+  20 20 20 /
+
+GRID
+
+DXV
+  20*100 /
+
+DYV
+  20*100 /
+
+DZV
+  20*10 /
+
+DEPTHZ
+  441*2000.0 /
+
+PORO
+    8000*0.1 /
+PERMX
+    8000*1 /
+PERMY
+    8000*0.1 /
+PERMZ
+    8000*0.01 /
+
+SCHEDULE
+
+WELSPECS
+ 'PROD01' 'P' 20 20 1* OIL /
+ 'PROD02' 'P' 10 10 1* OIL /
+/
+
+COMPDAT
+ 'PROD01' 20 20 1 2 'OPEN' /
+ 'PROD02' 10 10 1 2 'OPEN' /
+/
+
+WELSEGS
+'PROD01' 2512.5 2512.5 1.0e-5 'ABS' 'HF-' 'HO' /
+2         2      1      1    2537.5 2525.5  0.3  0.00010 /
+/
+
+COMPSEGS
+  'PROD01' /
+  20    20     1     1   2512.5   2525.0 /
+  20    20     2     1   2525.0   2550.0 /
+/
+
+TSTEP
+  10 /
+
+WELSEGS
+'PROD01' 2512.5 2512.5 1.0e-5 'ABS' 'HF-' 'HO' /
+3         3      1      2    2562.5 2562.5  0.2  0.00010 /
+/
+
+WELSEGS
+'PROD02' 2512.5 2512.5 1.0e-5 'ABS' 'HF-' 'HO' /
+2         2      1      1    2537.5 2525.5  0.3  0.00010 /
+/
+
+COMPSEGS
+  'PROD02' /
+  10    10     1     1   2512.5   2525.0 /
+  10    10     2     1   2525.0   2550.0 /
+/
+
+TSTEP
+  10 /
+)");
+
+    const auto es    = ::Opm::EclipseState { deck };
+    const auto sched = ::Opm::Schedule { deck, es, std::make_shared<const ::Opm::Python>() };
+
+    BOOST_CHECK_EQUAL(sched[0].wells("PROD01").getSegments().size(), 2U);
+    BOOST_CHECK(!sched[0].wells("PROD02").isMultiSegment());
+
+    // Second WELSEGS for PROD01 extends the existing segment structure.
+    BOOST_CHECK_EQUAL(sched[1].wells("PROD01").getSegments().size(), 3U);
+    BOOST_CHECK_EQUAL(sched[1].wells("PROD02").getSegments().size(), 2U);
+    BOOST_CHECK_CLOSE(sched[1].wells("PROD02").getSegments()
+                      .getFromSegmentNumber(2).depth(), 2525.5, 1.0e-8);
+}
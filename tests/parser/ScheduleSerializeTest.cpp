@@ -512,3 +512,33 @@ BOOST_AUTO_TEST_CASE(SerializeGROUPS)
     BOOST_CHECK( groups2 == sched0[4].groups);
     BOOST_CHECK( groups2 == sched0[5].groups);
 }
+
+BOOST_AUTO_TEST_CASE(SerializeSharedSnapshots)
+{
+    auto sched = make_schedule(WTEST_deck);
+    Opm::Schedule sched0;
+
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(sched);
+        ser.unpack(sched0);
+    }
+
+    BOOST_CHECK( sched == sched0 );
+    BOOST_REQUIRE_EQUAL( sched.size(), sched0.size() );
+
+    // Wells shared between consecutive snapshots remain shared after
+    // unpacking, and wells which differ remain distinct.
+    for (std::size_t step = 1; step < sched.size(); ++step) {
+        for (const auto& wname : sched[step].wells.keys()) {
+            const auto shared = sched[step].wells.get_ptr(wname) == sched[step - 1].wells.get_ptr(wname);
+            const auto shared0 = sched0[step].wells.get_ptr(wname) == sched0[step - 1].wells.get_ptr(wname);
+            BOOST_CHECK_MESSAGE( shared == shared0, "Well " << wname << " at report step " << step );
+        }
+    }
+
+    // Wells added in a later snapshot are reproduced.
+    BOOST_CHECK( !sched0[3].wells.has("I1") );
+    BOOST_CHECK(  sched0[4].wells.has("I1") );
+}
@@ -69,3 +69,35 @@ BOOST_AUTO_TEST_CASE( CreateContainer ) {
     BOOST_CHECK_THROW( container[5] , std::invalid_argument );
     BOOST_CHECK_THROW( container[10] , std::invalid_argument );
 }
+
+BOOST_AUTO_TEST_CASE( DeduplicateIdenticalTables ) {
+    const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
+OIL
+WATER
+
+TABDIMS
+3 /
+
+PROPS
+SWOF
+0.1 0.0 1.0 0.0
+1.0 1.0 0.0 0.0 /
+0.2 0.0 1.0 0.0
+1.0 1.0 0.0 0.0 /
+0.1 0.0 1.0 0.0
+1.0 1.0 0.0 0.0 /
+END
+)");
+
+    Opm::TableContainer container(3);
+    for (std::size_t tableIdx = 0; tableIdx < 3; ++tableIdx) {
+        const auto& item = deck["SWOF"].back().getRecord(tableIdx).getItem(0);
+        container.addDeduplicatedTable(tableIdx, std::make_shared<Opm::SwofTable>(item, false, tableIdx));
+    }
+
+    BOOST_CHECK_EQUAL( 3U , container.size() );
+    BOOST_CHECK_EQUAL( 2U , container.numUniqueTables() );
+    BOOST_CHECK_EQUAL( &(container[0]) , &(container[2]) );
+    BOOST_CHECK( &(container[0]) != &(container[1]) );
+    BOOST_CHECK_CLOSE( container.getTable<Opm::SwofTable>(2).getSwColumn().front(), 0.1, 1.0e-8 );
+}
@@ -21,7 +21,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <opm/common/utility/MemPacker.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/Serializer.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/io/eclipse/rst/udq.hpp>
@@ -35,6 +37,7 @@
 
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleState.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
@@ -42,6 +45,7 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQAssign.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
@@ -63,14 +67,20 @@
 
 #include <opm/input/eclipse/Parser/ParserKeywords/D.hpp>
 
+#include "../../opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp"
+#include "../../opm/input/eclipse/Schedule/UDQ/UDQParser.hpp"
+#include "../../opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp"
+
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -3190,3 +3200,396 @@ DEFINE SUSHI (SOFR 'W1' 42) + ((SWCT W1 11)/((SGLR W2) + 1.0)) /
                             R"(Well "W2" must not have any associate segments in "SUSHI" UDQ)");
     }
 }
+
+BOOST_AUTO_TEST_CASE(UDQ_DEFINE_UNDEFINED_WELL_VALUES)
+{
+    KeywordLocation location;
+    UDQParams udqp;
+    UDQFunctionTable udqft;
+    UDQDefine def_add(udqp, "WUADD", 0, location, {"WOPR", "+", "WWPR", "*", "2"});
+    UDQDefine def_sum(udqp, "WUSUM", 0, location, {"WOPR", "/", "SUM", "(", "WOPR", ")"});
+    UDQDefine def_cmp(udqp, "WUCMP", 0, location, {"WOPR", ">", "3"});
+    UDQDefine def_sort(udqp, "WUSORT", 0, location, {"SORTA", "(", "WOPR", ")"});
+    UDQDefine def_union(udqp, "WUNION", 0, location, {"WOPR", "UADD", "WWPR"});
+
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2", "P3"}));
+    UDQContext context(udqft, wm, {}, {}, UDQContext::MatcherFactories{}, st, udq_state);
+
+    st.update_well_var("P1", "WOPR", 4);
+    st.update_well_var("P3", "WOPR", 2);
+    st.update_well_var("P1", "WWPR", 1);
+    st.update_well_var("P2", "WWPR", 3);
+    st.update_well_var("P3", "WWPR", 5);
+
+    {
+        const auto res = def_add.eval(context);
+        BOOST_CHECK_EQUAL(res["P1"].get(), 6.0);
+        BOOST_CHECK(!res["P2"].defined());
+        BOOST_CHECK_EQUAL(res["P3"].get(), 12.0);
+    }
+
+    {
+        const auto res = def_sum.eval(context);
+        BOOST_CHECK_CLOSE(res["P1"].get(), 4.0 / 6.0, 1.0e-8);
+        BOOST_CHECK(!res["P2"].defined());
+        BOOST_CHECK_CLOSE(res["P3"].get(), 2.0 / 6.0, 1.0e-8);
+    }
+
+    {
+        const auto res = def_cmp.eval(context);
+        BOOST_CHECK_EQUAL(res["P1"].get(), 1.0);
+        BOOST_CHECK(!res["P2"].defined());
+        BOOST_CHECK_EQUAL(res["P3"].get(), 0.0);
+    }
+
+    {
+        const auto res = def_sort.eval(context);
+        BOOST_CHECK_EQUAL(res["P1"].get(), 2.0);
+        BOOST_CHECK(!res["P2"].defined());
+        BOOST_CHECK_EQUAL(res["P3"].get(), 1.0);
+    }
+
+    {
+        const auto res = def_union.eval(context);
+        BOOST_CHECK_EQUAL(res["P1"].get(), 5.0);
+        BOOST_CHECK_EQUAL(res["P2"].get(), 3.0);
+        BOOST_CHECK_EQUAL(res["P3"].get(), 7.0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_SKIP_UNCHANGED_DEFINES) {
+    std::string deck_string = R"(
+SCHEDULE
+UDQ
+  ASSIGN FU_CNT 0 /
+  DEFINE FU_A FOPR * 2 /
+  DEFINE FU_B FU_A + FWPR /
+  DEFINE FU_C FWPR + 1 /
+  DEFINE FU_CNT FU_CNT + 1 /
+/
+)";
+
+    auto schedule = make_schedule(deck_string);
+    const auto& udq = schedule.getUDQConfig(0);
+    const auto undefined_value =  udq.params().undefinedValue();
+    UDQState udq_state(undefined_value);
+    SummaryState st(TimeService::now(), undefined_value);
+    st.update("FOPR", 10);
+    st.update("FWPR", 1);
+
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    auto regionSetMatcherFactory = []() { return std::make_unique<RegionSetMatcher>(FIPRegionStatistics {}); };
+
+    const auto& graph = udq.dependency_graph();
+    const auto ia = graph.index("FU_A").value();
+    const auto ib = graph.index("FU_B").value();
+    const auto ic = graph.index("FU_C").value();
+    const auto icnt = graph.index("FU_CNT").value();
+
+    BOOST_CHECK(! graph.index("FOPR").has_value());
+    BOOST_CHECK(graph.nodes()[ib].upstream == std::vector<std::size_t>{ ia });
+    BOOST_CHECK(graph.nodes()[ia].downstream == std::vector<std::size_t>{ ib });
+    BOOST_CHECK(graph.nodes()[ic].upstream.empty());
+    BOOST_CHECK(graph.nodes()[icnt].feedback);
+    BOOST_CHECK(! graph.nodes()[ia].feedback);
+
+    const auto& history = udq_state.define_history();
+
+    udq.eval(0, {}, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(history.graph, graph.id());
+    BOOST_CHECK_EQUAL(st.get("FU_A"), 20);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 21);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), 2);
+    BOOST_CHECK_EQUAL(st.get("FU_CNT"), 1);
+
+    // No inputs changed.  Only the self-referencing FU_CNT is evaluated.
+    udq.eval(0, {}, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 21);
+    BOOST_CHECK_EQUAL(st.get("FU_CNT"), 2);
+    BOOST_CHECK_EQUAL(history.nodes[ia].num_evaluations, 1);
+    BOOST_CHECK_EQUAL(history.nodes[ia].num_skipped, 1);
+    BOOST_CHECK_EQUAL(history.nodes[ib].num_skipped, 1);
+    BOOST_CHECK_EQUAL(history.nodes[ic].num_skipped, 1);
+    BOOST_CHECK_EQUAL(history.nodes[icnt].num_evaluations, 2);
+
+    // FOPR changes.  FU_A and its dependent FU_B are evaluated.
+    st.update("FOPR", 20);
+    udq.eval(0, {}, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_A"), 40);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 41);
+    BOOST_CHECK_EQUAL(st.get("FU_CNT"), 3);
+    BOOST_CHECK_EQUAL(history.nodes[ia].num_evaluations, 2);
+    BOOST_CHECK_EQUAL(history.nodes[ib].num_evaluations, 2);
+    BOOST_CHECK_EQUAL(history.nodes[ic].num_evaluations, 1);
+    BOOST_CHECK_EQUAL(history.nodes[ic].num_skipped, 2);
+
+    // Assigning an unchanged value does not count as a change.
+    st.update("FOPR", 20);
+    udq.eval(0, {}, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(history.nodes[ia].num_evaluations, 2);
+    BOOST_CHECK_EQUAL(history.nodes[ib].num_evaluations, 2);
+
+    // A new UDQ state object has no evaluation record, so everything is
+    // evaluated.  The record of the first state object is unaffected.
+    UDQState udq_state2(undefined_value);
+    udq.eval(0, {}, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state2);
+    BOOST_CHECK_EQUAL(udq_state2.define_history().nodes[ic].num_evaluations, 1);
+    BOOST_CHECK_EQUAL(udq_state2.get("FU_C"), 2);
+    BOOST_CHECK_EQUAL(history.nodes[ic].num_evaluations, 1);
+
+    BOOST_CHECK(! graph.most_expensive_chain(history).empty());
+    BOOST_CHECK(graph.most_expensive_chain(UDQState{}.define_history()).empty());
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_INDEXED_WELL_VALUES)
+{
+    const auto p1 = NameTable::index("P1");
+    const auto p2 = NameTable::index("P2");
+    BOOST_CHECK_EQUAL(NameTable::index("P1"), p1);
+    BOOST_CHECK_EQUAL(NameTable::name(p2), "P2");
+    BOOST_CHECK(! NameTable::find("NO_SUCH_WELL_NAME").has_value());
+
+    auto by_name = UDQSet::wells("WUX", std::vector<std::string>{"P1", "P2"});
+    auto by_index = UDQSet::indexed_wells("WUX", {p1, p2});
+    by_name.assign("P*", 1.0);
+    by_name.assign("P2", 2.0);
+    by_index.assign(0, 1.0);
+    by_index.assign(1, 2.0);
+    BOOST_CHECK(by_name == by_index);
+    BOOST_CHECK(by_index.has("P2"));
+    BOOST_CHECK(! by_index.has("NO_SUCH_WELL_NAME"));
+    BOOST_CHECK_EQUAL(by_index["P2"].wgname(), "P2");
+    BOOST_CHECK_THROW(by_index.assign("NO_SUCH_WELL_NAME", 3.0), std::out_of_range);
+
+    auto reversed = UDQSet::wells("WUX", std::vector<std::string>{"P2", "P1"});
+    reversed.assign("P1", 1.0);
+    reversed.assign("P2", 2.0);
+
+    UDQState st1(-1.0);
+    UDQState st2(-1.0);
+    st1.add_assign("WUX", by_index);
+    st2.add_assign("WUX", reversed);
+    BOOST_CHECK(st1 == st2);
+    BOOST_CHECK_EQUAL(st1.get_well_var("P1", "WUX"), 1.0);
+    BOOST_CHECK_EQUAL(st1.get_well_var("NO_SUCH_WELL_NAME", "WUX"), -1.0);
+    BOOST_CHECK_THROW(st1.get_well_var("P1", "WUY"), std::out_of_range);
+
+    reversed.assign("P1", std::optional<double>{});
+    st2.add_assign("WUX", reversed);
+    BOOST_CHECK(! st2.has_well_var("P1", "WUX"));
+    BOOST_CHECK_EQUAL(st2.get_well_var("P1", "WUX"), -1.0);
+    BOOST_CHECK(! (st1 == st2));
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_STATE_PACK_KEEPS_VERSION)
+{
+    auto wux = UDQSet::wells("WUX", std::vector<std::string>{"P1", "P2"});
+    wux.assign("P2", 2.0);
+
+    UDQState st(-1.0);
+    st.add_assign("WUX", wux);
+    const auto version = st.version();
+
+    UDQState st0;
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(st);
+        ser.unpack(st0);
+    }
+
+    // Packing must not modify the source object.
+    BOOST_CHECK_EQUAL(st.version(), version);
+    BOOST_CHECK(st0.version() != version);
+
+    BOOST_CHECK(st0 == st);
+    BOOST_CHECK_EQUAL(st0.get_well_var("P2", "WUX"), 2.0);
+    BOOST_CHECK(! st0.has_well_var("P1", "WUX"));
+}
+
+namespace {
+
+    /// Summary values for all wells and groups referenced by the DEFINE
+    /// statements in 'udq'.  Every third well and group has no value, and
+    /// some values are zero, to exercise undefined elements.
+    void populate_summary(const UDQConfig&  udq,
+                          const UDQContext& context,
+                          SummaryState&     st)
+    {
+        auto keys = std::unordered_set<std::string>{};
+        udq.required_summary(keys);
+
+        auto k = std::size_t{0};
+        for (const auto& key : keys) {
+            ++k;
+
+            const auto value = [k](const std::size_t i)
+            { return static_cast<double>((7*i + 3*k) % 11) - 2.0; };
+
+            switch (UDQ::targetType(key)) {
+            case UDQVarType::WELL_VAR: {
+                const auto& wells = context.wells();
+                for (auto i = 0*wells.size(); i < wells.size(); ++i) {
+                    if (i % 3 != 1) {
+                        st.update_well_var(wells[i], key, value(i));
+                    }
+                }
+                break;
+            }
+
+            case UDQVarType::GROUP_VAR: {
+                const auto groups = context.nonFieldGroups();
+                for (auto i = 0*groups.size(); i < groups.size(); ++i) {
+                    if (i % 3 != 1) {
+                        st.update_group_var(groups[i], key, value(i));
+                    }
+                }
+                break;
+            }
+
+            case UDQVarType::FIELD_VAR:
+                st.update(key, value(k));
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+    void check_same_result(const std::optional<UDQSet>& compiled,
+                           const UDQSet&                tree)
+    {
+        BOOST_REQUIRE(compiled.has_value());
+        BOOST_CHECK(compiled->var_type() == tree.var_type());
+        BOOST_REQUIRE_EQUAL(compiled->size(), tree.size());
+
+        for (auto i = 0*tree.size(); i < tree.size(); ++i) {
+            const auto& c = (*compiled)[i];
+            const auto& t = tree[i];
+
+            BOOST_CHECK_EQUAL(c.wgname(), t.wgname());
+            BOOST_CHECK_EQUAL(c.defined(), t.defined());
+            if (c.defined() && t.defined()) {
+                // Bitwise identical, not just close.
+                BOOST_CHECK_EQUAL(c.get(), t.get());
+            }
+        }
+    }
+
+    /// Number of DEFINE statements evaluated by a compiled program.
+    std::size_t compare_compiled_defines(const Schedule&     sched,
+                                         const ParseContext& parseContext)
+    {
+        auto num_compiled = std::size_t{0};
+
+        const auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+        const auto regionSetMatcherFactory = []() { return std::make_unique<RegionSetMatcher>(FIPRegionStatistics {}); };
+
+        for (auto step = 0*sched.size(); step < sched.size(); ++step) {
+            const auto& udq = sched.getUDQConfig(step);
+            if (udq.definitions().empty()) {
+                continue;
+            }
+
+            const auto undefined_value = udq.params().undefinedValue();
+            const auto wm = sched.wellMatcher(step);
+            const auto& go = sched[step].group_order();
+
+            SummaryState st(TimeService::now(), undefined_value);
+            UDQState udq_state(undefined_value);
+
+            UDQContext context(udq.function_table(), wm, go, {},
+                               UDQContext::MatcherFactories{}, st, udq_state);
+
+            populate_summary(udq, context, st);
+
+            udq.eval_assign(wm, go, segmentMatcherFactory, st, udq_state);
+
+            // Definitions are compared in input order, and the values of
+            // each are stored before the next is compared, so that DEFINE
+            // statements referring to other UDQs see the same values in
+            // both evaluators.  Some definitions need values which the
+            // synthetic summary leaves undefined.  Both evaluators must
+            // then reject the definition.
+            for (const auto& def : udq.definitions()) {
+                auto errors = ErrorGuard{};
+                const auto ast = parseUDQExpression(udq.params(), def.var_type(), def.keyword(),
+                                                    def.location(), def.tokens(),
+                                                    parseContext, errors);
+                BOOST_REQUIRE(ast != nullptr);
+
+                auto tree = std::optional<UDQSet>{};
+                try {
+                    tree = ast->eval(def.var_type(), context);
+                }
+                catch (const std::exception&) {}
+
+                const auto program = UDQProgram::compile(*ast, def.var_type());
+
+                auto compiled = std::optional<UDQSet>{};
+                auto compiled_threw = false;
+                if (program != nullptr) {
+                    try {
+                        compiled = program->eval(context);
+                    }
+                    catch (const std::exception&) {
+                        compiled_threw = true;
+                    }
+                }
+
+                BOOST_TEST_INFO("UDQ " << def.keyword() << " at report step " << step);
+
+                if (compiled_threw || compiled.has_value()) {
+                    BOOST_CHECK_MESSAGE(compiled_threw != tree.has_value(),
+                                        (compiled_threw
+                                         ? "Compiled program threw, expression tree did not"
+                                         : "Expression tree threw, compiled program did not"));
+
+                    if (compiled.has_value() && tree.has_value()) {
+                        check_same_result(compiled, *tree);
+                        ++num_compiled;
+                    }
+                }
+
+                if (tree.has_value()) {
+                    context.update_define(step, def.keyword(), def.eval(context));
+                }
+            }
+        }
+
+        return num_compiled;
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(UDQ_COMPILED_MATCHES_EXPRESSION_TREE)
+{
+    auto ctx = ParseContext{};
+    ctx.update(ParseContext::UDQ_DEFINE_CANNOT_EVAL, InputErrorAction::IGNORE);
+
+    auto num_compiled = std::size_t{0};
+
+    for (const auto* deck_file : {
+            "UDQ_BASE.DATA",
+            "UDQ_ACTIONX.DATA",
+            "UDQ_ACTIONX_TEST1.DATA",
+            "UDQ_TEST_WCONPROD_IUAD-2.DATA",
+            "UDQ_WCONPROD.DATA",
+            "9_4C_WINJ_GINJ_UDQ_MSW-UDARATE_TEST_PACK.DATA",
+        })
+    {
+        BOOST_TEST_MESSAGE("Deck " << deck_file);
+
+        const auto deck = Parser{}.parseFile(deck_file);
+        const auto es = EclipseState { deck };
+        auto errors = ErrorGuard{};
+        const auto sched = Schedule { deck, es, ctx, errors, std::make_shared<Python>() };
+
+        num_compiled += compare_compiled_defines(sched, ctx);
+    }
+
+    BOOST_CHECK_GT(num_compiled, std::size_t{0});
+}
@@ -0,0 +1,80 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE APPEND_ONLY_ARRAY_TESTS
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/AppendOnlyArray.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(Elements_Across_Chunks)
+{
+    // Small first chunk to exercise many chunk boundaries.
+    Opm::AppendOnlyArray<std::string, 2> array;
+    BOOST_CHECK_EQUAL(array.size(), std::size_t{0});
+
+    auto addresses = std::vector<const std::string*>{};
+    for (auto i = 0; i < 5000; ++i) {
+        addresses.push_back(&array.push_back(std::to_string(i)));
+    }
+
+    BOOST_REQUIRE_EQUAL(array.size(), std::size_t{5000});
+
+    for (auto i = 0; i < 5000; ++i) {
+        BOOST_CHECK_EQUAL(array[i], std::to_string(i));
+
+        // Elements never move.
+        BOOST_CHECK(&array[i] == addresses[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Read_While_Appending)
+{
+    Opm::AppendOnlyArray<std::size_t, 4> array;
+
+    constexpr auto n = std::size_t{200'000};
+
+    auto writer = std::thread { [&array]()
+    {
+        for (auto i = std::size_t{0}; i < n; ++i) {
+            array.push_back(std::size_t{i});
+        }
+    }};
+
+    auto mismatch = std::size_t{0};
+    for (auto observed = std::size_t{0}; observed < n; ) {
+        const auto size = array.size();
+        for (auto i = observed; i < size; ++i) {
+            mismatch += array[i] != i;
+        }
+
+        observed = size;
+    }
+
+    writer.join();
+
+    BOOST_CHECK_EQUAL(mismatch, std::size_t{0});
+    BOOST_CHECK_EQUAL(array.size(), n);
+}
@@ -163,6 +163,92 @@ BOOST_AUTO_TEST_CASE(getCellCorners)
     BOOST_CHECK_EQUAL(Z == ref_Z, true);
 }
 
+BOOST_AUTO_TEST_CASE(streamCellCorners)
+{
+    const std::string testFile = "SPE1CASE1.EGRID";
+
+    EGrid ref_grid(testFile);
+
+    auto checkLayer = [&ref_grid](const EGrid::LayerCorners& corners)
+    {
+        const auto& box = corners.box;
+        const int ni = box[1] - box[0] + 1;
+
+        BOOST_REQUIRE_EQUAL(corners.X.size(), static_cast<std::size_t>(ni*(box[3] - box[2] + 1)));
+
+        std::array<double,8> X, Y, Z;
+
+        for (int j = box[2]; j < box[3] + 1; j++) {
+            for (int i = box[0]; i < box[1] + 1; i++) {
+                const auto cell = (j - box[2])*ni + (i - box[0]);
+
+                ref_grid.getCellCorners({i, j, corners.layer}, X, Y, Z);
+
+                BOOST_CHECK_EQUAL(corners.X[cell] == X, true);
+                BOOST_CHECK_EQUAL(corners.Y[cell] == Y, true);
+                BOOST_CHECK_EQUAL(corners.Z[cell] == Z, true);
+            }
+        }
+    };
+
+    {
+        EGrid grid1(testFile);
+
+        std::vector<int> layers;
+
+        grid1.streamCellCorners([&](const EGrid::LayerCorners& corners)
+        {
+            layers.push_back(corners.layer);
+            BOOST_CHECK_EQUAL((corners.box == std::array<int,4>{0, 9, 0, 9}), true);
+            checkLayer(corners);
+        });
+
+        BOOST_CHECK_EQUAL(layers == std::vector<int>({0, 1, 2}), true);
+
+        // COORD and ZCORN are not loaded by streaming
+        BOOST_CHECK_EQUAL(grid1.get_zcorn().empty(), true);
+        BOOST_CHECK_EQUAL(grid1.get_coord().empty(), true);
+    }
+
+    {
+        EGrid grid1(testFile, EGrid::MemoryMapped{true});
+
+        BOOST_CHECK_EQUAL(grid1.memoryMapped(), true);
+
+        std::vector<int> layers;
+
+        grid1.streamCellCorners({3, 7, 2, 8, 1, 2}, [&](const EGrid::LayerCorners& corners)
+        {
+            layers.push_back(corners.layer);
+            checkLayer(corners);
+        });
+
+        BOOST_CHECK_EQUAL(layers == std::vector<int>({1, 2}), true);
+
+        // top surface of layer through getXYZ_layer, read from mapping
+        const auto xyz = grid1.getXYZ_layer(1, {3, 7, 2, 8});
+
+        grid1.streamCellCorners({3, 7, 2, 8, 1, 1}, [&](const EGrid::LayerCorners& corners)
+        {
+            BOOST_REQUIRE_EQUAL(xyz.size(), 4*corners.X.size());
+
+            for (std::size_t cell = 0; cell < corners.X.size(); cell++) {
+                for (std::size_t n = 0; n < 4; n++) {
+                    BOOST_CHECK_CLOSE(xyz[4*cell + n][0], corners.X[cell][n], 1.0e-5);
+                    BOOST_CHECK_CLOSE(xyz[4*cell + n][1], corners.Y[cell][n], 1.0e-5);
+                    BOOST_CHECK_CLOSE(xyz[4*cell + n][2], corners.Z[cell][n], 1.0e-5);
+                }
+            }
+        });
+
+        auto ignore = [](const EGrid::LayerCorners&) {};
+
+        BOOST_CHECK_THROW(grid1.streamCellCorners({0, 10, 0, 9, 0, 2}, ignore), std::invalid_argument);
+        BOOST_CHECK_THROW(grid1.streamCellCorners({0, 9, 5, 4, 0, 2}, ignore), std::invalid_argument);
+        BOOST_CHECK_THROW(grid1.streamCellCorners({0, 9, 0, 9, -1, 2}, ignore), std::invalid_argument);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(lgr_1)
 {
     std::string testEgridFile = "LGR_TESTMOD.EGRID";
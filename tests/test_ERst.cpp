@@ -19,6 +19,7 @@
 #include "config.h"
 
 #include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/ArrayIndexFile.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 
 #define BOOST_TEST_MODULE Test EclIO
@@ -530,6 +531,47 @@ BOOST_AUTO_TEST_CASE(TestERst_5b) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestERst_range) {
+
+    // ICON, SCON and XCON at report step 10 span two or three records.
+
+    const std::string testRstFile = "ACTIONX_M1.UNRST";
+
+    ERst ref(testRstFile);
+
+    const auto& icon = ref.getRestartData<int>("ICON", 10);
+    const auto& scon = ref.getRestartData<float>("SCON", 10);
+    const auto& xcon = ref.getRestartData<double>("XCON", 10);
+
+    BOOST_REQUIRE_EQUAL(icon.size(), 1250U);
+    BOOST_REQUIRE_EQUAL(xcon.size(), 2900U);
+
+    auto slice = [](const auto& values, std::size_t offset, std::size_t count)
+    {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        return std::vector<T>(values.begin() + offset, values.begin() + offset + count);
+    };
+
+    for (const bool mmap : { false, true }) {
+        ERst rst1(testRstFile, EclFile::MemoryMapped{mmap});
+
+        BOOST_CHECK(rst1.getRestartRange<int>("ICON", 10, 0, 25) == slice(icon, 0, 25));
+        BOOST_CHECK(rst1.getRestartRange<int>("ICON", 10, 990, 20) == slice(icon, 990, 20));
+        BOOST_CHECK(rst1.getRestartRange<int>("ICON", 10, 1225, 25) == slice(icon, 1225, 25));
+        BOOST_CHECK(rst1.getRestartRange<float>("SCON", 10, 1999, 51) == slice(scon, 1999, 51));
+        BOOST_CHECK(rst1.getRestartRange<double>("XCON", 10, 0, 2900) == xcon);
+        BOOST_CHECK(rst1.getRestartRange<double>("XCON", 10, 2900, 0).empty());
+
+        BOOST_CHECK_THROW(rst1.getRestartRange<int>("ICON", 10, 1240, 11), std::out_of_range);
+        BOOST_CHECK_THROW(rst1.getRestartRange<float>("ICON", 10, 0, 1), std::runtime_error);
+        BOOST_CHECK_THROW(rst1.getRestartRange<int>("ICON", 4, 0, 1), std::invalid_argument);
+
+        // Served from the cache once loaded
+        rst1.loadReportStepNumber(10);
+        BOOST_CHECK(rst1.getRestartRange<int>("ICON", 10, 990, 20) == slice(icon, 990, 20));
+    }
+}
+
 // ====================================================================
 
 class RSet
@@ -1187,3 +1229,112 @@ BOOST_AUTO_TEST_CASE(Formatted)
 }
 
 BOOST_AUTO_TEST_SUITE_END()     // Separate
+
+// ====================================================================
+
+BOOST_AUTO_TEST_SUITE(Index)
+
+BOOST_AUTO_TEST_CASE(Unified_Unformatted)
+{
+    using ::Opm::EclIO::OutputStream::Restart;
+
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto unif  = ::Opm::EclIO::OutputStream::Unified  { true };
+    const auto index = Restart::WriteIndex{ true };
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    for (const auto seqnum : { 1, 2, 3 }) {
+        auto rst = Restart { rset, seqnum, fmt, unif, index };
+
+        rst.write("I", std::vector<int>   (1001, seqnum));
+        rst.write("D", std::vector<double>{2.71, 8.21});
+        rst.message("ENDSOL");
+    }
+
+    BOOST_REQUIRE(std::filesystem::exists(::Opm::EclIO::arrayIndexFileName(fname)));
+
+    {
+        const auto entries = ::Opm::EclIO::readArrayIndexFile(fname);
+        BOOST_REQUIRE(entries.has_value());
+        BOOST_REQUIRE_EQUAL(entries->size(), std::size_t{3 * 4});
+
+        BOOST_CHECK_EQUAL((*entries)[4].name, "SEQNUM");
+        BOOST_CHECK_EQUAL((*entries)[4].seqnum, 2);
+        BOOST_CHECK_EQUAL((*entries)[5].size, 1001);
+    }
+
+    // Rewrite report step 2.  Discards report step 3.
+    {
+        auto rst = Restart { rset, 2, fmt, unif, index };
+
+        rst.write("I", std::vector<int>{17, 29});
+    }
+
+    {
+        auto rst = ::Opm::EclIO::ERst{fname};
+
+        const auto seqnum        = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 2};
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+
+        const auto& I = rst.getRestartData<int>("I", 2, 0);
+        const auto  expect_I = std::vector<int>{17, 29};
+        BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                      expect_I.begin(),
+                                      expect_I.end());
+
+        // Index must match result of scanning the file's headers.
+        std::filesystem::rename(::Opm::EclIO::arrayIndexFileName(fname), fname + ".bak");
+        auto scanned = ::Opm::EclIO::ERst{fname};
+        std::filesystem::rename(fname + ".bak", ::Opm::EclIO::arrayIndexFileName(fname));
+
+        const auto arrays = rst.getList();
+        const auto expect_arrays = scanned.getList();
+        BOOST_CHECK_EQUAL_COLLECTIONS(arrays.begin(), arrays.end(),
+                                      expect_arrays.begin(),
+                                      expect_arrays.end());
+
+        const auto& D = rst.getRestartData<double>("D", 1, 0);
+        check_is_close(D, scanned.getRestartData<double>("D", 1, 0));
+    }
+
+    {
+        const auto entries = ::Opm::EclIO::readArrayIndexFile(fname);
+        BOOST_REQUIRE(entries.has_value());
+        BOOST_CHECK_EQUAL(entries->size(), std::size_t{4 + 2});
+    }
+
+    // Missing index is recreated from the file's array headers
+    std::filesystem::remove(::Opm::EclIO::arrayIndexFileName(fname));
+
+    {
+        auto rst = Restart { rset, 3, fmt, unif, index };
+
+        rst.write("I", std::vector<int>(3, 3));
+    }
+
+    {
+        const auto entries = ::Opm::EclIO::readArrayIndexFile(fname);
+        BOOST_REQUIRE(entries.has_value());
+        BOOST_REQUIRE_EQUAL(entries->size(), std::size_t{4 + 2 + 2});
+
+        BOOST_CHECK_EQUAL((*entries)[6].name, "SEQNUM");
+        BOOST_CHECK_EQUAL((*entries)[6].seqnum, 3);
+        BOOST_CHECK_EQUAL((*entries)[7].size, 3);
+    }
+
+    // Index no longer describes the file once it changes
+    {
+        std::ofstream os(fname, std::ios::app | std::ios::binary);
+        os.write("XXXX", 4);
+    }
+
+    BOOST_CHECK(! ::Opm::EclIO::readArrayIndexFile(fname).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()     // Index
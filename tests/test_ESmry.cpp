@@ -27,9 +27,12 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EnsembleSummary.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -640,3 +643,234 @@ BOOST_AUTO_TEST_CASE(Test_all_available_w_restart) {
 
     BOOST_CHECK_EQUAL( smry3.all_steps_available(), false);
 }
+
+BOOST_AUTO_TEST_CASE(Test_load_selected_vectors) {
+
+    // PARAMS spanning several binary blocks, and enough time steps to
+    // split loading across threads.
+
+    const int nWells = 1200;
+    const int nSteps = 300;
+
+    std::vector<std::string> keywords { "TIME" };
+    std::vector<std::string> wgnames { ":+:+:+:+" };
+    std::vector<std::string> units { "DAYS" };
+
+    for (int w = 0; w < nWells; w++) {
+        keywords.push_back("WOPR");
+        wgnames.push_back("W" + std::to_string(w));
+        units.push_back("SM3/DAY");
+    }
+
+    const std::vector<int> nums (keywords.size(), 0);
+
+    auto value = [](int step, int param) {
+        return static_cast<float>(step * 2000 + param);
+    };
+
+    WorkArea work;
+
+    for (const bool formatted : { false, true }) {
+        const std::string root = formatted ? "FMT" : "BIN";
+
+        {
+            Opm::EclIO::EclOutput smspec1(root + (formatted ? ".FSMSPEC" : ".SMSPEC"), formatted);
+            smspec1.write<int>("INTEHEAD", {1,100});
+            std::vector<std::string> restart (9,"");
+            smspec1.write("RESTART", restart);
+            smspec1.write<int>("DIMENS", {static_cast<int>(keywords.size()), 13, 22, 11, 0, 0});
+            smspec1.write("KEYWORDS", keywords);
+            smspec1.write("WGNAMES", wgnames);
+            smspec1.write("NUMS", nums);
+            smspec1.write("UNITS", units);
+            smspec1.write<int>("STARTDAT", {1, 11, 2018, 0, 0, 0});
+        }
+
+        {
+            Opm::EclIO::EclOutput smry_out(root + (formatted ? ".FUNSMRY" : ".UNSMRY"), formatted);
+
+            for (int step = 0; step < nSteps; step++) {
+                if (step % 10 == 0)
+                    smry_out.write<int>("SEQHDR", {step / 10});
+
+                smry_out.write<int>("MINISTEP", {step});
+
+                std::vector<float> params(keywords.size());
+                for (std::size_t p = 0; p < params.size(); p++)
+                    params[p] = value(step, p);
+
+                smry_out.write<float>("PARAMS", params);
+            }
+        }
+
+        const std::vector<int> selected = { 0, 1, 999, 1000, 1001, 1100, 1199 };
+
+        std::vector<std::string> vectList;
+        for (auto w : selected)
+            vectList.push_back("WOPR:W" + std::to_string(w));
+
+        Opm::EclIO::ESmry smry1(root + (formatted ? ".FSMSPEC" : ".SMSPEC"));
+        smry1.loadData(vectList);
+
+        BOOST_CHECK(std::get<1>(smry1.get_io_elapsed()) > 0.0);
+
+        Opm::EclIO::ESmry smry2(root + (formatted ? ".FSMSPEC" : ".SMSPEC"));
+        smry2.loadData();
+
+        for (std::size_t n = 0; n < selected.size(); n++) {
+            const auto& vect1 = smry1.get(vectList[n]);
+            const auto& vect2 = smry2.get(vectList[n]);
+
+            BOOST_REQUIRE_EQUAL(vect1.size(), static_cast<std::size_t>(nSteps));
+            BOOST_CHECK(vect1 == vect2);
+
+            for (int step = 0; step < nSteps; step++)
+                BOOST_CHECK_EQUAL(vect1[step], value(step, selected[n] + 1));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test_ensemble_summary) {
+
+    // Realisations R0 - R2 share smspec file, R2 stops half way.  R3 has
+    // an extra vector and twice as many time steps.  FOPT is linear in
+    // time, so interpolated values are exact.  FOPR, a rate, holds the
+    // value of each time step for the entire time step.
+
+    auto fopt = [](double days, int realisation) {
+        return static_cast<float>(100.0 * days + realisation);
+    };
+
+    auto write_case = [&fopt](const std::string& dir, int realisation, int nSteps,
+                              double dt, bool with_fwpt)
+    {
+        std::filesystem::create_directories(dir);
+
+        std::vector<std::string> keywords { "TIME", "FOPT", "FOPR" };
+        std::vector<std::string> units { "DAYS", "SM3", "SM3/DAY" };
+
+        if (with_fwpt) {
+            keywords.push_back("FWPT");
+            units.push_back("SM3");
+        }
+
+        const std::vector<std::string> wgnames (keywords.size(), ":+:+:+:+");
+        const std::vector<int> nums (keywords.size(), 0);
+
+        {
+            Opm::EclIO::EclOutput smspec(dir + "/CASE.SMSPEC", false);
+            smspec.write<int>("INTEHEAD", {1,100});
+            smspec.write("RESTART", std::vector<std::string>(9, ""));
+            smspec.write<int>("DIMENS", {static_cast<int>(keywords.size()), 10, 10, 3, 0, 0});
+            smspec.write("KEYWORDS", keywords);
+            smspec.write("WGNAMES", wgnames);
+            smspec.write("NUMS", nums);
+            smspec.write("UNITS", units);
+            smspec.write<int>("STARTDAT", {1, 1, 2020, 0, 0, 0});
+        }
+
+        Opm::EclIO::EclOutput smry_out(dir + "/CASE.UNSMRY", false);
+
+        for (int step = 0; step < nSteps; step++) {
+            const double days = dt * (step + 1);
+
+            smry_out.write<int>("SEQHDR", {step});
+            smry_out.write<int>("MINISTEP", {step});
+
+            std::vector<float> params { static_cast<float>(days), fopt(days, realisation),
+                                        static_cast<float>(10*(step + 1) + realisation) };
+            if (with_fwpt)
+                params.push_back(static_cast<float>(days));
+
+            smry_out.write<float>("PARAMS", params);
+        }
+    };
+
+    WorkArea work;
+
+    write_case("R0", 0, 10, 10.0, false);
+    write_case("R1", 1, 10, 10.0, false);
+    write_case("R2", 2, 5, 10.0, false);
+    write_case("R3", 3, 10, 5.0, true);
+
+    {
+        ESmry smry("R0/CASE.SMSPEC");
+        smry.make_esmry_file();
+    }
+
+    const std::vector<std::string> cases = { "R0/CASE.SMSPEC", "R1/CASE.SMSPEC", "R2/CASE.SMSPEC",
+                                             "R3/CASE.SMSPEC", "R0/CASE.ESMRY" };
+
+    for (const int numThreads : { 1, 4 }) {
+        Opm::EclIO::EnsembleSummary ensemble(cases, numThreads);
+
+        BOOST_CHECK_EQUAL(ensemble.numberOfCases(), 5U);
+        BOOST_CHECK_EQUAL(ensemble.numberOfSpecGroups(), 2U);
+        BOOST_CHECK(ensemble.caseFiles() == cases);
+
+        const std::vector<std::string> ref_keys = { "FOPR", "FOPT", "FWPT", "TIME" };
+        BOOST_CHECK(ensemble.keywordList() == ref_keys);
+        BOOST_CHECK(ensemble.hasKey("FWPT"));
+        BOOST_CHECK(!ensemble.hasKey("FGPT"));
+
+        // 5, 10, ..., 50 from R3, and 60, ..., 100 from R0 and R1
+
+        const auto& dates = ensemble.reportDates();
+        BOOST_REQUIRE_EQUAL(dates.size(), 15U);
+
+        const auto start = ESmry("R1/CASE.SMSPEC").startdate();
+
+        std::vector<double> days;
+        for (const auto& d : dates)
+            days.push_back(std::chrono::duration<double>(d - start).count() / 86400.0);
+
+        BOOST_CHECK_EQUAL(days.front(), 5.0);
+        BOOST_CHECK_EQUAL(days[9], 50.0);
+        BOOST_CHECK_EQUAL(days.back(), 100.0);
+
+        const auto matrix = ensemble.get("FOPT");
+        BOOST_REQUIRE_EQUAL(matrix.numTimes, 15U);
+        BOOST_REQUIRE_EQUAL(matrix.numCases, 5U);
+
+        const std::vector<int> realisation = { 0, 1, 2, 3, 0 };
+        const std::vector<double> last_day = { 100.0, 100.0, 50.0, 50.0, 100.0 };
+
+        for (std::size_t t = 0; t < matrix.numTimes; t++) {
+            for (std::size_t c = 0; c < matrix.numCases; c++) {
+                const double first_day = (c == 3) ? 5.0 : 10.0;
+
+                if ((days[t] < first_day) || (days[t] > last_day[c]))
+                    BOOST_CHECK(std::isnan(matrix(t, c)));
+                else
+                    BOOST_CHECK_CLOSE(matrix(t, c), fopt(days[t], realisation[c]), 1e-5);
+            }
+        }
+
+        const auto fwpt = ensemble.get("FWPT", { dates[0], dates[14] });
+        BOOST_REQUIRE_EQUAL(fwpt.numTimes, 2U);
+
+        BOOST_CHECK_CLOSE(fwpt(0, 3), 5.0, 1e-5);
+        BOOST_CHECK(std::isnan(fwpt(1, 3)));
+
+        for (std::size_t c : { 0, 1, 2, 4 })
+            BOOST_CHECK(std::isnan(fwpt(0, c)));
+
+        // Day 15 is in the second time step of R0 - R2, and at the end of
+        // the third time step of R3.
+
+        const auto fopr = ensemble.get("FOPR", { start + std::chrono::hours(15*24) });
+        BOOST_REQUIRE_EQUAL(fopr.numTimes, 1U);
+
+        BOOST_CHECK_EQUAL(fopr(0, 0), 20.0f);
+        BOOST_CHECK_EQUAL(fopr(0, 1), 21.0f);
+        BOOST_CHECK_EQUAL(fopr(0, 2), 22.0f);
+        BOOST_CHECK_EQUAL(fopr(0, 3), 33.0f);
+        BOOST_CHECK_EQUAL(fopr(0, 4), 20.0f);
+
+        BOOST_CHECK_THROW(ensemble.get("FGPT"), std::invalid_argument);
+        BOOST_CHECK_THROW(ensemble.get("FOPT", { dates[1], dates[0] }), std::invalid_argument);
+    }
+
+    BOOST_CHECK_THROW(Opm::EclIO::EnsembleSummary({ "R0/CASE.SMSPEC", "R9/CASE.SMSPEC" }),
+                      std::invalid_argument);
+}
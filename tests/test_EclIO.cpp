@@ -198,6 +198,45 @@ BOOST_AUTO_TEST_CASE(TestEclFile_BINARY)
     BOOST_CHECK_EQUAL(vect5b.size(), 312U);
 }
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryMapped)
+{
+    std::string testFile="ECLFILE.INIT";
+
+    EclFile file1(testFile);
+    EclFile file2(testFile, EclFile::MemoryMapped{true});
+
+    BOOST_CHECK(!file1.memoryMapped());
+    BOOST_CHECK(file2.memoryMapped());
+
+    BOOST_CHECK_THROW(file1.view<int>(0), std::runtime_error);
+    BOOST_CHECK_THROW(file2.view<float>(0), std::runtime_error);
+    BOOST_CHECK_THROW(file2.view<int>("XPORV"), std::invalid_argument);
+
+    BOOST_CHECK(file1.getList() == file2.getList());
+
+    const auto icon = file2.view<int>("ICON");
+    const auto porv = file2.view<float>("PORV");
+    const auto xcon = file2.view<double>(3);
+
+    BOOST_CHECK_EQUAL(icon.size(), 1875U);
+    BOOST_CHECK_EQUAL(icon.numRecords(), 2U);
+    BOOST_CHECK_EQUAL(icon.recordSize(1), 875U);
+
+    const auto& icon_ref = file1.get<int>("ICON");
+    const auto& porv_ref = file1.get<float>("PORV");
+    const auto& xcon_ref = file1.get<double>("XCON");
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(icon.begin(), icon.end(), icon_ref.begin(), icon_ref.end());
+    BOOST_CHECK(porv.toVector() == porv_ref);
+    BOOST_CHECK(xcon.toVector() == xcon_ref);
+    BOOST_CHECK_EQUAL(xcon[1739], xcon_ref[1739]);
+
+    // Cached arrays are converted from the mapping
+    BOOST_CHECK(file2.get<float>("PORV") == porv_ref);
+    BOOST_CHECK(file2.get<bool>("LOGIHEAD") == file1.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(file2.get<std::string>("KEYWORDS") == file1.get<std::string>("KEYWORDS"));
+}
+
 BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED)
 {
     std::string testFile1="ECLFILE.INIT";
@@ -531,6 +570,83 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_CHAR)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestEcl_FlipEndianArray)
+{
+    std::vector<int> inte(1003);
+    std::iota(inte.begin(), inte.end(), -17);
+
+    std::vector<float> real(inte.begin(), inte.end());
+    std::vector<double> doub(inte.begin(), inte.end());
+
+    auto flippedInte = inte;
+    auto flippedReal = real;
+    auto flippedDoub = doub;
+
+    flipEndianArray(flippedInte.data(), flippedInte.size());
+    flipEndianArray(flippedReal.data(), flippedReal.size());
+    flipEndianArray(flippedDoub.data(), flippedDoub.size());
+
+    for (std::size_t i = 0; i < inte.size(); ++i) {
+        BOOST_CHECK_EQUAL(flippedInte[i], flipEndianInt(inte[i]));
+        BOOST_CHECK_EQUAL(flipEndianFloat(flippedReal[i]), real[i]);
+        BOOST_CHECK_EQUAL(flipEndianDouble(flippedDoub[i]), doub[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEcl_Write_multiple_records)
+{
+    // Array sizes straddle the maximum number of elements per record
+    // (1000 for numeric and LOGI arrays, 105 for CHAR arrays).
+    const auto sizes = std::vector<int> { 1, 105, 999, 1000, 1001, 2105 };
+
+    WorkArea work;
+    {
+        EclOutput eclTest("RECORDS.DAT", false);
+
+        for (const auto size : sizes) {
+            std::vector<int> inte(size);
+            std::iota(inte.begin(), inte.end(), -size);
+
+            std::vector<bool> logi(size);
+            std::vector<std::string> chars(size);
+            for (int i = 0; i < size; ++i) {
+                logi[i] = (i % 3) == 0;
+                chars[i] = "C" + std::to_string(i);
+            }
+
+            eclTest.write("INTE", inte);
+            eclTest.write("REAL", std::vector<float>(inte.begin(), inte.end()));
+            eclTest.write("DOUB", std::vector<double>(inte.begin(), inte.end()));
+            eclTest.write("LOGI", logi);
+            eclTest.write("CHAR", chars);
+        }
+    }
+
+    EclFile file1("RECORDS.DAT");
+    file1.loadData();
+
+    int arrIndex = 0;
+    for (const auto size : sizes) {
+        const auto& inte  = file1.get<int>(arrIndex++);
+        const auto& real  = file1.get<float>(arrIndex++);
+        const auto& doub  = file1.get<double>(arrIndex++);
+        const auto& logi  = file1.get<bool>(arrIndex++);
+        const auto& chars = file1.get<std::string>(arrIndex++);
+
+        BOOST_REQUIRE_EQUAL(inte.size(), static_cast<std::size_t>(size));
+        BOOST_REQUIRE_EQUAL(logi.size(), static_cast<std::size_t>(size));
+        BOOST_REQUIRE_EQUAL(chars.size(), static_cast<std::size_t>(size));
+
+        for (int i = 0; i < size; ++i) {
+            BOOST_CHECK_EQUAL(inte[i], i - size);
+            BOOST_CHECK_EQUAL(real[i], static_cast<float>(i - size));
+            BOOST_CHECK_EQUAL(doub[i], static_cast<double>(i - size));
+            BOOST_CHECK_EQUAL(logi[i], (i % 3) == 0);
+            BOOST_CHECK_EQUAL(chars[i], "C" + std::to_string(i));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(CombinedVectorID)
 {
     BOOST_CHECK_EQUAL(combineSummaryNumbers(1, 2), 393'217);
@@ -303,7 +303,7 @@ WELSPECS
 /
 )" };
 
-    auto write_and_check = [&deckString]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&deckString]( int first = 1, int last = 5, bool async = false ) {
         const auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         const auto& eclGrid = es.getInputGrid();
@@ -313,6 +313,7 @@ WELSPECS
         es.getIOConfig().setBaseName( "FOO" );
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        eclWriter.setAsyncOutput(async);
 
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
@@ -360,6 +361,7 @@ WELSPECS
                                     first_step - start_time,
                                     std::move(restart_value));
 
+            eclWriter.flushOutput();
             checkRestartFile(i);
         }
 
@@ -435,6 +437,9 @@ WELSPECS
     // Verify that restarting a simulation, then writing fewer steps truncates
     // the file
     BOOST_CHECK_EQUAL(file_size, write_and_check(3, 5));
+
+    // Verify that asynchronous output creates the same files.
+    BOOST_CHECK_EQUAL(file_size, write_and_check(1, 5, true));
 }
 
 namespace {
@@ -27,15 +27,27 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ESmryColumns.hpp>
+#include <opm/io/eclipse/ExtSmryOutput.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <math.h>
 #include <stdio.h>
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include "tests/WorkArea.hpp"
 
@@ -383,3 +395,340 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
     for (size_t n = 63; n < fopt.size(); n++)
         BOOST_REQUIRE_CLOSE(fopt[n], fopt_rst_ref[n-63], 0.01);
 }
+
+BOOST_AUTO_TEST_CASE(TestExtSmryOutput_Chunked) {
+
+    // ExtSmryOutput appends chunks of max_chunk_size time steps, and
+    // publishes the remaining time steps through the directory file while
+    // the run is active.  Check that a reader sees complete chunks and the
+    // provisional tail while the run is active, and all time steps once
+    // the final summary is written.
+
+    WorkArea work;
+
+    auto es = Opm::EclipseState { Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+DX
+ 4*100 /
+DY
+ 4*100 /
+DZ
+ 4*10 /
+TOPS
+ 4*2000 /
+PORO
+ 4*0.3 /
+)") };
+
+    es.getIOConfig().setOutputDir(work.currentWorkingDirectory());
+    es.getIOConfig().setBaseName("CHUNKED");
+
+    // More than 1000 vectors, so that each chunk's VALUES array spans
+    // several binary blocks.
+    const int nvect = 1500;
+
+    std::vector<std::string> keys { "TIME" };
+    std::vector<std::string> units { "DAYS" };
+
+    for (int n = 1; n < nvect; n++) {
+        keys.push_back("WOPR:W" + std::to_string(n));
+        units.push_back("SM3/DAY");
+    }
+
+    const int chunk = Opm::EclIO::ExtSmryOutput::max_chunk_size;
+    const int ntstep = 2*chunk + 22;
+
+    Opm::EclIO::ExtSmryOutput output(keys, units, es, 0);
+
+    std::vector<float> rstep_ref;
+
+    for (int t = 0; t < ntstep; t++) {
+        std::vector<float> values(nvect);
+        values[0] = static_cast<float>(t);
+
+        for (int n = 1; n < nvect; n++)
+            values[n] = 1000.0f*n + t;
+
+        // three time steps per report step
+        const int report_step = 1 + t / 3;
+
+        if ((t % 3 == 2) || (t == ntstep - 1))
+            rstep_ref.push_back(static_cast<float>(t));
+
+        output.write(values, report_step, t == ntstep - 1);
+
+        if (t == chunk + 10) {
+            {
+                ExtESmry esmry("CHUNKED.ESMRY");
+
+                BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), static_cast<size_t>(chunk));
+
+                const auto& wopr = esmry.get("WOPR:W1234");
+                BOOST_REQUIRE_EQUAL(wopr.size(), static_cast<size_t>(chunk));
+                BOOST_CHECK_EQUAL(wopr.back(), 1234000.0f + chunk - 1);
+            }
+
+            // Publish the provisional tail, as the writer does at most
+            // every 15 seconds.
+
+            std::vector<int> directory;
+            {
+                Opm::EclIO::EclFile dir("CHUNKED.ESMRY.dir");
+                directory = dir.get<int>("CHUNKDIR");
+            }
+
+            BOOST_REQUIRE_EQUAL(directory.size(), 4U);
+            BOOST_CHECK_EQUAL(directory[2], 1);
+            BOOST_CHECK_EQUAL(directory[3], chunk);
+
+            std::vector<int> tail_repstep;
+            std::vector<int> tail_tstep;
+            std::vector<float> tail_values;
+
+            for (int n = 0; n < nvect; n++)
+                for (int ts = chunk; ts <= t; ts++)
+                    tail_values.push_back(n == 0 ? static_cast<float>(ts) : 1000.0f*n + ts);
+
+            for (int ts = chunk; ts <= t; ts++) {
+                tail_repstep.push_back(1 + ts / 3);
+                tail_tstep.push_back(ts);
+            }
+
+            directory[3] = t + 1;
+
+            {
+                Opm::EclIO::EclOutput dir("CHUNKED.ESMRY.dir", false, std::ios::out);
+
+                dir.write<int>("CHUNKDIR", directory);
+                dir.write<int>("REPSTEP", tail_repstep);
+                dir.write<int>("TSTEP", tail_tstep);
+                dir.write<float>("VALUES", tail_values);
+            }
+
+            {
+                ExtESmry esmry("CHUNKED.ESMRY");
+
+                BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), static_cast<size_t>(t + 1));
+
+                const auto& wopr = esmry.get("WOPR:W1234");
+                BOOST_REQUIRE_EQUAL(wopr.size(), static_cast<size_t>(t + 1));
+                BOOST_CHECK_EQUAL(wopr[chunk - 1], 1234000.0f + chunk - 1);
+                BOOST_CHECK_EQUAL(wopr.back(), 1234000.0f + t);
+            }
+        }
+    }
+
+    // Only full chunks and the final chunk are appended, and the
+    // directory file is removed at the end of the run.
+
+    BOOST_CHECK(! std::filesystem::exists("CHUNKED.ESMRY.dir"));
+
+    {
+        Opm::EclIO::EclFile file("CHUNKED.ESMRY");
+
+        const auto arrays = file.getList();
+
+        std::vector<int> chunk_sizes;
+        for (size_t i = 0; i < arrays.size(); i++)
+            if (std::get<0>(arrays[i]) == "CHUNK")
+                chunk_sizes.push_back(file.get<int>(static_cast<int>(i))[0]);
+
+        const auto expect = std::vector<int> { chunk, chunk, ntstep - 2*chunk };
+        BOOST_CHECK_EQUAL_COLLECTIONS(chunk_sizes.begin(), chunk_sizes.end(),
+                                      expect.begin(), expect.end());
+    }
+
+    ExtESmry esmry("CHUNKED.ESMRY");
+
+    BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), static_cast<size_t>(ntstep));
+    BOOST_CHECK_EQUAL(esmry.all_steps_available(), true);
+    BOOST_CHECK_EQUAL(esmry.get_unit("WOPR:W7"), "SM3/DAY");
+
+    esmry.loadData();
+
+    for (int n = 1; n < nvect; n += 7) {
+        const auto& wopr = esmry.get("WOPR:W" + std::to_string(n));
+
+        BOOST_REQUIRE_EQUAL(wopr.size(), static_cast<size_t>(ntstep));
+
+        for (int t = 0; t < ntstep; t++)
+            BOOST_REQUIRE_EQUAL(wopr[t], 1000.0f*n + t);
+    }
+
+    BOOST_CHECK_EQUAL(esmry.get_at_rstep("TIME") == rstep_ref, true);
+}
+
+BOOST_AUTO_TEST_CASE(TestESmryColumns_Codec) {
+
+    std::vector<float> values(300, 0.0f);
+
+    for (int n = 150; n < 250; n++)
+        values[n] = 1.0e5f + 0.25f*n;
+
+    values[200] = -0.0f;
+    values[201] = std::numeric_limits<float>::infinity();
+    values[202] = 1.0e-30f;
+    values[203] = -7.5e12f;
+    values[260] = std::numeric_limits<float>::quiet_NaN();
+
+    const auto bytes = Opm::EclIO::compressSummaryVector(values);
+
+    // leading run of 150 zeros needs two control bytes
+    BOOST_CHECK(bytes.size() < values.size() * sizeof(float) / 2);
+
+    const auto decoded = Opm::EclIO::decompressSummaryVector(bytes.data(), bytes.size(), values.size());
+
+    BOOST_REQUIRE_EQUAL(decoded.size(), values.size());
+    BOOST_CHECK(std::memcmp(decoded.data(), values.data(), values.size() * sizeof(float)) == 0);
+
+    BOOST_CHECK_THROW(Opm::EclIO::decompressSummaryVector(bytes.data(), bytes.size(), values.size() + 1),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Opm::EclIO::decompressSummaryVector(bytes.data(), bytes.size(), values.size() - 1),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Opm::EclIO::decompressSummaryVector(bytes.data(), bytes.size() - 1, values.size()),
+                      std::runtime_error);
+
+    BOOST_CHECK(Opm::EclIO::compressSummaryVector({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_Compressed) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+    work.copyIn("SPE1CASE1_RST60.ESMRY");
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+
+    BOOST_CHECK(smry1.make_esmry_file());
+    const auto uncompressed_size = std::filesystem::file_size("SPE1CASE1.ESMRY");
+    std::filesystem::remove("SPE1CASE1.ESMRY");
+
+    BOOST_CHECK(smry1.make_esmry_file(true));
+    BOOST_CHECK(std::filesystem::file_size("SPE1CASE1.ESMRY") < uncompressed_size);
+
+    {
+        Opm::EclIO::EclFile file("SPE1CASE1.ESMRY");
+        BOOST_CHECK(file.hasKey("COLUMNS"));
+        BOOST_CHECK(file.hasKey("VECTDIR"));
+    }
+
+    ExtESmry esmry1("SPE1CASE1.ESMRY");
+
+    BOOST_CHECK_EQUAL(esmry1.numberOfTimeSteps(), smry1.numberOfTimeSteps());
+    BOOST_CHECK_EQUAL(esmry1.keywordList() == smry1.keywordList(), true);
+    BOOST_CHECK_EQUAL(esmry1.get_unit("FGOR"), smry1.get_unit("FGOR"));
+    BOOST_CHECK_EQUAL(esmry1.all_steps_available(), true);
+    BOOST_CHECK_EQUAL(esmry1.get_at_rstep("TIME") == smry1.get_at_rstep("TIME"), true);
+
+    // single vector first, then everything else
+    BOOST_CHECK_EQUAL(esmry1.get("BPR:10,10,3") == smry1.get("BPR:10,10,3"), true);
+
+    esmry1.loadData();
+
+    for (const auto& key : smry1.keywordList())
+        BOOST_CHECK_MESSAGE(esmry1.get(key) == smry1.get(key), "Vector " << key);
+
+    // restart run in original layout, base run in compressed layout
+
+    std::vector <float> time_ref, wgpr_prod_ref, wbhp_prod_ref, wbhp_inj_ref, fgor_ref, bpr_111_ref, bpr_10103_ref;
+
+    getRefSmryVect(time_ref, wgpr_prod_ref, wbhp_prod_ref, wbhp_inj_ref,fgor_ref, bpr_111_ref, bpr_10103_ref);
+
+    ExtESmry esmry2("SPE1CASE1_RST60.ESMRY", true);
+
+    BOOST_CHECK_EQUAL(esmry2.numberOfTimeSteps(), 123);
+    BOOST_CHECK_EQUAL(esmry2.get("TIME") == time_ref, true);
+
+    const auto& wgpr = esmry2.get("WGPR:PROD");
+
+    for (unsigned int i=0;i< wgpr.size();i++)
+        BOOST_REQUIRE_CLOSE (wgpr[i], wgpr_prod_ref[i], 0.01);
+}
+
+BOOST_AUTO_TEST_CASE(TestExtSmryOutput_Compressed) {
+
+    WorkArea work;
+
+    auto es = Opm::EclipseState { Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+DX
+ 4*100 /
+DY
+ 4*100 /
+DZ
+ 4*10 /
+TOPS
+ 4*2000 /
+PORO
+ 4*0.3 /
+)") };
+
+    es.getIOConfig().setOutputDir(work.currentWorkingDirectory());
+    es.getIOConfig().setBaseName("COLUMNS");
+
+    const int nvect = 1500;
+
+    std::vector<std::string> keys { "TIME" };
+    std::vector<std::string> units { "DAYS" };
+
+    for (int n = 1; n < nvect; n++) {
+        keys.push_back("WOPR:W" + std::to_string(n));
+        units.push_back("SM3/DAY");
+    }
+
+    const int ntstep = 2*Opm::EclIO::ExtSmryOutput::max_chunk_size + 22;
+
+    // directory left behind by an earlier, interrupted, run
+    {
+        Opm::EclIO::EclOutput dir("COLUMNS.ESMRY.dir", false, std::ios::out);
+        dir.write<int>("CHUNKDIR", {0, 0, 0, 0});
+    }
+
+    Opm::EclIO::ExtSmryOutput output(keys, units, es, 0, true);
+
+    std::vector<float> rstep_ref;
+
+    for (int t = 0; t < ntstep; t++) {
+        std::vector<float> values(nvect);
+        values[0] = static_cast<float>(t);
+
+        // every other vector constant
+        for (int n = 1; n < nvect; n++)
+            values[n] = (n % 2 == 0) ? 1.0f*n : 1000.0f*n + t;
+
+        const int report_step = 1 + t / 3;
+
+        if ((t % 3 == 2) || (t == ntstep - 1))
+            rstep_ref.push_back(static_cast<float>(t));
+
+        output.write(values, report_step, t == ntstep - 1);
+    }
+
+    BOOST_CHECK(! std::filesystem::exists("COLUMNS.ESMRY.dir"));
+
+    {
+        Opm::EclIO::EclFile file("COLUMNS.ESMRY");
+        BOOST_CHECK(file.hasKey("COLUMNS"));
+        BOOST_CHECK(!file.hasKey("CHUNK"));
+    }
+
+    ExtESmry esmry("COLUMNS.ESMRY");
+
+    BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), static_cast<size_t>(ntstep));
+    BOOST_CHECK_EQUAL(esmry.all_steps_available(), true);
+    BOOST_CHECK_EQUAL(esmry.get_unit("WOPR:W7"), "SM3/DAY");
+    BOOST_CHECK_EQUAL(esmry.get_at_rstep("TIME") == rstep_ref, true);
+
+    for (int n = 1; n < nvect; n += 7) {
+        const auto& wopr = esmry.get("WOPR:W" + std::to_string(n));
+
+        BOOST_REQUIRE_EQUAL(wopr.size(), static_cast<size_t>(ntstep));
+
+        for (int t = 0; t < ntstep; t++)
+            BOOST_REQUIRE_EQUAL(wopr[t], (n % 2 == 0) ? 1.0f*n : 1000.0f*n + t);
+    }
+}
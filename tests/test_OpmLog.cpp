@@ -28,6 +28,7 @@
 #include <stdexcept>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 
 #include <opm/common/OpmLog/OpmLog.hpp>
@@ -370,6 +371,58 @@ BOOST_AUTO_TEST_CASE(TestOpmLogWithLimits)
 
 
 
+BOOST_AUTO_TEST_CASE(TestDeferMessages)
+{
+    OpmLog::removeAllBackends();
+
+    std::ostringstream log_stream;
+    {
+        auto streamLog = std::make_shared<StreamLog>(log_stream, Log::DefaultMessageTypes);
+        streamLog->setMessageFormatter(std::make_shared<SimpleMessageFormatter>(false, false));
+        OpmLog::addBackend("STREAM", streamLog);
+    }
+
+    OpmLog::DeferredMessages first;
+    OpmLog::DeferredMessages second;
+    OpmLog::DeferredMessages discarded;
+
+    OpmLog::info("Before");
+    {
+        OpmLog::DeferMessages defer(second);
+        OpmLog::warning("Tag", "Second");
+
+        {
+            OpmLog::DeferMessages defer_inner(discarded);
+            OpmLog::error("Discarded");
+        }
+
+        // Messages of other threads are not held back
+        std::thread other([]() { OpmLog::info("Other thread"); });
+        other.join();
+
+        OpmLog::info("Third");
+    }
+    {
+        OpmLog::DeferMessages defer(first);
+        OpmLog::info("First");
+    }
+    OpmLog::info("After");
+
+    BOOST_CHECK(!second.empty());
+    BOOST_CHECK_EQUAL(log_stream.str(), "Before\nOther thread\nAfter\n");
+
+    discarded.clear();
+    first.release();
+    second.release();
+    discarded.release();
+
+    BOOST_CHECK(first.empty());
+    BOOST_CHECK(second.empty());
+    BOOST_CHECK_EQUAL(log_stream.str(), "Before\nOther thread\nAfter\nFirst\nSecond\nThird\n");
+}
+
+
+
 BOOST_AUTO_TEST_CASE(TestsetupSimpleLog)
 {
     bool use_prefix = false;
@@ -24,6 +24,8 @@
 
 #include <opm/io/eclipse/ERst.hpp>
 
+#include <opm/output/eclipse/VectorItems/intehead.hpp>
+
 #include <algorithm>
 #include <cmath>
 #include <iterator>
@@ -32,6 +34,8 @@
 #include <tuple>
 #include <type_traits>
 
+namespace VI = ::Opm::RestartIO::Helpers::VectorItems;
+
 namespace {
 
 template <typename T>
@@ -86,4 +90,31 @@ BOOST_AUTO_TEST_CASE(Load_Step_10)
     BOOST_CHECK_MESSAGE(zwel == ref_zwel_10, "ZWEL must equal reference");
 }
 
+BOOST_AUTO_TEST_CASE(Keyword_Window)
+{
+    const auto rst1 = openRestart("ACTIONX_M1.UNRST", 10);
+
+    const auto& intehead = rst1->intehead();
+    const auto& icon = rst1->getKeyword<int>("ICON");
+    const auto& xcon = rst1->getKeyword<double>("XCON");
+
+    // One window per connection.  The connections of the second well
+    // straddle the record boundary of ICON and XCON.
+    const auto niconz = static_cast<std::size_t>(intehead[VI::intehead::NICONZ]);
+    const auto nxconz = static_cast<std::size_t>(intehead[VI::intehead::NXCONZ]);
+
+    const auto rst2 = openRestart("ACTIONX_M1.UNRST", 10);
+
+    for (std::size_t conn = 0; conn < icon.size() / niconz; ++conn) {
+        const auto icon_conn = rst2->getKeywordWindow<int>("ICON", niconz, conn);
+        const auto xcon_conn = rst2->getKeywordWindow<double>("XCON", nxconz, conn);
+
+        BOOST_CHECK(std::equal(icon_conn.begin(), icon_conn.end(), icon.begin() + conn*niconz));
+        BOOST_CHECK(std::equal(xcon_conn.begin(), xcon_conn.end(), xcon.begin() + conn*nxconz));
+    }
+
+    BOOST_CHECK_THROW(rst2->getKeywordWindow<int>("ICON", niconz, icon.size() / niconz),
+                      std::out_of_range);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -37,6 +37,7 @@
 #include <opm/input/eclipse/Python/Python.hpp>
 
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/NameTable.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 
@@ -46,6 +47,8 @@
 #include <opm/io/eclipse/ERsm.hpp>
 #include <opm/io/eclipse/ESmry.hpp>
 
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -73,6 +76,10 @@
 
 #include <fmt/format.h>
 
+#if _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Opm;
 using rt = data::Rates::opt;
 using p_cmode = Opm::Group::ProductionCMode;
@@ -2915,6 +2922,45 @@ BOOST_AUTO_TEST_CASE(efficiency_factor) {
         BOOST_CHECK_CLOSE( 200.1 * 0.2 * 0.01, ecl_sum_get_well_connection_var( resp, 1, "W_2", "COPT", 2, 1, 1 ), 1e-5 );
 }
 
+BOOST_AUTO_TEST_CASE(parallel_eval)
+{
+    setup cfg( "test_summary_parallel_eval" );
+
+    const auto start = TimeService::now();
+    const auto undef = cfg.es.runspec().udqParams().undefinedValue();
+
+    SummaryState st_serial(start, undef);
+    SummaryState st_parallel(start, undef);
+
+    out::Summary serial(cfg.config, cfg.es, cfg.grid, cfg.schedule, cfg.name);
+    out::Summary parallel(cfg.config, cfg.es, cfg.grid, cfg.schedule, cfg.name);
+    parallel.set_parallel_eval(true);
+
+#if _OPENMP
+    // Use several threads even if the environment does not ask for them.
+    const auto num_threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+#endif
+
+    for (const auto step : { 0, 1, 2, 3 }) {
+        serial.eval(st_serial, step, step*day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+        parallel.eval(st_parallel, step, step*day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    }
+
+#if _OPENMP
+    omp_set_num_threads(num_threads);
+#endif
+
+    BOOST_CHECK_EQUAL(st_parallel.size(), st_serial.size());
+
+    for (const auto& [key, value] : st_serial) {
+        BOOST_REQUIRE_MESSAGE(st_parallel.has(key), "Missing " << key);
+        BOOST_CHECK_CLOSE(st_parallel.get(key), value, 1.0e-10);
+    }
+
+    BOOST_CHECK(st_parallel == st_serial);
+}
+
 BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     Opm::SummaryState st(TimeService::now(), 0.0);
     st.update("WWCT:OP_2", 100);
@@ -6736,4 +6782,148 @@ BOOST_AUTO_TEST_CASE(append_summary_state) {
     BOOST_CHECK_EQUAL(st_both.get_group_var("G1", "WOPR"), 3000);
 }
 
+BOOST_AUTO_TEST_CASE(SummaryState_KeyId) {
+    SummaryState st(TimeService::now(), -1.0);
+
+    const auto wopt = st.well_key_id("OP1", "WOPT");
+    const auto wopr = st.well_key_id("OP1", "WOPR");
+    BOOST_CHECK_EQUAL(st.well_key_id("OP1", "WOPT"), wopt);
+    BOOST_CHECK(wopt != wopr);
+    BOOST_CHECK(!st.has_value(wopt));
+
+    st.update_value(wopt, 100);
+    st.update_value(wopt, 100);
+    st.update_value(wopr, 10);
+    st.update_value(wopr, 20);
+    BOOST_CHECK_EQUAL(st.get_value(wopt), 200);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 200);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 200);
+    BOOST_CHECK_EQUAL(st.get_value(wopr), 20);
+    BOOST_CHECK_EQUAL(st.num_wells(), 1U);
+
+    st.update_well_var("OP1", "WOPT", 50);
+    BOOST_CHECK_EQUAL(st.get_value(wopt), 250);
+
+    const auto wwct = st.well_key_id("OP2", "WWCT");
+    BOOST_CHECK_EQUAL(st.get_value(wwct, 0.5), 0.5);
+    BOOST_CHECK_THROW(st.get_value(wwct), std::invalid_argument);
+    BOOST_CHECK_EQUAL(st.get_value(st.well_key_id("OP2", "WUX")), -1.0);
+
+    const auto fopr = st.key_id("FOPR");
+    BOOST_CHECK_THROW(st.get_value(fopr), std::out_of_range);
+    st.update_value(fopr, 1000);
+    BOOST_CHECK_EQUAL(st.get("FOPR"), 1000);
+
+    const auto ropr = st.region_key_id("FIPABC", "ROPR", 3);
+    BOOST_CHECK_EQUAL(st.region_key_id("ABC", "ROPR", 3), ropr);
+    st.update_value(ropr, 12.5);
+    BOOST_CHECK_EQUAL(st.get_region_var("FIPABC", "ROPR", 3), 12.5);
+    BOOST_CHECK_EQUAL(st.get("ROPR_ABC:3"), 12.5);
+
+    const auto copr = st.conn_key_id("OP1", "COPR", 7);
+    st.update_value(copr, 1.5);
+    BOOST_CHECK(st.has_conn_var("OP1", "COPR", 7));
+    BOOST_CHECK_EQUAL(st.get_conn_var("OP1", "COPR", 8, 2.5), 2.5);
+
+    // WOPT:OP1, WOPR:OP1, FOPR, ROPR_ABC:3, COPR:OP1:7
+    BOOST_CHECK_EQUAL(st.size(), 5U);
+    BOOST_CHECK_EQUAL(std::distance(st.begin(), st.end()), 5);
+
+    // Identifiers are shared by copies, but not by independently
+    // constructed objects.
+    auto copy = st;
+    BOOST_CHECK_EQUAL(copy.key_scope(), st.key_scope());
+    BOOST_CHECK_EQUAL(copy.well_key_id("OP1", "WOPT"), wopt);
+    copy.update_value(wopt, 1);
+    BOOST_CHECK_EQUAL(copy.get_value(wopt), 251);
+    BOOST_CHECK_EQUAL(st.get_value(wopt), 250);
+
+    SummaryState st2(TimeService::now(), -1.0);
+    BOOST_CHECK(st2.key_scope() != st.key_scope());
+    st2.update_well_var("OP9", "WOPT", 7);
+    st2.update_well_var("OP1", "WOPT", 8);
+    BOOST_CHECK_EQUAL(st2.get_value(st2.well_key_id("OP1", "WOPT")), 8);
+    BOOST_CHECK_EQUAL(st.get_value(wopt), 250);
+
+    // Values of objects with different registries are matched by name.
+    SummaryState st3(TimeService::now(), -1.0);
+    st3.append(st2);
+    BOOST_CHECK_EQUAL(st3.get_well_var("OP1", "WOPT"), 8);
+    BOOST_CHECK_EQUAL(st3.get_well_var("OP9", "WOPT"), 7);
+    BOOST_CHECK_EQUAL(st3.get("WOPT:OP9"), 7);
+    BOOST_CHECK_EQUAL(st3.num_wells(), 2U);
+
+    // Variable and entity names live in the shared name table, full
+    // summary keys do not.
+    BOOST_CHECK(NameTable::find("OP1").has_value());
+    BOOST_CHECK(! NameTable::find("WOPT:OP1").has_value());
+    BOOST_CHECK_EQUAL(st.well_key_id(NameTable::index("OP1"),
+                                     NameTable::index("WOPT")), wopt);
+    BOOST_CHECK_EQUAL(st.group_key_id(NameTable::index("G1"),
+                                      NameTable::index("GOPR")),
+                      st.group_key_id("G1", "GOPR"));
+}
+
+BOOST_AUTO_TEST_CASE(SummaryState_Query_Does_Not_Register) {
+    SummaryState st(TimeService::now(), -1.0);
+    st.update_well_var("QP1", "WOPR", 10.0);
+
+    BOOST_CHECK(!st.has("FQUERY"));
+    BOOST_CHECK(!st.has_well_var("QP2", "WQUERY"));
+    BOOST_CHECK(!st.has_group_var("QG1", "GQUERY"));
+    BOOST_CHECK(!st.has_conn_var("QP1", "CQUERY", 1));
+    BOOST_CHECK(!st.has_segment_var("QP1", "SQUERY", 1));
+    BOOST_CHECK(!st.has_region_var("FIPQUERY", "RQUERY", 1));
+
+    BOOST_CHECK_THROW(st.get("FQUERY"), std::out_of_range);
+    BOOST_CHECK_THROW(st.get_well_var("QP2", "WOPR"), std::invalid_argument);
+    BOOST_CHECK_THROW(st.get_well_var("QP1", "WQUERY"), std::invalid_argument);
+    BOOST_CHECK_EQUAL(st.get("FQUERY", 1.5), 1.5);
+    BOOST_CHECK_EQUAL(st.get_group_var("QG1", "GQUERY", 2.5), 2.5);
+    BOOST_CHECK_EQUAL(st.get_region_var("FIPQUERY", "RQUERY", 1, 3.5), 3.5);
+
+    // Unregistered UDQs are reported as undefined.
+    BOOST_CHECK(st.has("FUQUERY"));
+    BOOST_CHECK(st.has_well_var("QP2", "WUQUERY"));
+    BOOST_CHECK(!st.has_segment_var("QP1", "SUQUERY", 1));
+    BOOST_CHECK_EQUAL(st.get("FUQUERY"), -1.0);
+    BOOST_CHECK_EQUAL(st.get_well_var("QP2", "WUQUERY"), -1.0);
+
+    for (const auto* name : { "FQUERY", "QP2", "WQUERY", "QG1", "GQUERY",
+                              "CQUERY", "SQUERY", "RQUERY", "FUQUERY",
+                              "WUQUERY", "SUQUERY" })
+    {
+        BOOST_CHECK_MESSAGE(!NameTable::find(name).has_value(),
+                            "Query must not register " << name);
+    }
+
+    BOOST_CHECK_EQUAL(st.get_well_var("QP1", "WOPR"), 10.0);
+}
+
+BOOST_AUTO_TEST_CASE(SummaryState_Pack_Keeps_Versions) {
+    SummaryState st(TimeService::now(), -1.0);
+    st.update("FOPR", 1.0);
+    st.update_well_var("OP1", "WOPR", 2.0);
+
+    const auto fopr = st.var_version("FOPR");
+    const auto wopr = st.var_version("WOPR");
+
+    SummaryState st0(TimeService::now(), -1.0);
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(st);
+        ser.unpack(st0);
+    }
+
+    // Packing must not modify the source object.
+    BOOST_CHECK_EQUAL(st.var_version("FOPR"), fopr);
+    BOOST_CHECK_EQUAL(st.var_version("WOPR"), wopr);
+
+    // Stamps are never reused across objects.
+    BOOST_CHECK(st0.var_version("FOPR") != fopr);
+    BOOST_CHECK_EQUAL(st0.get("FOPR"), 1.0);
+    BOOST_CHECK_EQUAL(st0.get_well_var("OP1", "WOPR"), 2.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary_State